@@ -0,0 +1,932 @@
+#include <cmath>
+#include <cstdlib>
+#include <set>
+#include <sstream>
+
+#include "logger.h"
+#include "tokenize.h"
+#include "schema.h"
+#include "buffercalculator.h"
+
+using namespace std;
+using namespace swss;
+
+#ifndef STATE_ASIC_TABLE_NAME
+#define STATE_ASIC_TABLE_NAME                       "ASIC_TABLE"
+#endif
+#ifndef CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME
+#define CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME     "LOSSLESS_TRAFFIC_PATTERN"
+#endif
+
+#define INGRESS_LOSSLESS_POOL_NAME                  "ingress_lossless_pool"
+#define EGRESS_LOSSLESS_POOL_NAME                   "egress_lossless_pool"
+
+// Constants shared by the headroom models, see buffer_headroom_<vendor>.lua
+static const double SPEED_OF_LIGHT = 198000000;
+static const double MINIMAL_PACKET_SIZE = 64;
+
+static inline bool isZero(double value)
+{
+    return !(value < 0 || value > 0);
+}
+
+static inline double ceilTo1K(double value)
+{
+    return ceil(value / 1024) * 1024;
+}
+
+// Format a number the way lua does when concatenating it to a string
+static string numberToString(double value)
+{
+    if (isZero(value - floor(value)) && fabs(value) < 1e15)
+    {
+        return to_string(static_cast<long long>(value));
+    }
+    ostringstream oss;
+    oss.precision(14);
+    oss << value;
+    return oss.str();
+}
+
+// Ethernet0:3-4 => 2, Ethernet0:3 => 1
+long BufferApplDbLedger::getObjectCount(const string &key, string &port)
+{
+    auto pos = key.find(':');
+    port = key.substr(0, pos);
+    if (port.compare(0, 8, "Ethernet") != 0 || pos == string::npos)
+    {
+        return 0;
+    }
+
+    auto range = key.substr(pos + 1);
+    auto dash = range.find('-');
+    if (dash == string::npos)
+    {
+        return 1;
+    }
+
+    return atol(range.c_str() + dash + 1) - atol(range.c_str()) + 1;
+}
+
+void BufferApplDbLedger::addObjectRef(bool pg, const object_ref_t &ref, long delta)
+{
+    if (ref.count == 0)
+    {
+        return;
+    }
+
+    auto update = [&](profile_refs_t &refs) {
+        auto &count = refs[ref.profile];
+        count += delta * ref.count;
+        if (count == 0)
+        {
+            refs.erase(ref.profile);
+        }
+    };
+
+    update(m_objectRefs);
+    update(m_portObjectRefs[ref.port]);
+    if (m_portObjectRefs[ref.port].empty())
+    {
+        m_portObjectRefs.erase(ref.port);
+    }
+    if (pg)
+    {
+        update(m_portPgRefs[ref.port]);
+        if (m_portPgRefs[ref.port].empty())
+        {
+            m_portPgRefs.erase(ref.port);
+        }
+    }
+}
+
+void BufferApplDbLedger::set(buffer_ledger_table_t table, const string &key, const vector<FieldValueTuple> &values)
+{
+    switch (table)
+    {
+    case BUFFER_LEDGER_PROFILE:
+    {
+        // Fields are merged like HSET does
+        auto &fields = m_profiles[key];
+        for (auto &fv : values)
+        {
+            fields[fvField(fv)] = fvValue(fv);
+        }
+        break;
+    }
+    case BUFFER_LEDGER_PG:
+    case BUFFER_LEDGER_QUEUE:
+    {
+        bool pg = (table == BUFFER_LEDGER_PG);
+        auto &objects = m_objects[pg ? 0 : 1];
+        auto it = objects.find(key);
+        object_ref_t ref;
+        if (it != objects.end())
+        {
+            ref = it->second;
+        }
+        else
+        {
+            ref.count = getObjectCount(key, ref.port);
+        }
+
+        for (auto &fv : values)
+        {
+            if (fvField(fv) == "profile")
+            {
+                if (it != objects.end())
+                {
+                    addObjectRef(pg, it->second, -1);
+                }
+                ref.profile = fvValue(fv);
+                addObjectRef(pg, ref, 1);
+                objects[key] = ref;
+                break;
+            }
+        }
+        break;
+    }
+    case BUFFER_LEDGER_INGRESS_PROFILE_LIST:
+    case BUFFER_LEDGER_EGRESS_PROFILE_LIST:
+    {
+        auto &lists = m_profileLists[table == BUFFER_LEDGER_INGRESS_PROFILE_LIST ? 0 : 1];
+        for (auto &fv : values)
+        {
+            if (fvField(fv) == "profile_list")
+            {
+                lists[key] = tokenize(fvValue(fv), ',');
+                break;
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void BufferApplDbLedger::del(buffer_ledger_table_t table, const string &key)
+{
+    switch (table)
+    {
+    case BUFFER_LEDGER_PROFILE:
+        m_profiles.erase(key);
+        break;
+    case BUFFER_LEDGER_PG:
+    case BUFFER_LEDGER_QUEUE:
+    {
+        bool pg = (table == BUFFER_LEDGER_PG);
+        auto &objects = m_objects[pg ? 0 : 1];
+        auto it = objects.find(key);
+        if (it != objects.end())
+        {
+            addObjectRef(pg, it->second, -1);
+            objects.erase(it);
+        }
+        break;
+    }
+    case BUFFER_LEDGER_INGRESS_PROFILE_LIST:
+    case BUFFER_LEDGER_EGRESS_PROFILE_LIST:
+        m_profileLists[table == BUFFER_LEDGER_INGRESS_PROFILE_LIST ? 0 : 1].erase(key);
+        break;
+    default:
+        break;
+    }
+}
+
+BufferCalculator::BufferCalculator(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb) :
+    m_cfgLosslessTrafficPatternTable(cfgDb, CFG_LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME),
+    m_stateAsicTable(stateDb, STATE_ASIC_TABLE_NAME),
+    m_applBufferPoolTable(applDb, APP_BUFFER_POOL_TABLE_NAME),
+    m_parametersStale(true)
+{
+}
+
+unique_ptr<BufferCalculator> BufferCalculator::create(const string &vendor, DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb)
+{
+    // The vs plugins are copies of the mellanox ones
+    if (vendor == "mellanox" || vendor == "vs")
+    {
+        return unique_ptr<BufferCalculator>(new MellanoxBufferCalculator(cfgDb, stateDb, applDb));
+    }
+    if (vendor == "barefoot")
+    {
+        return unique_ptr<BufferCalculator>(new BarefootBufferCalculator(cfgDb, stateDb, applDb));
+    }
+
+    return unique_ptr<BufferCalculator>(new BufferCalculator(cfgDb, stateDb, applDb));
+}
+
+void BufferCalculator::refreshParameters()
+{
+    if (!m_parametersStale)
+    {
+        return;
+    }
+    m_parametersStale = false;
+
+    auto fetch = [](Table &table, string &key, parameters_t &parameters) {
+        vector<string> keys;
+        vector<FieldValueTuple> fvs;
+        table.getKeys(keys);
+        key = keys.empty() ? "" : keys[0];
+        parameters.clear();
+        if (!key.empty() && table.get(key, fvs))
+        {
+            for (auto &fv : fvs)
+            {
+                parameters[fvField(fv)] = fvValue(fv);
+            }
+        }
+    };
+
+    string asicKey, patternKey;
+    parameters_t asicParameters, trafficPattern;
+    fetch(m_stateAsicTable, asicKey, asicParameters);
+    fetch(m_cfgLosslessTrafficPatternTable, patternKey, trafficPattern);
+
+    if (asicKey != m_asicKey || asicParameters != m_asicParameters || trafficPattern != m_trafficPattern)
+    {
+        if (!m_headroomMemo.empty())
+        {
+            SWSS_LOG_NOTICE("ASIC or lossless traffic parameters changed, dropping %zu memoized headroom results", m_headroomMemo.size());
+            m_headroomMemo.clear();
+        }
+        m_asicKey = move(asicKey);
+        m_asicParameters = move(asicParameters);
+        m_trafficPattern = move(trafficPattern);
+    }
+}
+
+bool BufferCalculator::calculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom)
+{
+    if (!isNative())
+    {
+        return false;
+    }
+
+    refreshParameters();
+
+    auto key = make_tuple(input.speed, input.cable_length, input.port_mtu, input.gearbox_delay, input.lane_count, input.shp_enabled);
+    auto it = m_headroomMemo.find(key);
+    if (it != m_headroomMemo.end())
+    {
+        headroom = it->second;
+        return true;
+    }
+
+    if (!doCalculateHeadroom(input, headroom))
+    {
+        return false;
+    }
+
+    m_headroomMemo[key] = headroom;
+    return true;
+}
+
+bool BufferCalculator::calculatePoolSizes(const buffer_pool_calc_input_t &input, const BufferApplDbLedger &ledger, vector<string> &result)
+{
+    if (!isNative())
+    {
+        return false;
+    }
+
+    refreshParameters();
+
+    result.clear();
+    return doCalculatePoolSizes(input, ledger, result);
+}
+
+void BufferCalculator::fetchPoolSizesFromApplDb(const buffer_pool_calc_input_t &input, bool shp_enabled, vector<string> &result)
+{
+    result.clear();
+
+    for (auto &pool : input.pools)
+    {
+        if (!pool.dynamic_size)
+        {
+            continue;
+        }
+
+        string size, xoff;
+        if (!m_applBufferPoolTable.hget(pool.name, "size", size))
+        {
+            size = "0";
+        }
+        if (m_applBufferPoolTable.hget(pool.name, "xoff", xoff))
+        {
+            result.push_back(pool.name + ":" + size + ":" + xoff);
+        }
+        else if (shp_enabled && size == "0" && pool.name == INGRESS_LOSSLESS_POOL_NAME)
+        {
+            // The profiles may already indicate the shared headroom pool is enabled while the pool sizes haven't been set yet,
+            // which fails the Mellanox SAI sanity check. Indicate it by a very small pool and shared headroom pool
+            result.push_back(pool.name + ":2048:1024");
+        }
+        else
+        {
+            result.push_back(pool.name + ":" + size);
+        }
+    }
+}
+
+bool BufferCalculator::getNumber(const parameters_t &parameters, const string &field, double &value)
+{
+    auto it = parameters.find(field);
+    if (it == parameters.end() || it->second.empty())
+    {
+        return false;
+    }
+
+    char *end = nullptr;
+    value = strtod(it->second.c_str(), &end);
+    return end != nullptr && *end == '\0';
+}
+
+// Like lua's tonumber(), but returns 0 for a string which is not a number
+double BufferCalculator::toNumber(const string &value)
+{
+    if (value.empty())
+    {
+        return 0;
+    }
+
+    char *end = nullptr;
+    double number = strtod(value.c_str(), &end);
+    return (end != nullptr && *end == '\0') ? number : 0;
+}
+
+string BufferCalculator::ceilToString(double value)
+{
+    return to_string(static_cast<long long>(ceil(value)));
+}
+
+// See buffer_headroom_mellanox.lua
+bool MellanoxBufferCalculator::doCalculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom)
+{
+    // Number of pause quanta per operating speed in Mb/s, as IEEE 802.3 31B.3.7 defines
+    static const map<long, double> pauseQuantaPerSpeed = {
+        {800000, 905}, {400000, 905}, {200000, 453}, {100000, 394}, {50000, 147},
+        {40000, 118}, {25000, 80}, {10000, 67}, {1000, 2}, {100, 1}
+    };
+
+    double cell_size, pipeline_latency, mac_phy_delay, peer_response_time = 0;
+    double lossless_mtu, small_packet_percentage;
+
+    if (input.cable_length.empty() ||
+        !getNumber(m_asicParameters, "cell_size", cell_size) ||
+        !getNumber(m_asicParameters, "pipeline_latency", pipeline_latency) ||
+        !getNumber(m_asicParameters, "mac_phy_delay", mac_phy_delay) ||
+        !getNumber(m_trafficPattern, "mtu", lossless_mtu) ||
+        !getNumber(m_trafficPattern, "small_packet_percentage", small_packet_percentage))
+    {
+        return false;
+    }
+
+    double port_speed = toNumber(input.speed);
+    double cable_length = toNumber(input.cable_length.substr(0, input.cable_length.size() - 1));
+    double port_mtu = toNumber(input.port_mtu);
+    double gearbox_delay = toNumber(input.gearbox_delay);
+
+    pipeline_latency *= 1024;
+    mac_phy_delay *= 1024;
+
+    auto pauseQuanta = pauseQuantaPerSpeed.find(static_cast<long>(port_speed));
+    if (pauseQuanta != pauseQuantaPerSpeed.end())
+    {
+        peer_response_time = pauseQuanta->second * 512 / 8;
+    }
+    else if (getNumber(m_asicParameters, "peer_response_time", peer_response_time))
+    {
+        peer_response_time *= 1024;
+    }
+    else
+    {
+        return false;
+    }
+
+    // The last digit of the ASIC key, like MELLANOX-SPECTRUM-4, is the generation of the ASIC
+    char generation = m_asicKey.empty() ? '\0' : m_asicKey.back();
+    double kb_on_tile = 0;
+    if (generation == '4' || generation == '5')
+    {
+        kb_on_tile = port_speed / 1000 * 120 / 8;
+    }
+
+    double speed_overhead = 0;
+    if (input.lane_count == 8)
+    {
+        pipeline_latency *= 2;
+        speed_overhead = port_mtu;
+    }
+
+    double worst_case_factor;
+    if (cell_size > 2 * MINIMAL_PACKET_SIZE)
+    {
+        worst_case_factor = cell_size / MINIMAL_PACKET_SIZE;
+    }
+    else
+    {
+        worst_case_factor = (2 * cell_size) / (1 + cell_size);
+    }
+    worst_case_factor = ceil(worst_case_factor);
+
+    double small_packet_percentage_by_byte = 100 * MINIMAL_PACKET_SIZE /
+        ((small_packet_percentage * MINIMAL_PACKET_SIZE + (100 - small_packet_percentage) * lossless_mtu) / 100);
+    double cell_occupancy = (100 - small_packet_percentage_by_byte + small_packet_percentage_by_byte * worst_case_factor) / 100;
+
+    double bytes_on_gearbox = isZero(gearbox_delay) ? 0 : port_speed * gearbox_delay / (8 * 1024);
+    double bytes_on_cable = 2 * cable_length * port_speed * 1000000000 / SPEED_OF_LIGHT / (8 * 1000);
+    double propagation_delay = port_mtu + bytes_on_cable + 2 * bytes_on_gearbox + mac_phy_delay + peer_response_time + kb_on_tile;
+
+    double xoff_value = ceilTo1K(lossless_mtu + propagation_delay * cell_occupancy);
+
+    // Spectrum-6 requires additional headroom for ASIC packet-buffer accounting
+    if (generation == '6')
+    {
+        xoff_value += 18 * 1024;
+    }
+
+    // Without shared headroom pool, compensate the headroom calculated with a reduced
+    // small packet percentage if it remains more than 2 kB below the worst case
+    if (!input.shp_enabled && !isZero(small_packet_percentage - 100))
+    {
+        double full_small_packet_xoff = ceilTo1K(lossless_mtu + propagation_delay * worst_case_factor);
+        if (xoff_value + 2 * 1024 < full_small_packet_xoff)
+        {
+            xoff_value += 2 * 1024;
+        }
+    }
+
+    double xon_value = ceilTo1K(pipeline_latency);
+    double headroom_size = input.shp_enabled ? xon_value : xoff_value + xon_value + speed_overhead;
+    headroom_size = ceilTo1K(headroom_size);
+
+    headroom.xon = ceilToString(xon_value);
+    headroom.xoff = ceilToString(xoff_value);
+    headroom.size = ceilToString(headroom_size);
+    headroom.xon_offset.clear();
+
+    return true;
+}
+
+// See buffer_pool_mellanox.lua
+bool MellanoxBufferCalculator::doCalculatePoolSizes(const buffer_pool_calc_input_t &input, const BufferApplDbLedger &ledger, vector<string> &result)
+{
+    const double private_headroom = 10 * 1024;
+    const double mgmt_pool_size = 256 * 1024;
+    double egress_mirror_headroom = 10 * 1024;
+    double modification_descriptors_pool_size = 0;
+
+    double cell_size, pipeline_latency;
+    if (!getNumber(m_asicParameters, "cell_size", cell_size) ||
+        !getNumber(m_asicParameters, "pipeline_latency", pipeline_latency) ||
+        isZero(cell_size))
+    {
+        return false;
+    }
+
+    // SN6000 and later reserve 32 MB for the modification descriptors pool
+    for (auto pos = input.platform.find("sn"); pos != string::npos; pos = input.platform.find("sn", pos + 2))
+    {
+        if (isdigit(input.platform[pos + 2]))
+        {
+            if (atol(input.platform.c_str() + pos + 2) >= 6000)
+            {
+                modification_descriptors_pool_size = 32 * 1024 * 1024;
+                egress_mirror_headroom = 0;
+            }
+            break;
+        }
+    }
+
+    set<string> ingressPools;
+    for (auto &pool : input.pools)
+    {
+        if (pool.ingress)
+        {
+            ingressPools.insert(pool.name);
+        }
+    }
+
+    long total_port = static_cast<long>(input.ports.size());
+    long port_count_8lanes = 0, admin_up_port = 0, admin_up_8lanes_port = 0;
+    set<string> portSet8lanes;
+    for (auto &port : input.ports)
+    {
+        bool is8lanes = (port.second.lane_count == 8);
+        if (is8lanes)
+        {
+            portSet8lanes.insert(port.first);
+            port_count_8lanes++;
+        }
+        if (port.second.admin_up)
+        {
+            admin_up_port++;
+            if (is8lanes)
+            {
+                admin_up_8lanes_port++;
+            }
+        }
+    }
+
+    double over_subscribe_ratio = toNumber(input.over_subscribe_ratio);
+    double shp_size = toNumber(input.shp_size);
+    bool shp_enabled = !isZero(over_subscribe_ratio) || !isZero(shp_size);
+
+    double mmu_size = toNumber(input.mmu_size);
+    if (isZero(mmu_size))
+    {
+        for (auto &pool : input.pools)
+        {
+            if (pool.name == EGRESS_LOSSLESS_POOL_NAME)
+            {
+                mmu_size = toNumber(pool.configured_size);
+            }
+        }
+        if (isZero(mmu_size))
+        {
+            return false;
+        }
+    }
+
+    double lossypg_reserved = pipeline_latency * 1024;
+    double lossypg_reserved_8lanes = (2 * pipeline_latency - 1) * 1024;
+
+    // Align mmu_size at cell size boundary, otherwise the sdk will complain and the syncd will fail
+    double ceiling_mmu_size = floor(mmu_size / cell_size) * cell_size;
+
+    // XXX_TABLE_KEY_SET or XXX_TABLE_DEL_SET existing means the orchagent hasn't handled all updates
+    // In this case, the pool sizes are not calculated for now and will retry later
+    if (input.updates_pending)
+    {
+        fetchPoolSizesFromApplDb(input, shp_enabled, result);
+        return true;
+    }
+
+    // Ingress profiles are lossless if they have xoff, lossy ones implicitly reserve buffer when applied on PGs
+    const auto &profiles = ledger.getProfiles();
+    map<string, bool> ingressProfileIsLossless;
+    for (auto &profile : profiles)
+    {
+        auto pool = profile.second.find("pool");
+        if (pool != profile.second.end() && ingressPools.find(pool->second) != ingressPools.end())
+        {
+            ingressProfileIsLossless[profile.first] = (profile.second.find("xoff") != profile.second.end());
+        }
+    }
+    auto isIngressLossy = [&](const string &name) {
+        auto it = ingressProfileIsLossless.find(name);
+        return it != ingressProfileIsLossless.end() && !it->second;
+    };
+    auto isIngressLossless = [&](const string &name) {
+        auto it = ingressProfileIsLossless.find(name);
+        return it != ingressProfileIsLossless.end() && it->second;
+    };
+
+    // A referenced profile can be missing when the objects are updated ahead of it,
+    // keep the current pool sizes and retry later in that case
+    map<string, long> references;
+    for (auto &ref : ledger.getObjectRefs())
+    {
+        if (profiles.find(ref.first) == profiles.end())
+        {
+            SWSS_LOG_INFO("Profile %s referenced by %ld buffer objects is not in APPL_DB", ref.first.c_str(), ref.second);
+            fetchPoolSizesFromApplDb(input, shp_enabled, result);
+            return true;
+        }
+        references[ref.first] += ref.second;
+    }
+
+    // The lossy ingress profile is shared by PG 0 and the ingress profile list,
+    // it occupies buffer in the former but not in the latter
+    for (bool ingress : {true, false})
+    {
+        for (auto &list : ledger.getProfileLists(ingress))
+        {
+            for (auto &name : list.second)
+            {
+                if (isIngressLossy(name))
+                {
+                    continue;
+                }
+                if (profiles.find(name) == profiles.end())
+                {
+                    SWSS_LOG_INFO("Profile %s referenced by profile list of %s is not in APPL_DB", name.c_str(), list.first.c_str());
+                    fetchPoolSizesFromApplDb(input, shp_enabled, result);
+                    return true;
+                }
+                references[name]++;
+            }
+        }
+    }
+
+    long lossless_port_count = 0;
+    for (auto &port : ledger.getPortPgRefs())
+    {
+        for (auto &ref : port.second)
+        {
+            if (isIngressLossless(ref.first))
+            {
+                lossless_port_count++;
+                break;
+            }
+        }
+    }
+
+    long lossypg_8lanes = 0;
+    for (auto &port : ledger.getPortObjectRefs())
+    {
+        if (portSet8lanes.find(port.first) == portSet8lanes.end())
+        {
+            continue;
+        }
+        for (auto &ref : port.second)
+        {
+            if (isIngressLossy(ref.first))
+            {
+                lossypg_8lanes += ref.second;
+            }
+        }
+    }
+
+    // Accumulate sizes of all the profiles
+    double accumulative_occupied_buffer = 0;
+    double accumulative_xoff = 0;
+    vector<string> statistics;
+
+    for (auto &profile : profiles)
+    {
+        auto &name = profile.first;
+        long count = references[name];
+        double size, xon, xoff;
+
+        if (!getNumber(profile.second, "size", size))
+        {
+            statistics.push_back(name + ":-:" + to_string(count));
+            continue;
+        }
+
+        if (isIngressLossy(name))
+        {
+            size += lossypg_reserved;
+        }
+        if (!isZero(size))
+        {
+            if (isZero(shp_size) &&
+                getNumber(profile.second, "xon", xon) &&
+                getNumber(profile.second, "xoff", xoff) &&
+                xon + xoff > size)
+            {
+                accumulative_xoff += (xon + xoff - size) * static_cast<double>(count);
+            }
+            accumulative_occupied_buffer += size * static_cast<double>(count);
+        }
+        statistics.push_back(name + ":" + numberToString(size) + ":" + to_string(count));
+    }
+
+    // Extra lossy xon buffer for ports with 8 lanes
+    accumulative_occupied_buffer += (lossypg_reserved_8lanes - lossypg_reserved) * static_cast<double>(lossypg_8lanes);
+
+    // Accumulate sizes for private headrooms
+    double accumulative_private_headroom = 0;
+    bool force_enable_shp = false;
+    if (accumulative_xoff > 0 && !shp_enabled)
+    {
+        force_enable_shp = true;
+        shp_size = 655360;
+        shp_enabled = true;
+    }
+    if (shp_enabled)
+    {
+        accumulative_private_headroom = static_cast<double>(lossless_port_count) * private_headroom;
+        accumulative_occupied_buffer += accumulative_private_headroom;
+        accumulative_xoff -= accumulative_private_headroom;
+        if (accumulative_xoff < 0)
+        {
+            accumulative_xoff = 0;
+        }
+    }
+
+    // Accumulate sizes for management PGs, egress mirror and management pool
+    double accumulative_management_pg = static_cast<double>(admin_up_port - admin_up_8lanes_port) * lossypg_reserved
+                                        + static_cast<double>(admin_up_8lanes_port) * lossypg_reserved_8lanes;
+    double accumulative_egress_mirror_overhead = static_cast<double>(admin_up_port) * egress_mirror_headroom;
+    accumulative_occupied_buffer += accumulative_management_pg;
+    accumulative_occupied_buffer += accumulative_egress_mirror_overhead + mgmt_pool_size + modification_descriptors_pool_size;
+
+    // Fetch all the pools that need update
+    vector<const buffer_pool_calc_pool_t *> poolsNeedUpdate;
+    long ingress_pool_count = 0;
+    bool hasIngressLosslessPoolSize = false;
+    double ingress_lossless_pool_size = 0;
+    for (bool ingress : {true, false})
+    {
+        for (auto &pool : input.pools)
+        {
+            if (pool.ingress != ingress)
+            {
+                continue;
+            }
+            if (pool.dynamic_size)
+            {
+                poolsNeedUpdate.push_back(&pool);
+                if (ingress)
+                {
+                    ingress_pool_count++;
+                }
+            }
+            else if (pool.name == INGRESS_LOSSLESS_POOL_NAME && shp_enabled && isZero(shp_size))
+            {
+                hasIngressLosslessPoolSize = true;
+                ingress_lossless_pool_size = toNumber(pool.configured_size);
+            }
+        }
+    }
+
+    if (shp_enabled && isZero(shp_size))
+    {
+        shp_size = ceil(accumulative_xoff / over_subscribe_ratio);
+        if (isZero(shp_size))
+        {
+            shp_size = 655360;
+        }
+    }
+
+    accumulative_occupied_buffer += shp_size;
+
+    double available_buffer = mmu_size - accumulative_occupied_buffer;
+    double pool_size = (ingress_pool_count == 1) ? available_buffer : available_buffer / 2;
+    if (pool_size > ceiling_mmu_size)
+    {
+        pool_size = ceiling_mmu_size;
+    }
+
+    bool shp_deployed = false;
+    for (auto pool : poolsNeedUpdate)
+    {
+        double effective_pool_size = pool_size;
+        if (!pool->percentage.empty())
+        {
+            double percentage = toNumber(pool->percentage);
+            if (percentage >= 0)
+            {
+                effective_pool_size = available_buffer * percentage / 100;
+            }
+        }
+        if (!isZero(shp_size) && pool->name == INGRESS_LOSSLESS_POOL_NAME)
+        {
+            result.push_back(pool->name + ":" + ceilToString(effective_pool_size) + ":" + ceilToString(shp_size));
+            shp_deployed = true;
+        }
+        else
+        {
+            result.push_back(pool->name + ":" + ceilToString(effective_pool_size));
+        }
+    }
+
+    if (!shp_deployed && !isZero(shp_size) && hasIngressLosslessPoolSize)
+    {
+        result.push_back(string(INGRESS_LOSSLESS_POOL_NAME) + ":" + ceilToString(ingress_lossless_pool_size) + ":" + ceilToString(shp_size));
+    }
+
+    result.push_back("debug:mmu_size:" + numberToString(mmu_size));
+    result.push_back("debug:accumulative size:" + numberToString(accumulative_occupied_buffer));
+    for (auto &statistic : statistics)
+    {
+        result.push_back("debug:" + statistic);
+    }
+    result.push_back("debug:extra_8lanes:" + numberToString(lossypg_reserved_8lanes - lossypg_reserved) + ":" + to_string(lossypg_8lanes) + ":" + to_string(port_count_8lanes));
+    result.push_back("debug:mgmt_pool:" + numberToString(mgmt_pool_size));
+    if (shp_enabled)
+    {
+        result.push_back("debug:accumulative_private_headroom:" + numberToString(accumulative_private_headroom));
+        result.push_back("debug:accumulative xoff:" + numberToString(accumulative_xoff));
+        result.push_back(string("debug:force enabled shp:") + (force_enable_shp ? "true" : "false"));
+    }
+    result.push_back("debug:accumulative_mgmt_pg:" + numberToString(accumulative_management_pg));
+    result.push_back("debug:egress_mirror:" + numberToString(accumulative_egress_mirror_overhead));
+    result.push_back(string("debug:shp_enabled:") + (shp_enabled ? "true" : "false"));
+    result.push_back("debug:shp_size:" + numberToString(shp_size));
+    result.push_back("debug:total port:" + to_string(total_port) + " ports with 8 lanes:" + to_string(port_count_8lanes));
+    result.push_back("debug:admin up port:" + to_string(admin_up_port) + " admin up ports with 8 lanes:" + to_string(admin_up_8lanes_port));
+    result.push_back("debug:modification_descriptors_pool_size:" + numberToString(modification_descriptors_pool_size));
+
+    return true;
+}
+
+// See buffer_headroom_barefoot.lua
+bool BarefootBufferCalculator::doCalculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom)
+{
+    static const map<long, double> pauseQuantaPerSpeed = {
+        {400000, 905}, {200000, 453}, {100000, 394}, {50000, 147},
+        {40000, 118}, {25000, 80}, {10000, 67}, {1000, 2}, {100, 1}
+    };
+
+    double cell_size, pipeline_latency, mac_phy_delay, peer_response_time = 0;
+    double lossless_mtu, small_packet_percentage;
+
+    if (input.cable_length.empty() ||
+        !getNumber(m_asicParameters, "cell_size", cell_size) ||
+        !getNumber(m_asicParameters, "pipeline_latency", pipeline_latency) ||
+        !getNumber(m_asicParameters, "mac_phy_delay", mac_phy_delay) ||
+        !getNumber(m_trafficPattern, "mtu", lossless_mtu) ||
+        !getNumber(m_trafficPattern, "small_packet_percentage", small_packet_percentage))
+    {
+        return false;
+    }
+
+    double port_speed = toNumber(input.speed);
+    double cable_length = toNumber(input.cable_length.substr(0, input.cable_length.size() - 1));
+    double port_mtu = toNumber(input.port_mtu);
+    double gearbox_delay = toNumber(input.gearbox_delay);
+
+    pipeline_latency *= 1024;
+    mac_phy_delay *= 1024;
+
+    auto pauseQuanta = pauseQuantaPerSpeed.find(static_cast<long>(port_speed));
+    if (pauseQuanta != pauseQuantaPerSpeed.end())
+    {
+        peer_response_time = pauseQuanta->second * 512 / 8;
+    }
+    else if (getNumber(m_asicParameters, "peer_response_time", peer_response_time))
+    {
+        peer_response_time *= 1024;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (isZero(port_speed - 400000))
+    {
+        peer_response_time *= 2;
+    }
+
+    double worst_case_factor;
+    if (cell_size > 2 * MINIMAL_PACKET_SIZE)
+    {
+        worst_case_factor = cell_size / MINIMAL_PACKET_SIZE;
+    }
+    else
+    {
+        worst_case_factor = (2 * cell_size) / (1 + cell_size);
+    }
+
+    double cell_occupancy = (100 - small_packet_percentage + small_packet_percentage * worst_case_factor) / 100;
+
+    double bytes_on_gearbox = isZero(gearbox_delay) ? 0 : port_speed * gearbox_delay / (8 * 1024);
+    double bytes_on_cable = 2 * cable_length * port_speed * 1000000000 / SPEED_OF_LIGHT / (8 * 1024);
+    double propagation_delay = port_mtu + bytes_on_cable + 2 * bytes_on_gearbox + mac_phy_delay + peer_response_time;
+
+    double xoff_value = ceilTo1K(lossless_mtu + propagation_delay * cell_occupancy);
+    double xon_value = ceilTo1K(pipeline_latency);
+
+    headroom.xon = ceilToString(xon_value);
+    headroom.xoff = ceilToString(xoff_value);
+    headroom.size = ceilToString(ceilTo1K(xon_value));
+    headroom.xon_offset.clear();
+
+    return true;
+}
+
+// See buffer_pool_barefoot.lua
+bool BarefootBufferCalculator::doCalculatePoolSizes(const buffer_pool_calc_input_t &input, const BufferApplDbLedger &ledger, vector<string> &result)
+{
+    double cell_size;
+    if (!getNumber(m_asicParameters, "cell_size", cell_size))
+    {
+        return false;
+    }
+
+    // 2 PPGs per port, 70% of possible maximum value
+    double ppg_headroom = 400 * cell_size;
+    double shp_size = ceil(static_cast<double>(input.ports.size()) * 2 * ppg_headroom * 0.7);
+
+    map<string, string> fixedSizes = {
+        {INGRESS_LOSSLESS_POOL_NAME, ""},
+        {"ingress_lossy_pool", ""},
+        {"egress_lossy_pool", ""}
+    };
+    for (auto &pool : input.pools)
+    {
+        auto it = fixedSizes.find(pool.name);
+        if (it != fixedSizes.end() && !pool.dynamic_size)
+        {
+            it->second = pool.configured_size;
+        }
+    }
+    for (auto &size : fixedSizes)
+    {
+        if (size.second.empty())
+        {
+            return false;
+        }
+    }
+
+    result.push_back(string(INGRESS_LOSSLESS_POOL_NAME) + ":" + fixedSizes[INGRESS_LOSSLESS_POOL_NAME] + ":" + ceilToString(shp_size));
+    result.push_back("ingress_lossy_pool:" + fixedSizes["ingress_lossy_pool"]);
+    result.push_back("egress_lossy_pool:" + fixedSizes["egress_lossy_pool"]);
+
+    return true;
+}
@@ -0,0 +1,276 @@
+#ifndef __BUFFERCALCULATOR__
+#define __BUFFERCALCULATOR__
+
+#include "dbconnector.h"
+#include "producerstatetable.h"
+#include "table.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace swss {
+
+/*
+ * In-process replacement of the buffer_headroom_<vendor>.lua and
+ * buffer_pool_<vendor>.lua plugins used by the dynamic buffer manager.
+ *
+ * The calculators are optional: every method returns false when the vendor
+ * has no native implementation or when the input is not complete enough, in
+ * which case the caller falls back to the lua plugin.
+ */
+
+// Parameters by which a headroom is calculated
+typedef struct {
+    std::string speed;
+    std::string cable_length;
+    std::string port_mtu;
+    std::string gearbox_delay;
+    long lane_count;
+    bool shp_enabled;
+} buffer_headroom_input_t;
+
+// Fields of a calculated headroom profile
+typedef struct {
+    std::string xon;
+    std::string xoff;
+    std::string xon_offset;
+    std::string size;
+} buffer_headroom_t;
+
+typedef struct {
+    std::string name;
+    bool ingress;
+    bool dynamic_size;
+    std::string configured_size;
+    std::string percentage;
+} buffer_pool_calc_pool_t;
+
+typedef struct {
+    long lane_count;
+    bool admin_up;
+} buffer_pool_calc_port_t;
+
+// Configuration by which the shared buffer pools are calculated
+typedef struct {
+    std::vector<buffer_pool_calc_pool_t> pools;
+    // key: port name, ports from CONFIG_DB.PORT
+    std::map<std::string, buffer_pool_calc_port_t> ports;
+    std::string mmu_size;
+    std::string shp_size;
+    std::string over_subscribe_ratio;
+    std::string platform;
+    // Updates of the PGs, queues or profile lists haven't been consumed by orchagent yet
+    bool updates_pending;
+} buffer_pool_calc_input_t;
+
+typedef enum {
+    BUFFER_LEDGER_PROFILE,
+    BUFFER_LEDGER_PG,
+    BUFFER_LEDGER_QUEUE,
+    BUFFER_LEDGER_INGRESS_PROFILE_LIST,
+    BUFFER_LEDGER_EGRESS_PROFILE_LIST
+} buffer_ledger_table_t;
+
+/*
+ * Mirror of the buffer profiles, PGs, queues and profile lists written to
+ * APPL_DB, with the reference counts the pool calculation needs.
+ *
+ * The counters are updated on every write so that a pool calculation walks
+ * the profiles and ports once instead of every PG and queue in APPL_DB.
+ */
+class BufferApplDbLedger
+{
+public:
+    typedef std::map<std::string, std::string> fields_t;
+    // profile name => number of PGs or queues referencing it
+    typedef std::map<std::string, long> profile_refs_t;
+
+    void set(buffer_ledger_table_t table, const std::string &key, const std::vector<FieldValueTuple> &values);
+    void del(buffer_ledger_table_t table, const std::string &key);
+
+    const std::map<std::string, fields_t> &getProfiles() const
+    {
+        return m_profiles;
+    }
+    const profile_refs_t &getObjectRefs() const
+    {
+        return m_objectRefs;
+    }
+    const std::map<std::string, profile_refs_t> &getPortObjectRefs() const
+    {
+        return m_portObjectRefs;
+    }
+    const std::map<std::string, profile_refs_t> &getPortPgRefs() const
+    {
+        return m_portPgRefs;
+    }
+    const std::map<std::string, std::vector<std::string>> &getProfileLists(bool ingress) const
+    {
+        return m_profileLists[ingress ? 0 : 1];
+    }
+
+    // Number of PGs or queues in a key like "Ethernet0:3-4", 0 for non-Ethernet ports
+    static long getObjectCount(const std::string &key, std::string &port);
+
+private:
+    struct object_ref_t
+    {
+        std::string port;
+        std::string profile;
+        long count;
+    };
+
+    std::map<std::string, fields_t> m_profiles;
+    std::map<std::string, object_ref_t> m_objects[2];
+    profile_refs_t m_objectRefs;
+    std::map<std::string, profile_refs_t> m_portObjectRefs;
+    std::map<std::string, profile_refs_t> m_portPgRefs;
+    std::map<std::string, std::vector<std::string>> m_profileLists[2];
+
+    void addObjectRef(bool pg, const object_ref_t &ref, long delta);
+};
+
+// ProducerStateTable which reports the writes to a BufferApplDbLedger
+class BufferLedgerTable : public ProducerStateTable
+{
+public:
+    BufferLedgerTable(DBConnector *db, const std::string &tableName, BufferApplDbLedger *ledger, buffer_ledger_table_t table) :
+        ProducerStateTable(db, tableName),
+        m_ledger(ledger),
+        m_table(table)
+    {
+    }
+
+    using ProducerStateTable::set;
+    using ProducerStateTable::del;
+
+    void set(const std::string &key,
+             const std::vector<FieldValueTuple> &values,
+             const std::string &op = SET_COMMAND,
+             const std::string &prefix = EMPTY_PREFIX)
+    {
+        ProducerStateTable::set(key, values, op, prefix);
+        m_ledger->set(m_table, key, values);
+    }
+
+    void del(const std::string &key,
+             const std::string &op = DEL_COMMAND,
+             const std::string &prefix = EMPTY_PREFIX)
+    {
+        ProducerStateTable::del(key, op, prefix);
+        m_ledger->del(m_table, key);
+    }
+
+private:
+    BufferApplDbLedger *m_ledger;
+    buffer_ledger_table_t m_table;
+};
+
+class BufferCalculator
+{
+public:
+    BufferCalculator(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb);
+    virtual ~BufferCalculator() = default;
+
+    // Returns the calculator of the vendor, which falls back to lua for unknown vendors
+    static std::unique_ptr<BufferCalculator> create(const std::string &vendor, DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb);
+
+    // Whether the vendor has native implementations at all
+    virtual bool isNative() const
+    {
+        return false;
+    }
+
+    // Parameters are re-read from ASIC_TABLE and LOSSLESS_TRAFFIC_PATTERN on the next calculation
+    void invalidateParameters()
+    {
+        m_parametersStale = true;
+    }
+
+    // Memoized by the input, the memo is dropped once the ASIC or traffic pattern parameters change
+    bool calculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom);
+
+    /*
+     * Calculates the shared buffer pool sizes from the ledger.
+     * Output lines follow the format of the lua plugin:
+     *     "<pool>:<size>", "ingress_lossless_pool:<size>:<xoff>" or "debug:<info>"
+     */
+    bool calculatePoolSizes(const buffer_pool_calc_input_t &input, const BufferApplDbLedger &ledger, std::vector<std::string> &result);
+
+protected:
+    typedef std::map<std::string, std::string> parameters_t;
+
+    // STATE_DB.ASIC_TABLE, only one key is expected
+    std::string m_asicKey;
+    parameters_t m_asicParameters;
+    // CONFIG_DB.LOSSLESS_TRAFFIC_PATTERN, only one key is expected
+    parameters_t m_trafficPattern;
+
+    // Returns false if the parameter does not exist or is not a number
+    static bool getNumber(const parameters_t &parameters, const std::string &field, double &value);
+    static double toNumber(const std::string &value);
+    static std::string ceilToString(double value);
+
+    /*
+     * Keeps the pool sizes in APPL_DB while the calculation can't be done,
+     * like fetch_buffer_pool_size_from_appldb in the lua plugin
+     */
+    void fetchPoolSizesFromApplDb(const buffer_pool_calc_input_t &input, bool shp_enabled, std::vector<std::string> &result);
+
+    virtual bool doCalculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom)
+    {
+        return false;
+    }
+    virtual bool doCalculatePoolSizes(const buffer_pool_calc_input_t &input, const BufferApplDbLedger &ledger, std::vector<std::string> &result)
+    {
+        return false;
+    }
+
+private:
+    typedef std::tuple<std::string, std::string, std::string, std::string, long, bool> headroom_key_t;
+
+    Table m_cfgLosslessTrafficPatternTable;
+    Table m_stateAsicTable;
+    Table m_applBufferPoolTable;
+    bool m_parametersStale;
+    std::map<headroom_key_t, buffer_headroom_t> m_headroomMemo;
+
+    void refreshParameters();
+};
+
+class MellanoxBufferCalculator : public BufferCalculator
+{
+public:
+    using BufferCalculator::BufferCalculator;
+
+    bool isNative() const override
+    {
+        return true;
+    }
+
+protected:
+    bool doCalculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom) override;
+    bool doCalculatePoolSizes(const buffer_pool_calc_input_t &input, const BufferApplDbLedger &ledger, std::vector<std::string> &result) override;
+};
+
+class BarefootBufferCalculator : public BufferCalculator
+{
+public:
+    using BufferCalculator::BufferCalculator;
+
+    bool isNative() const override
+    {
+        return true;
+    }
+
+protected:
+    bool doCalculateHeadroom(const buffer_headroom_input_t &input, buffer_headroom_t &headroom) override;
+    bool doCalculatePoolSizes(const buffer_pool_calc_input_t &input, const BufferApplDbLedger &ledger, std::vector<std::string> &result) override;
+};
+
+}
+
+#endif /* __BUFFERCALCULATOR__ */
@@ -44,10 +44,12 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_cfgDeviceMetaDataTable(cfgDb, CFG_DEVICE_METADATA_TABLE_NAME),
         m_applBufferPoolTable(applDb, APP_BUFFER_POOL_TABLE_NAME),
         m_applStateBufferPoolTable(applStateDb, APP_BUFFER_POOL_TABLE_NAME),
-        m_applBufferProfileTable(applDb, APP_BUFFER_PROFILE_TABLE_NAME),
+        m_applBufferProfileTable(applDb, APP_BUFFER_PROFILE_TABLE_NAME, &m_bufferLedger, BUFFER_LEDGER_PROFILE),
         m_applStateBufferProfileTable(applStateDb, APP_BUFFER_PROFILE_TABLE_NAME),
-        m_applBufferObjectTables{ProducerStateTable(applDb, APP_BUFFER_PG_TABLE_NAME), ProducerStateTable(applDb, APP_BUFFER_QUEUE_TABLE_NAME)},
-        m_applBufferProfileListTables{ProducerStateTable(applDb, APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME), ProducerStateTable(applDb, APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME)},
+        m_applBufferObjectTables{BufferLedgerTable(applDb, APP_BUFFER_PG_TABLE_NAME, &m_bufferLedger, BUFFER_LEDGER_PG),
+                                 BufferLedgerTable(applDb, APP_BUFFER_QUEUE_TABLE_NAME, &m_bufferLedger, BUFFER_LEDGER_QUEUE)},
+        m_applBufferProfileListTables{BufferLedgerTable(applDb, APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME, &m_bufferLedger, BUFFER_LEDGER_INGRESS_PROFILE_LIST),
+                                      BufferLedgerTable(applDb, APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME, &m_bufferLedger, BUFFER_LEDGER_EGRESS_PROFILE_LIST)},
         m_statePortTable(stateDb, STATE_PORT_TABLE_NAME),
         m_stateBufferMaximumTable(stateDb, STATE_BUFFER_MAXIMUM_VALUE_TABLE),
         m_stateBufferPoolTable(stateDb, STATE_BUFFER_POOL_TABLE_NAME),
@@ -57,6 +59,9 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_bufferPoolReady(false),
         m_bufferObjectsPending(true),
         m_bufferCompletelyInitialized(false),
+        m_sharedBufferPoolDirty(false),
+        m_sharedBufferPoolUpdateRequests(0),
+        m_sharedBufferPoolUpdatesSkipped(0),
         m_bufferProfileApplDbWritten(false),
         m_mmuSizeNumber(0),
         m_saiSyncPollIntervalSec(1)
@@ -70,6 +75,7 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_zeroPoolAndProfileInfo = *zeroProfilesInfo;
 
     string platform = getenv("ASIC_VENDOR") ? getenv("ASIC_VENDOR") : "";
+    m_bufferCalculator = BufferCalculator::create(platform, cfgDb, stateDb, applDb);
     if (platform == "")
     {
         SWSS_LOG_ERROR("Platform environment variable is not defined, buffermgrd won't start");
@@ -606,6 +612,26 @@ bool BufferMgrDynamic::needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo,
 // Meta flows which are called by main flows
 void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
 {
+    buffer_headroom_input_t input;
+    buffer_headroom_t result;
+
+    input.speed = headroom.speed;
+    input.cable_length = headroom.cable_length;
+    input.port_mtu = headroom.port_mtu;
+    input.gearbox_delay = m_identifyGearboxDelay;
+    input.lane_count = headroom.lane_count;
+    input.shp_enabled = isNonZero(m_configuredSharedHeadroomPoolSize) || isNonZero(m_overSubscribeRatio);
+
+    if (m_bufferCalculator->calculateHeadroom(input, result))
+    {
+        headroom.xon = result.xon;
+        headroom.xoff = result.xoff;
+        headroom.size = result.size;
+        if (!result.xon_offset.empty())
+            headroom.xon_offset = result.xon_offset;
+        return;
+    }
+
     // Call vendor-specific lua plugin to calculate the xon, xoff, xon_offset, size and threshold
     vector<string> keys = {};
     vector<string> argv = {};
@@ -653,6 +679,54 @@ void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
     }
 }
 
+// Calculate the pool sizes in process from the profiles and buffer objects written to APPL_DB.
+// Returns false if the lua plugin should be used instead:
+// - the vendor has no native calculator
+// - on warm reboot, until all the buffer configuration has been re-applied,
+//   because the items written by the previous instance are not in m_bufferLedger
+// - the calculator fails, e.g. the ASIC parameters are not available
+// While orchagent hasn't consumed the buffer objects, the calculator keeps the pool sizes in APPL_DB
+bool BufferMgrDynamic::calculateSharedBufferPoolNatively(vector<string> &result)
+{
+    if (!m_bufferCalculator->isNative() || (WarmStart::isWarmStart() && !m_bufferCompletelyInitialized))
+    {
+        return false;
+    }
+
+    buffer_pool_calc_input_t input;
+
+    for (auto &poolRef : m_bufferPoolLookup)
+    {
+        auto &pool = poolRef.second;
+        input.pools.push_back({poolRef.first, pool.direction == BUFFER_INGRESS, pool.dynamic_size, pool.configured_size, pool.percentage});
+    }
+
+    for (auto &portRef : m_portInfoLookup)
+    {
+        // Ports are created in the lookup by other tables as well, only ports in CONFIG_DB.PORT have lanes
+        if (portRef.second.lane_count > 0)
+        {
+            input.ports[portRef.first] = {portRef.second.lane_count, portRef.second.state != PORT_ADMIN_DOWN};
+        }
+    }
+
+    input.mmu_size = m_mmuSize;
+    input.shp_size = m_configuredSharedHeadroomPoolSize;
+    input.over_subscribe_ratio = m_overSubscribeRatio;
+    input.platform = m_specific_platform;
+    input.updates_pending = false;
+    for (int dir = BUFFER_INGRESS; dir < BUFFER_DIR_MAX; dir++)
+    {
+        // Deleted keys are put into the key set as well
+        if (m_applBufferObjectTables[dir].count() > 0 || m_applBufferProfileListTables[dir].count() > 0)
+        {
+            input.updates_pending = true;
+        }
+    }
+
+    return m_bufferCalculator->calculatePoolSizes(input, m_bufferLedger, result);
+}
+
 // This function is designed to fetch the sizes of shared buffer pool and shared headroom pool
 // and programe them to APPL_DB if they differ from the current value.
 // The function is called periodically:
@@ -663,6 +737,9 @@ void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
 // 3. Program to APPL_DB.BUFFER_POOL_TABLE only if its sizes differ from the stored value
 void BufferMgrDynamic::recalculateSharedBufferPool()
 {
+    // Anything scheduled so far is covered by this calculation
+    m_sharedBufferPoolDirty = false;
+
     try
     {
         vector<string> keys = {};
@@ -696,7 +773,11 @@ void BufferMgrDynamic::recalculateSharedBufferPool()
             }
         }
 
-        auto ret = runRedisScript(*m_applDb, m_bufferpoolSha, keys, argv);
+        vector<string> ret;
+        if (!calculateSharedBufferPoolNatively(ret))
+        {
+            ret = runRedisScript(*m_applDb, m_bufferpoolSha, keys, argv);
+        }
 
         // The format of the result:
         // a list of lines containing key, value pairs with colon as separator
@@ -872,6 +953,31 @@ void BufferMgrDynamic::checkSharedBufferPoolSize(bool force_update_during_initia
     }
 }
 
+// Defer updating the shared buffer pool size to the end of the drain.
+// A config reload or a burst of port updates changes headroom on many ports in one drain,
+// which would otherwise recalculate the pools and push the intermediate sizes to APPL_DB for each of them.
+void BufferMgrDynamic::scheduleSharedBufferPoolUpdate()
+{
+    m_sharedBufferPoolUpdateRequests++;
+    m_sharedBufferPoolDirty = true;
+}
+
+void BufferMgrDynamic::flushSharedBufferPoolUpdate()
+{
+    if (m_sharedBufferPoolUpdateRequests > 1)
+    {
+        m_sharedBufferPoolUpdatesSkipped += m_sharedBufferPoolUpdateRequests - 1;
+        SWSS_LOG_INFO("Coalesced %lu shared buffer pool updates into one, %lu skipped in total",
+                      m_sharedBufferPoolUpdateRequests, m_sharedBufferPoolUpdatesSkipped);
+    }
+    m_sharedBufferPoolUpdateRequests = 0;
+
+    if (m_sharedBufferPoolDirty)
+    {
+        checkSharedBufferPoolSize();
+    }
+}
+
 // For buffer pool, only size can be updated on-the-fly
 void BufferMgrDynamic::updateBufferPoolToDb(const string &name, const buffer_pool_t &pool)
 {
@@ -1575,7 +1681,7 @@ task_process_status BufferMgrDynamic::refreshPgsForPort(const string &port, cons
 
     if (isHeadroomUpdated)
     {
-        checkSharedBufferPoolSize();
+        scheduleSharedBufferPoolUpdate();
     }
     else
     {
@@ -1779,7 +1885,7 @@ task_process_status BufferMgrDynamic::doRemovePgTask(const string &pg_key, const
     SWSS_LOG_NOTICE("Remove BUFFER_PG %s (profile %s, %s)", pg_key.c_str(), bufferPg.running_profile_name.c_str(), bufferPg.configured_profile_name.c_str());
 
     // Recalculate pool size
-    checkSharedBufferPoolSize();
+    scheduleSharedBufferPoolUpdate();
 
     if (portInfo.state != PORT_ADMIN_DOWN)
     {
@@ -1832,7 +1938,7 @@ task_process_status BufferMgrDynamic::doUpdateBufferProfileForDynamicTh(buffer_p
         }
     }
 
-    checkSharedBufferPoolSize();
+    scheduleSharedBufferPoolUpdate();
 
     return task_process_status::task_success;
 }
@@ -1868,7 +1974,7 @@ task_process_status BufferMgrDynamic::doUpdateBufferProfileForSize(buffer_profil
     }
 
     if (update_pool_size)
-        checkSharedBufferPoolSize();
+        scheduleSharedBufferPoolUpdate();
 
     return task_process_status::task_success;
 }
@@ -2506,7 +2612,7 @@ task_process_status BufferMgrDynamic::handlePortTable(KeyOpFieldsValuesTuple &tu
                 {
                     reclaimReservedBufferForPort(port, m_portPgLookup, BUFFER_PG);
                     reclaimReservedBufferForPort(port, m_portQueueLookup, BUFFER_QUEUE);
-                    checkSharedBufferPoolSize();
+                    scheduleSharedBufferPoolUpdate();
                 }
                 else
                 {
@@ -2575,6 +2681,8 @@ task_process_status BufferMgrDynamic::handleBufferPoolTable(KeyOpFieldsValuesTup
         string newSHPSize = "0";
 
         bufferPool.dynamic_size = true;
+        bufferPool.configured_size.clear();
+        bufferPool.percentage.clear();
         for (auto i = kfvFieldsValues(tuple).begin(); i != kfvFieldsValues(tuple).end(); i++)
         {
             string &field = fvField(*i);
@@ -2584,6 +2692,11 @@ task_process_status BufferMgrDynamic::handleBufferPoolTable(KeyOpFieldsValuesTup
             if (field == buffer_size_field_name)
             {
                 bufferPool.dynamic_size = false;
+                bufferPool.configured_size = value;
+            }
+            else if (field == "percentage")
+            {
+                bufferPool.percentage = value;
             }
             else if (field == buffer_pool_xoff_field_name)
             {
@@ -3419,7 +3532,7 @@ task_process_status BufferMgrDynamic::handleSingleBufferPortProfileListEntry(con
     const string &port = key;
     const string &op = kfvOp(tuple);
     const string &tableName = dir == BUFFER_INGRESS ? APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME : APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME;
-    ProducerStateTable &appTable = m_applBufferProfileListTables[dir];
+    auto &appTable = m_applBufferProfileListTables[dir];
     port_profile_list_lookup_t &profileListLookup = m_portProfileListLookups[dir];
 
     if (op == SET_COMMAND)
@@ -3612,6 +3725,7 @@ task_process_status BufferMgrDynamic::handleBufferPortEgressProfileListTable(Key
 void BufferMgrDynamic::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
+    m_bufferCalculator->invalidateParameters();
     string table_name = consumer.getTableName();
     auto it = consumer.m_toSync.begin();
 
@@ -3645,6 +3759,8 @@ void BufferMgrDynamic::doTask(Consumer &consumer)
                 break;
         }
     }
+
+    flushSharedBufferPoolUpdate();
 }
 
 /*
@@ -3828,9 +3944,14 @@ void BufferMgrDynamic::cleanUpItemsForReclaimingBuffer(const string &port)
 
 void BufferMgrDynamic::doTask(SelectableTimer &timer)
 {
+    m_bufferCalculator->invalidateParameters();
+    m_sharedBufferPoolUpdateRequests = 0;
     checkSharedBufferPoolSize(true);
     if (!m_bufferCompletelyInitialized)
     {
         handlePendingBufferObjects();
     }
+
+    // Pool updates scheduled by the pending objects, or left pending until the buffer is initialized
+    flushSharedBufferPoolUpdate();
 }
@@ -4,9 +4,11 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "buffercalculator.h"
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -32,6 +34,9 @@ typedef struct {
     std::string mode;
     std::string xoff;
     std::string zero_profile_name;
+    // CONFIG_DB fields, for the native buffer calculator
+    std::string configured_size;
+    std::string percentage;
 } buffer_pool_t;
 
 // State of the profile.
@@ -179,6 +184,11 @@ private:
     bool m_bufferObjectsPending;
     bool m_bufferCompletelyInitialized;
 
+    // Shared buffer pool updates scheduled in the current drain, flushed at its end
+    bool m_sharedBufferPoolDirty;
+    unsigned long m_sharedBufferPoolUpdateRequests;
+    unsigned long m_sharedBufferPoolUpdatesSkipped;
+
     std::string m_configuredSharedHeadroomPoolSize;
 
     DBConnector *m_applDb = nullptr;
@@ -205,6 +215,9 @@ private:
     std::set<std::string> m_pendingSupportedButNotConfiguredPorts[BUFFER_DIR_MAX];
     int m_waitApplyAdditionalZeroProfiles;
 
+    // Mirror of the profiles and buffer objects in APPL_DB for the native pool calculation
+    BufferApplDbLedger m_bufferLedger;
+
     // BUFFER_POOL table and cache
     ProducerStateTable m_applBufferPoolTable;
     Table m_applStateBufferPoolTable;
@@ -212,7 +225,7 @@ private:
     buffer_pool_lookup_t m_bufferPoolLookup;
 
     // BUFFER_PROFILE table and caches
-    ProducerStateTable m_applBufferProfileTable;
+    BufferLedgerTable m_applBufferProfileTable;
     Table m_applStateBufferProfileTable;
     Table m_stateBufferProfileTable;
     bool m_bufferProfileApplDbWritten;
@@ -223,7 +236,7 @@ private:
     buffer_profile_lookup_t m_bufferProfileLookup;
 
     // BUFFER_PG table and caches
-    ProducerStateTable m_applBufferObjectTables[BUFFER_DIR_MAX];
+    BufferLedgerTable m_applBufferObjectTables[BUFFER_DIR_MAX];
     // m_portPgLookup - the cache for CFG_BUFFER_PG and APPL_BUFFER_PG
     // 1st level key: port name, 2nd level key: PGs
     // Updated in:
@@ -237,7 +250,7 @@ private:
     port_object_lookup_t m_portQueueLookup;
 
     // BUFFER_INGRESS_PROFILE_LIST/BUFFER_EGRESS_PROFILE_LIST table and caches
-    ProducerStateTable m_applBufferProfileListTables[BUFFER_DIR_MAX];
+    BufferLedgerTable m_applBufferProfileListTables[BUFFER_DIR_MAX];
     port_profile_list_lookup_t m_portProfileListLookups[BUFFER_DIR_MAX];
 
     //  table and caches
@@ -261,6 +274,10 @@ private:
     std::string m_bufferpoolSha;
     std::string m_checkHeadroomSha;
 
+    // Native implementation of the lua plugins above, which are the fallback
+    // when the vendor has no native calculator or it fails
+    std::unique_ptr<BufferCalculator> m_bufferCalculator;
+
     // Parameters for headroom generation
     std::string m_mmuSize;
     unsigned long m_mmuSizeNumber;
@@ -302,7 +319,10 @@ private:
     bool needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo, std::string &portName);
     void calculateHeadroomSize(buffer_profile_t &headroom);
     void checkSharedBufferPoolSize(bool force_update_during_initialization);
+    void scheduleSharedBufferPoolUpdate();
+    void flushSharedBufferPoolUpdate();
     void recalculateSharedBufferPool();
+    bool calculateSharedBufferPoolNatively(std::vector<std::string> &result);
     task_process_status allocateProfile(const std::string &speed, const std::string &cable, const std::string &mtu, const std::string &threshold, const std::string &gearbox_model, long lane_count, std::string &profile_name);
     void releaseProfile(const std::string &profile_name);
     bool isHeadroomResourceValid(const std::string &port, const buffer_profile_t &profile, const std::string &new_pg);
@@ -88,9 +88,12 @@ void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
     string          ipPrefixStr = ipPrefix.to_string();
     string          broadcastIpStr = ipPrefix.getBroadcastIp().to_string();
     int             prefixLen = ipPrefix.getMaskLength();
+    bool            broadcast = false;
+    uint32_t        metricValue = 0;
 
     if (ipPrefix.isV4())
     {
+        broadcast = (prefixLen < 31);
         (prefixLen < 31) ?
         (cmd << IP_CMD << " address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " broadcast " << shellquote(broadcastIpStr) <<" dev " << shellquote(alias)) :
         (cmd << IP_CMD << " address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " dev " << shellquote(alias));
@@ -108,6 +111,7 @@ void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
         if(mySwitchType == "voq")
         {
            metric = " metric 256";
+           metricValue = 256;
         }
 
         (prefixLen < 127) ?
@@ -116,7 +120,19 @@ void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
         (cmd << IP_CMD << " -6 address " << shellquote(opCmd) << " " << shellquote(ipPrefixStr) << " dev " << shellquote(alias) << metric);
     }
 
-    int ret = swss::exec(cmd.str(), res);
+    auto queueIp = [&]() {
+        if (opCmd == "add")
+        {
+            m_rtnl.addrAdd(alias, ipPrefix, broadcast, metricValue);
+        }
+        else
+        {
+            m_rtnl.addrDel(alias, ipPrefix);
+        }
+    };
+
+    queueIp();
+    int ret = m_rtnl.exec(cmd.str(), res);
     if (ret)
     {
         if (!ipPrefix.isV4() && opCmd == "add")
@@ -127,7 +143,8 @@ void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
                 SWSS_LOG_ERROR("Failed to enable IPv6 on interface %s", alias.c_str());
                 return;
             }
-            ret = swss::exec(cmd.str(), res);
+            queueIp();
+            ret = m_rtnl.exec(cmd.str(), res);
         }
 
         if (ret)
@@ -186,7 +203,19 @@ void IntfMgr::setIntfMac(const string &alias, const string &mac_str)
 
     cmd << IP_CMD << " link set " << alias << " address " << mac_str;
 
-    int ret = swss::exec(cmd.str(), res);
+    if (m_rtnl.isEnabled())
+    {
+        try
+        {
+            m_rtnl.linkSetAddress(alias, MacAddress(mac_str));
+        }
+        catch (const std::invalid_argument &)
+        {
+            SWSS_LOG_ERROR("Command '%s' failed: invalid MAC address", cmd.str().c_str());
+            return;
+        }
+    }
+    int ret = m_rtnl.exec(cmd.str(), res);
     if (ret)
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
@@ -206,7 +235,8 @@ void IntfMgr::setIntfVrf(const string &alias, const string &vrfName)
     {
         cmd << IP_CMD << " link set " << shellquote(alias) << " nomaster";
     }
-    int ret = swss::exec(cmd.str(), res);
+    m_rtnl.linkSetMaster(alias, vrfName);
+    int ret = m_rtnl.exec(cmd.str(), res);
     if (ret)
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
@@ -254,7 +284,8 @@ void IntfMgr::setIntfState(const string &alias, bool isUp)
         cmd << IP_CMD << " link set " << shellquote(alias) << " down";
     }
 
-    int ret = swss::exec(cmd.str(), res);
+    m_rtnl.linkSetAdminState(alias, isUp);
+    int ret = m_rtnl.exec(cmd.str(), res);
     if (ret)
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
@@ -402,7 +433,18 @@ void IntfMgr::addHostSubIntf(const string&intf, const string &subIntf, const str
     string res;
 
     cmd << IP_CMD " link add link " << shellquote(intf) << " name " << shellquote(subIntf) << " type vlan id " << shellquote(vlan);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    if (m_rtnl.isEnabled())
+    {
+        try
+        {
+            m_rtnl.linkAddVlan(intf, subIntf, static_cast<uint16_t>(stoul(vlan)));
+        }
+        catch (const std::logic_error &)
+        {
+            throw runtime_error(cmd.str() + " : invalid vlan id");
+        }
+    }
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmd.str(), res);
 }
 
 
@@ -514,7 +556,8 @@ std::string IntfMgr::setHostSubIntfMtu(const string &alias, const string &mtu, c
     SWSS_LOG_INFO("subintf %s active mtu: %s", alias.c_str(), subifMtu.c_str());
     cmd << IP_CMD " link set " << shellquote(alias) << " mtu " << shellquote(subifMtu);
     std::string cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
+    m_rtnl.linkSetMtu(alias, subifMtu);
+    int ret = m_rtnl.exec(cmd_str, res);
 
     if (ret && !isIntfStateOk(alias))
     {
@@ -562,7 +605,8 @@ bool IntfMgr::setIntfAdminStatus(const string &alias, const string &admin_status
     SWSS_LOG_INFO("intf %s admin_status: %s", alias.c_str(), admin_status.c_str());
     cmd << IP_CMD " link set " << shellquote(alias) << " " << shellquote(admin_status);
     cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
+    m_rtnl.linkSetAdminState(alias, admin_status == "up");
+    int ret = m_rtnl.exec(cmd_str, res);
     if (ret && !isIntfStateOk(alias))
     {
         // Can happen when a DEL notification is sent by portmgrd immediately followed by a new SET notification
@@ -604,7 +648,8 @@ void IntfMgr::removeHostSubIntf(const string &subIntf)
     string res;
 
     cmd << IP_CMD " link del " << shellquote(subIntf);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_rtnl.linkDel(subIntf);
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmd.str(), res);
 }
 
 void IntfMgr::setSubIntfStateOk(const string &alias)
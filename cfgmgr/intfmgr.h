@@ -3,6 +3,7 @@
 
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "rtnlhelper.h"
 #include "orch.h"
 
 #include <map>
@@ -34,6 +35,7 @@ private:
     Table m_statePortTable, m_stateLagTable, m_stateVlanTable, m_stateVrfTable, m_stateIntfTable, m_appLagTable;
 
     Table m_neighTable;
+    RtnlHelper m_rtnl;
 
     SubIntfMap m_subIntfList;
     SagIntfMap m_sagIntfList;
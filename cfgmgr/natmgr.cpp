@@ -27,6 +27,8 @@
 #include "ipaddress.h"
 #include "ipprefix.h"
 #include "notifier.h"
+#include <stdlib.h>
+#include <errno.h>
 
 using namespace std;
 using namespace swss;
@@ -64,6 +66,9 @@ NatMgr::NatMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, con
     /* Set NAT default udp timeout as 300 seconds */
     m_natUdpTimeout = NAT_UDP_TIMEOUT_DEFAULT;
 
+    /* Run the iptables commands one at a time until a drain starts batching them */
+    m_iptablesBatching = false;
+
     /* Start the timer to refresh static conntrack entries for every 1 day (86400) */
     SWSS_LOG_INFO("Start the NAT Refresh Timer ");
     auto refresh_interval      = timespec { .tv_sec = NAT_ENTRY_REFRESH_PERIOD, .tv_nsec = 0 };
@@ -357,9 +362,9 @@ void NatMgr::flushAllNatEntries(void)
 {
     std::string res;
     const std::string cmds = std::string("") + CONNTRACK_CMD + FLUSH;
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -377,9 +382,9 @@ void NatMgr::updateDynamicSingleNatConnTrackTimeout(string key, int timeout)
     IpAddress   ip_address = IpAddress(key);
 
     cmds += (" -U -s " + ip_address.to_string() + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -401,9 +406,9 @@ void NatMgr::updateDynamicSingleNaptConnTrackTimeout(string key, int timeout)
     std::string     cmds = std::string("") + CONNTRACK_CMD;
     
     cmds += (" -U -s " + ip_address.to_string() + " -p " + prototype + " --orig-port-src " + to_string(l4_port) + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -425,7 +430,7 @@ void NatMgr::updateDynamicTwiceNatConnTrackTimeout(string key, int timeout)
 
     cmd += (" -U -s " + src_ip.to_string() + " -d " + dst_ip.to_string() + " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmd, res);
+    execConntrackCmds(cmd, res);
 
     SWSS_LOG_INFO("Updated active Twice NAT conntrack entry with src-ip %s, dst-ip %s, timeout %u",
                   src_ip.to_string().c_str(), dst_ip.to_string().c_str(), timeout);
@@ -447,7 +452,7 @@ void NatMgr::updateDynamicTwiceNaptConnTrackTimeout(string key, int timeout)
             " -d " + dst_ip.to_string() + " --orig-port-dst " + std::to_string(dst_l4_port) +
             " -t " + std::to_string(timeout) + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmd, res);
+    execConntrackCmds(cmd, res);
 
     SWSS_LOG_INFO("Updated active Twice NAPT conntrack entry with protocol %s, src-ip %s, src-port %d, dst-ip %s, dst-port %d, timeout %u",
                   prototype.c_str(), src_ip.to_string().c_str(), src_l4_port, dst_ip.to_string().c_str(), dst_l4_port, timeout);
@@ -476,9 +481,9 @@ void NatMgr::addConntrackStaticSingleNatEntry(const string &key)
                  " --src " + key + " --sport 1 --dst 127.0.0.1 --dport 127 -u ASSURED " + REDIRECT_TO_DEV_NULL);
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -501,9 +506,9 @@ void NatMgr::addConntrackStaticTwiceNatEntry(const string &snatKey, const string
              +  " -p udp" + " -t " + to_string(timeout) + " --src " + snatKey + " --sport 1" + " --dst " + dnatKey
              +  " --dport 1" + " -u ASSURED " + REDIRECT_TO_DEV_NULL);
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -551,9 +556,9 @@ void NatMgr::addConntrackStaticSingleNaptEntry(const string &key)
                  " --src " + keys[0] + " --sport " + keys[2] + " --dst 127.0.0.1 --dport 127 -u ASSURED " +  state + REDIRECT_TO_DEV_NULL);
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -590,9 +595,9 @@ void NatMgr::addConntrackStaticTwiceNaptEntry(const string &snatKey, const strin
              + " --src " + snatKeys[0] + " --sport " + snatKeys[2] + " --dst " + dnatKeys[0] + " --dport " + dnatKeys[2] + " -u ASSURED " 
              +  state + REDIRECT_TO_DEV_NULL);
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -623,7 +628,7 @@ void NatMgr::updateConntrackStaticSingleNatEntry(const string &key)
         cmds += (" -U --src " + key + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
     }
 
-    swss::exec(cmds, res);
+    execConntrackCmds(cmds, res);
 }
 
 /* To Update a dummy conntrack entry for the Static Twice NAT entry in the kernel */
@@ -637,7 +642,7 @@ void NatMgr::updateConntrackStaticTwiceNatEntry(const string &snatKey, const str
    
     cmds += (" -U --src " + snatKey + " -p udp -t " + to_string(timeout) + " --dst " + dnatKey + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmds, res);
+    execConntrackCmds(cmds, res);
 }
 
 /* To update a dummy conntrack entry for the Static NAPT entry in the kernel */
@@ -673,7 +678,7 @@ void NatMgr::updateConntrackStaticSingleNaptEntry(const string &key)
         cmds += (" -U --src " + keys[0] + " -p " + prototype + " --sport " + keys[2] + " -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
     }
 
-    swss::exec(cmds, res);
+    execConntrackCmds(cmds, res);
 }
 
 /* To Update a dummy conntrack entry for the Static Twice NAPT entry in the kernel */
@@ -699,7 +704,7 @@ void NatMgr::updateConntrackStaticTwiceNaptEntry(const string &snatKey, const st
     cmds += (" -U --src " + snatKeys[0] + " --dst " + dnatKeys[0] + " -p udp " + " --sport " + snatKeys[2] + " --dport " + dnatKeys[2]
              + " -p udp -t " + to_string(timeout) + REDIRECT_TO_DEV_NULL);
 
-    swss::exec(cmds, res);
+    execConntrackCmds(cmds, res);
 }
 
 /* To Delete conntrack entry for Static Single NAT entry */
@@ -720,9 +725,9 @@ void NatMgr::deleteConntrackStaticSingleNatEntry(const string &key)
         cmds += (" -D -s " + key + " -p udp" + REDIRECT_TO_DEV_NULL);
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -741,9 +746,9 @@ void NatMgr::deleteConntrackStaticTwiceNatEntry(const string &snatKey, const str
 
     cmds += (" -D -s " + snatKey + " -d " + dnatKey + REDIRECT_TO_DEV_NULL);
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -783,9 +788,9 @@ void NatMgr::deleteConntrackStaticSingleNaptEntry(const string &key)
         cmds += (" -D -s " + keys[0] + " -p " + prototype + " --sport " + keys[2] + REDIRECT_TO_DEV_NULL);
     }
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -816,9 +821,9 @@ void NatMgr::deleteConntrackStaticTwiceNaptEntry(const string &snatKey, const st
 
     cmds += (" -D -s " + snatKeys[0] + " -p " + prototype + " --orig-port-src " + snatKeys[2] + " -d " + dnatKeys[0] + " --orig-port-dst " + dnatKeys[2] + REDIRECT_TO_DEV_NULL);
 
-    int ret = swss::exec(cmds, res);
+    int ret = execConntrackCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != CONNTRACK_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
     }
@@ -868,9 +873,9 @@ void NatMgr::deleteConntrackDynamicEntries(const string &ip_range)
 
         cmds = (std::string("") + CONNTRACK_CMD + " -D -q " + ipAddrString + REDIRECT_TO_DEV_NULL);
 
-        int ret = swss::exec(cmds, res);
+        int ret = execConntrackCmds(cmds, res);
 
-        if (ret)
+        if (ret && (ret != CONNTRACK_CMDS_QUEUED))
         {
             SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
         }
@@ -881,6 +886,260 @@ void NatMgr::deleteConntrackDynamicEntries(const string &ip_range)
     }
 }
 
+/* To start queueing the iptables rules instead of running them one command at a time */
+void NatMgr::beginIptablesBatch(void)
+{
+    m_iptablesBatching = true;
+
+    /* Retry the rules the previous batches failed to apply */
+    for (auto &rule : m_failedIptablesRules)
+    {
+        m_pendingIptablesRules[rule.first.first].push_back(rule.first.second);
+    }
+}
+
+/*
+ * To apply the queued iptables rules, then run the queued conntrack commands, and stop queueing.
+ * Returns false if any of them failed.
+ */
+bool NatMgr::commitIptablesBatch(void)
+{
+    std::string res;
+    bool ret;
+
+    m_iptablesBatching = false;
+    ret = flushIptablesRules();
+
+    auto pendingCmds = std::move(m_pendingConntrackCmds);
+    m_pendingConntrackCmds.clear();
+
+    for (auto &cmds : pendingCmds)
+    {
+        int rc = swss::exec(cmds, res);
+        if (rc)
+        {
+            SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), rc);
+            ret = false;
+        }
+    }
+
+    return ret;
+}
+
+/* To split an "iptables -t <table> <rule> && ..." command into iptables-restore lines per table */
+bool NatMgr::parseIptablesCmds(const string &cmds, vector<pair<string, string>> &rules)
+{
+    const std::string separator = " && ";
+    const std::string prefix    = std::string(IPTABLES_CMD) + " -t ";
+    size_t start = 0;
+
+    /* Anything the shell would interpret has no meaning for iptables-restore */
+    if (cmds.find_first_of("\"'`$|;<>\\\n") != string::npos)
+    {
+        return false;
+    }
+
+    while (start <= cmds.size())
+    {
+        size_t end = cmds.find(separator, start);
+        if (end == string::npos)
+        {
+            end = cmds.size();
+        }
+
+        std::string cmd = cmds.substr(start, end - start);
+        size_t first = cmd.find_first_not_of(' ');
+        if ((first == string::npos) or (cmd.compare(first, prefix.size(), prefix) != 0))
+        {
+            return false;
+        }
+
+        size_t tableStart = cmd.find_first_not_of(' ', first + prefix.size());
+        size_t tableEnd   = (tableStart == string::npos) ? string::npos : cmd.find(' ', tableStart);
+        if (tableEnd == string::npos)
+        {
+            return false;
+        }
+
+        size_t ruleStart = cmd.find_first_not_of(' ', tableEnd);
+        if (ruleStart == string::npos)
+        {
+            return false;
+        }
+
+        rules.emplace_back(cmd.substr(tableStart, tableEnd - tableStart), cmd.substr(ruleStart));
+        start = end + separator.size();
+    }
+
+    return !rules.empty();
+}
+
+/*
+ * To run or, while batching, queue the iptables commands.
+ * Returns the swss::exec() rc, or IPTABLES_CMDS_QUEUED when the commands are
+ * queued: a queued rule that fails is reported when the batch is applied,
+ * and queued again by the next batches up to IPTABLES_RULE_RETRY_MAX times.
+ */
+int NatMgr::execIptablesCmds(const string &cmds, string &res)
+{
+    vector<pair<string, string>> rules;
+
+    if (!m_iptablesBatching)
+    {
+        return swss::exec(cmds, res);
+    }
+
+    if (!parseIptablesCmds(cmds, rules))
+    {
+        /* Keep the ordering with the queued rules */
+        flushIptablesRules();
+        return swss::exec(cmds, res);
+    }
+
+    for (auto &rule : rules)
+    {
+        m_pendingIptablesRules[rule.first].push_back(rule.second);
+    }
+
+    SWSS_LOG_INFO("Queued command '%s'", cmds.c_str());
+
+    return IPTABLES_CMDS_QUEUED;
+}
+
+/*
+ * To run or, while batching, queue the conntrack commands.
+ * The queued commands run once the batch of iptables rules they may depend on
+ * is applied; returns CONNTRACK_CMDS_QUEUED for them.
+ */
+int NatMgr::execConntrackCmds(const string &cmds, string &res)
+{
+    if (!m_iptablesBatching)
+    {
+        return swss::exec(cmds, res);
+    }
+
+    m_pendingConntrackCmds.push_back(cmds);
+
+    SWSS_LOG_INFO("Queued command '%s'", cmds.c_str());
+
+    return CONNTRACK_CMDS_QUEUED;
+}
+
+/* To apply the rules of one iptables table in a single iptables-restore transaction */
+bool NatMgr::restoreIptablesTable(const string &table, const vector<string> &rules)
+{
+    std::string res, input;
+    char path[] = "/tmp/natmgrd-iptables.XXXXXX";
+    int ret = -1;
+
+    input = "*" + table + "\n";
+    for (auto &rule : rules)
+    {
+        input += rule + "\n";
+    }
+    input += "COMMIT\n";
+
+    int fd = mkstemp(path);
+    if (fd < 0)
+    {
+        SWSS_LOG_ERROR("Failed to create iptables-restore input file, errno %d", errno);
+        return false;
+    }
+
+    size_t written = 0;
+    while (written < input.size())
+    {
+        ssize_t n = write(fd, input.data() + written, input.size() - written);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+        written += static_cast<size_t>(n);
+    }
+    close(fd);
+
+    if (written == input.size())
+    {
+        const std::string cmd = std::string("") + IPTABLES_RESTORE_CMD + " --noflush < " + path;
+        ret = swss::exec(cmd, res);
+        if (ret)
+        {
+            SWSS_LOG_WARN("Command '%s' failed with rc %d for %zu %s rules", cmd.c_str(), ret, rules.size(), table.c_str());
+        }
+    }
+    unlink(path);
+
+    return !ret;
+}
+
+/*
+ * To apply the queued iptables rules with one iptables-restore transaction per table.
+ * Returns false if any of the queued rules failed.
+ */
+bool NatMgr::flushIptablesRules(void)
+{
+    std::string res;
+    size_t failed = 0;
+
+    if (m_pendingIptablesRules.empty())
+    {
+        return true;
+    }
+
+    /* Take the queue first, so that it is not left behind if a command throws */
+    auto pendingRules = std::move(m_pendingIptablesRules);
+    m_pendingIptablesRules.clear();
+
+    for (auto &table : pendingRules)
+    {
+        if (restoreIptablesTable(table.first, table.second))
+        {
+            SWSS_LOG_INFO("Applied %zu %s iptables rules with iptables-restore", table.second.size(), table.first.c_str());
+            for (auto &rule : table.second)
+            {
+                m_failedIptablesRules.erase(make_pair(table.first, rule));
+            }
+            continue;
+        }
+
+        /* iptables-restore is all or nothing, so one bad rule fails the whole table */
+        for (auto &rule : table.second)
+        {
+            const std::string cmd = std::string("") + IPTABLES_CMD + " -t " + table.first + " " + rule;
+            auto key = make_pair(table.first, rule);
+            int ret = swss::exec(cmd, res);
+            if (!ret)
+            {
+                m_failedIptablesRules.erase(key);
+                continue;
+            }
+
+            failed++;
+            if (++m_failedIptablesRules[key] < IPTABLES_RULE_RETRY_MAX)
+            {
+                SWSS_LOG_ERROR("Command '%s' failed with rc %d, retrying it with the next batch", cmd.c_str(), ret);
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Command '%s' failed with rc %d, giving up after %d batches", cmd.c_str(), ret, IPTABLES_RULE_RETRY_MAX);
+                m_failedIptablesRules.erase(key);
+            }
+        }
+    }
+
+    if (failed)
+    {
+        SWSS_LOG_ERROR("Failed to apply %zu queued iptables rules", failed);
+        return false;
+    }
+
+    return true;
+}
+
 /* Iptable rules are added in the mangles table, to support use of Loopback IP as NAT Public IP which is a typical use-case in DC scenarios. The way it works is that:
  *
  * *	The mangle table rules are processed first before the nat table rules.
@@ -912,9 +1171,9 @@ bool NatMgr::setMangleIptablesRules(const string &opCmd, const string &interface
           + IPTABLES_CMD + " -t mangle " + "-" + opCmd + " PREROUTING -i " + interface + " -j MARK --set-mark " + nat_zone + " && "
           + IPTABLES_CMD + " -t mangle " + "-" + opCmd + " POSTROUTING -o " + interface + " -j MARK --set-mark " + nat_zone ;
 
-    ret = swss::exec(cmds, res);
+    ret = execIptablesCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != IPTABLES_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
         return false;
@@ -937,9 +1196,9 @@ bool NatMgr::setFullConeDnatIptablesRule(const string &opCmd)
     const std::string cmds = std::string("")
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING " + " -j DNAT --to-destination 1.1.1.1 --fullcone";
         
-    ret = swss::exec(cmds, res);
+    ret = execIptablesCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != IPTABLES_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
         return false;
@@ -968,9 +1227,9 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING " + markStr + " -j DNAT -d " + external_ip + " --to-destination " + internal_ip + " && "
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -j SNAT -s " + internal_ip + " --to-source " + external_ip ;
         
-        ret = swss::exec(cmds, res);
+        ret = execIptablesCmds(cmds, res);
 
-        if (ret)
+        if (ret && (ret != IPTABLES_CMDS_QUEUED))
         {
             SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
             return false;
@@ -982,9 +1241,9 @@ bool NatMgr::setStaticNatIptablesRules(const string &opCmd, const string &interf
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " PREROUTING" + " -j DNAT -d " + internal_ip + " --to-destination " + external_ip + " && "
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING" + " -j SNAT -s " + external_ip + " --to-source " + internal_ip ;
 
-        ret = swss::exec(cmds, res);
+        ret = execIptablesCmds(cmds, res);
 
-        if (ret)
+        if (ret && (ret != IPTABLES_CMDS_QUEUED))
         {
             SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
             return false;
@@ -1018,9 +1277,9 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -p " + prototype + " -j SNAT -s " + internal_ip + " --sport " + internal_port + " --to-source " 
           + external_ip + ":" + external_port;
 
-        ret = swss::exec(cmds, res);
+        ret = execIptablesCmds(cmds, res);
 
-        if (ret)
+        if (ret && (ret != IPTABLES_CMDS_QUEUED))
         {
             SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
             return false;
@@ -1034,9 +1293,9 @@ bool NatMgr::setStaticNaptIptablesRules(const string &opCmd, const string &inter
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING" + " -p " + prototype + " -j SNAT -s " + external_ip + " --sport " + external_port + " --to-source "
           + internal_ip + ":" + internal_port;
 
-        ret = swss::exec(cmds, res);
+        ret = execIptablesCmds(cmds, res);
 
-        if (ret)
+        if (ret && (ret != IPTABLES_CMDS_QUEUED))
         {
             SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
             return false;
@@ -1076,9 +1335,9 @@ bool NatMgr::setStaticTwiceNatIptablesRules(const string &opCmd, const string &i
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -j SNAT -s " + translated_dest_ip
           + " --to-source " + dest_ip + " -d " + src_ip;
 
-    ret = swss::exec(cmds, res);
+    ret = execIptablesCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != IPTABLES_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
         return false;
@@ -1122,9 +1381,9 @@ bool NatMgr::setStaticTwiceNaptIptablesRules(const string &opCmd, const string &
           + IPTABLES_CMD + " -t nat " + "-" + opCmd + " POSTROUTING " + markStr + " -p " + prototype + " -j SNAT -s " + translated_dest_ip + " --sport " + translated_dest_port
           + " --to-source " + dest_ip + ":" + dest_port + " -d " + src_ip + " --dport " +src_port;
 
-    ret = swss::exec(cmds, res);
+    ret = execIptablesCmds(cmds, res);
 
-    if (ret)
+    if (ret && (ret != IPTABLES_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
         return false;
@@ -1219,8 +1478,8 @@ bool NatMgr::setDynamicNatIptablesRulesWithoutAcl(const string &opCmd, const str
         }
     }
 
-    int ret = swss::exec(cmds, res);
-    if (ret)
+    int ret = execIptablesCmds(cmds, res);
+    if (ret && (ret != IPTABLES_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
         return false;
@@ -1448,8 +1707,8 @@ bool NatMgr::setDynamicNatIptablesRulesWithAcl(const string &opCmd, const string
         }
     }
 
-    int ret = swss::exec(cmds, res);
-    if (ret)
+    int ret = execIptablesCmds(cmds, res);
+    if (ret && (ret != IPTABLES_CMDS_QUEUED))
     {
         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmds.c_str(), ret);
         return false;
@@ -8150,6 +8409,9 @@ void NatMgr::doTask(Consumer &consumer)
 
     string table_name = consumer.getTableName();
 
+    /* Apply the iptables rules of this drain in one transaction */
+    IptablesBatchGuard iptablesBatch(*this);
+
     if (table_name == CFG_STATIC_NAT_TABLE_NAME)
     {
         SWSS_LOG_INFO("Received update from CFG_STATIC_NAT_TABLE_NAME");
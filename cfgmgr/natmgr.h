@@ -125,6 +125,9 @@ namespace swss {
 #define NAT_ENTRY_REFRESH_PERIOD   86400    // 1 day
 #define REDIRECT_TO_DEV_NULL       " &> /dev/null"
 #define FLUSH                      " -F"
+#define IPTABLES_CMDS_QUEUED       (-2)     // execIptablesCmds() rc while batching
+#define CONNTRACK_CMDS_QUEUED      (-2)     // execConntrackCmds() rc while batching
+#define IPTABLES_RULE_RETRY_MAX    3        // Batches a failed iptables rule is queued again for
 
 const char ip_address_delimiter = '/';
 
@@ -251,6 +254,8 @@ public:
     void removeStaticNatIptables(const std::string port = NONE_STRING);
     void removeStaticNaptIptables(const std::string port = NONE_STRING);
     void removeDynamicNatRules(const std::string port = NONE_STRING, const std::string ipPrefix = NONE_STRING);
+    void beginIptablesBatch(void);
+    bool commitIptablesBatch(void);
 
 private:
     /* Declare APPL_DB, CFG_DB and STATE_DB tables */
@@ -276,6 +281,16 @@ private:
     natDnatPool_map_t        m_natDnatPoolInfo;
     SelectableTimer          *m_natRefreshTimer;
 
+    /* iptables rules queued while batching per table, and the conntrack commands to run after them */
+    bool                                              m_iptablesBatching;
+    std::map<std::string, std::vector<std::string>>   m_pendingIptablesRules;
+    std::vector<std::string>                          m_pendingConntrackCmds;
+
+    /* iptables rules that failed to apply, queued again by the next batch.
+     * Key is "table" and "rule", value is the number of batches that failed it
+     */
+    std::map<std::pair<std::string, std::string>, int> m_failedIptablesRules;
+
     /* Declare doTask related functions */
     void doTask(Consumer &consumer);
     void doTask(SelectableTimer &timer);
@@ -366,6 +381,11 @@ private:
     bool isGlobalIpMatching(const std::string &intf_keys, const std::string &global_ip);
     bool getIpEnabledIntf(const std::string &global_ip, std::string &interface);
     void setNaptPoolIpTable(const std::string &opCmd, const std::string &nat_ip, const std::string &nat_port);
+    bool parseIptablesCmds(const std::string &cmds, std::vector<std::pair<std::string, std::string>> &rules);
+    int  execIptablesCmds(const std::string &cmds, std::string &res);
+    int  execConntrackCmds(const std::string &cmds, std::string &res);
+    bool flushIptablesRules(void);
+    bool restoreIptablesTable(const std::string &table, const std::vector<std::string> &rules);
     bool setFullConeDnatIptablesRule(const std::string &opCmd);
     bool setMangleIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &nat_zone);
     bool setStaticNatIptablesRules(const std::string &opCmd, const std::string &interface, const std::string &external_ip, const std::string &internal_ip, const std::string &nat_type);
@@ -383,6 +403,34 @@ private:
 
 };
 
+/* Batches the iptables rules of NatMgr for the lifetime of the object, also when an exception is thrown */
+class IptablesBatchGuard
+{
+public:
+    explicit IptablesBatchGuard(NatMgr &natMgr) : m_natMgr(natMgr)
+    {
+        m_natMgr.beginIptablesBatch();
+    }
+
+    ~IptablesBatchGuard()
+    {
+        try
+        {
+            m_natMgr.commitIptablesBatch();
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_ERROR("Failed to apply the queued iptables rules: %s", e.what());
+        }
+    }
+
+    IptablesBatchGuard(const IptablesBatchGuard &) = delete;
+    IptablesBatchGuard &operator=(const IptablesBatchGuard &) = delete;
+
+private:
+    NatMgr &m_natMgr;
+};
+
 }
 
 #endif
@@ -88,11 +88,15 @@ void cleanup()
     
     if (natmgr)
     {
-        natmgr->removeStaticNatIptables();
-        natmgr->removeStaticNaptIptables();
-        natmgr->removeDynamicNatRules();
+        {
+            IptablesBatchGuard iptablesBatch(*natmgr);
+
+            natmgr->removeStaticNatIptables();
+            natmgr->removeStaticNaptIptables();
+            natmgr->removeDynamicNatRules();
 
-        natmgr->cleanupMangleIpTables();
+            natmgr->cleanupMangleIpTables();
+        }
         natmgr->cleanupPoolIpTable();
     }
 }
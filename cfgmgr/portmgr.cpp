@@ -30,7 +30,8 @@ bool PortMgr::setPortMtu(const string &alias, const string &mtu)
     // ip link set dev <port_name> mtu <mtu>
     cmd << IP_CMD << " link set dev " << shellquote(alias) << " mtu " << shellquote(mtu);
     cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
+    m_rtnl.linkSetMtu(alias, mtu);
+    int ret = m_rtnl.exec(cmd_str, res);
     if (!ret)
     {
         // Set the port MTU in application database to update both
@@ -65,7 +66,8 @@ bool PortMgr::setPortAdminStatus(const string &alias, const bool up)
     // ip link set dev <port_name> [up|down]
     cmd << IP_CMD << " link set dev " << shellquote(alias) << (up ? " up" : " down");
     cmd_str = cmd.str();
-    int ret = swss::exec(cmd_str, res);
+    m_rtnl.linkSetAdminState(alias, up);
+    int ret = m_rtnl.exec(cmd_str, res);
     if (!ret)
     {
         return writeConfigToAppDb(alias, "admin_status", (up ? "up" : "down"));
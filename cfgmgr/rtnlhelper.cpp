@@ -0,0 +1,536 @@
+#include <string.h>
+#include <stdlib.h>
+#include <net/if.h>
+#include <net/ethernet.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <linux/rtnetlink.h>
+#include <linux/if_link.h>
+#include <linux/if_addr.h>
+#include <linux/if_bridge.h>
+#include <netlink/netlink.h>
+#include <netlink/msg.h>
+#include <netlink/attr.h>
+
+#include "logger.h"
+#include "exec.h"
+#include "rtnlhelper.h"
+
+using namespace std;
+using namespace swss;
+
+/* Requests sent before waiting for their ACKs, within the socket receive buffer */
+#define RTNL_HELPER_MAX_IN_FLIGHT   64
+
+static bool isRtnlHelperEnabled()
+{
+    const char *env = getenv(RTNL_HELPER_ENABLE_ENV);
+    return env && (string(env) == "1" || string(env) == "true");
+}
+
+/* Allocate an RTM_*LINK request; the link is looked up by ifindex, or by name if ifindex is 0 */
+static struct nl_msg *allocLinkMsg(int type, int flags, unsigned char family, int ifindex,
+                                   const string &alias, unsigned int ifi_flags = 0, unsigned int ifi_change = 0)
+{
+    struct nl_msg *msg = nlmsg_alloc_simple(type, NLM_F_REQUEST | NLM_F_ACK | flags);
+    if (!msg)
+    {
+        return nullptr;
+    }
+
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = family;
+    ifi.ifi_index = ifindex;
+    ifi.ifi_flags = ifi_flags;
+    ifi.ifi_change = ifi_change;
+
+    if (nlmsg_append(msg, &ifi, sizeof(ifi), NLMSG_ALIGNTO) < 0 ||
+        (ifindex == 0 && nla_put_string(msg, IFLA_IFNAME, alias.c_str()) < 0))
+    {
+        nlmsg_free(msg);
+        return nullptr;
+    }
+
+    return msg;
+}
+
+RtnlHelper::RtnlHelper()
+{
+    if (!isRtnlHelperEnabled())
+    {
+        return;
+    }
+
+    int err;
+    m_sock = nl_socket_alloc();
+    if (!m_sock)
+    {
+        SWSS_LOG_ERROR("Netlink socket alloc failed, using shell commands");
+        return;
+    }
+
+    if ((err = nl_connect(m_sock, NETLINK_ROUTE)) < 0)
+    {
+        SWSS_LOG_ERROR("Netlink socket connect failed, error '%s', using shell commands", nl_geterror(err));
+        nl_socket_free(m_sock);
+        m_sock = nullptr;
+        return;
+    }
+
+    SWSS_LOG_NOTICE("Using rtnetlink for link, address and bridge VLAN configuration");
+}
+
+RtnlHelper::~RtnlHelper()
+{
+    if (m_sock)
+    {
+        nl_close(m_sock);
+        nl_socket_free(m_sock);
+    }
+}
+
+void RtnlHelper::queue(const string &desc, RequestBuilder build)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    m_requests.push_back({ desc, std::move(build) });
+}
+
+void RtnlHelper::linkSetMtu(const string &alias, uint32_t mtu)
+{
+    queue("link set " + alias + " mtu " + to_string(mtu), [alias, mtu]() {
+        struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, 0, alias);
+        if (msg && nla_put_u32(msg, IFLA_MTU, mtu) < 0)
+        {
+            nlmsg_free(msg);
+            return (struct nl_msg *)nullptr;
+        }
+        return msg;
+    });
+}
+
+void RtnlHelper::linkSetMtu(const string &alias, const string &mtu)
+{
+    /* An invalid MTU is sent as 0 and rejected by the kernel, like ip would reject it */
+    uint32_t value = 0;
+    try
+    {
+        value = static_cast<uint32_t>(stoul(mtu));
+    }
+    catch (const std::exception &)
+    {
+    }
+
+    linkSetMtu(alias, value);
+}
+
+void RtnlHelper::linkSetAdminState(const string &alias, bool up)
+{
+    queue("link set " + alias + (up ? " up" : " down"), [alias, up]() {
+        return allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, 0, alias, up ? IFF_UP : 0, IFF_UP);
+    });
+}
+
+void RtnlHelper::linkSetMaster(const string &alias, const string &master)
+{
+    queue("link set " + alias + (master.empty() ? " nomaster" : " master " + master), [alias, master]() {
+        uint32_t master_index = 0;
+        if (!master.empty() && !(master_index = if_nametoindex(master.c_str())))
+        {
+            return (struct nl_msg *)nullptr;
+        }
+
+        struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, 0, alias);
+        if (msg && nla_put_u32(msg, IFLA_MASTER, master_index) < 0)
+        {
+            nlmsg_free(msg);
+            return (struct nl_msg *)nullptr;
+        }
+        return msg;
+    });
+}
+
+void RtnlHelper::linkSetAddress(const string &alias, const MacAddress &mac)
+{
+    queue("link set " + alias + " address " + mac.to_string(), [alias, mac]() {
+        struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, 0, AF_UNSPEC, 0, alias);
+        if (msg && nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, mac.getMac()) < 0)
+        {
+            nlmsg_free(msg);
+            return (struct nl_msg *)nullptr;
+        }
+        return msg;
+    });
+}
+
+void RtnlHelper::linkAddVlan(const string &parent, const string &alias, uint16_t vid,
+                             const MacAddress *mac, bool up)
+{
+    bool has_mac = (mac != nullptr);
+    MacAddress address = has_mac ? *mac : MacAddress();
+
+    queue("link add link " + parent + " name " + alias + " type vlan id " + to_string(vid),
+          [parent, alias, vid, has_mac, address, up]() {
+        uint32_t parent_index = if_nametoindex(parent.c_str());
+        if (!parent_index)
+        {
+            return (struct nl_msg *)nullptr;
+        }
+
+        struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, alias,
+                                          up ? IFF_UP : 0, up ? IFF_UP : 0);
+        if (!msg)
+        {
+            return msg;
+        }
+
+        struct nlattr *linkinfo, *data;
+        if (nla_put_u32(msg, IFLA_LINK, parent_index) < 0 ||
+            (has_mac && nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, address.getMac()) < 0) ||
+            !(linkinfo = nla_nest_start(msg, IFLA_LINKINFO)) ||
+            nla_put_string(msg, IFLA_INFO_KIND, "vlan") < 0 ||
+            !(data = nla_nest_start(msg, IFLA_INFO_DATA)) ||
+            nla_put_u16(msg, IFLA_VLAN_ID, vid) < 0)
+        {
+            nlmsg_free(msg);
+            return (struct nl_msg *)nullptr;
+        }
+        nla_nest_end(msg, data);
+        nla_nest_end(msg, linkinfo);
+        return msg;
+    });
+}
+
+void RtnlHelper::linkAddVxlan(const string &alias, uint32_t vni, const IpAddress *local, const IpAddress *remote,
+                              const MacAddress *mac, bool learning, uint16_t port)
+{
+    bool has_local = (local != nullptr), has_remote = (remote != nullptr), has_mac = (mac != nullptr);
+    IpAddress local_ip = has_local ? *local : IpAddress();
+    IpAddress remote_ip = has_remote ? *remote : IpAddress();
+    MacAddress address = has_mac ? *mac : MacAddress();
+
+    queue("link add " + alias + " type vxlan id " + to_string(vni),
+          [alias, vni, has_local, local_ip, has_remote, remote_ip, has_mac, address, learning, port]() {
+        struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, alias);
+        if (!msg)
+        {
+            return msg;
+        }
+
+        auto putIp = [msg](int v4type, int v6type, const IpAddress &ip) {
+            ip_addr_t addr = ip.getIp();
+            if (ip.isV4())
+            {
+                return nla_put(msg, v4type, sizeof(addr.ip_addr.ipv4_addr), &addr.ip_addr.ipv4_addr);
+            }
+            return nla_put(msg, v6type, sizeof(addr.ip_addr.ipv6_addr), addr.ip_addr.ipv6_addr);
+        };
+
+        struct nlattr *linkinfo, *data;
+        if ((has_mac && nla_put(msg, IFLA_ADDRESS, ETHER_ADDR_LEN, address.getMac()) < 0) ||
+            !(linkinfo = nla_nest_start(msg, IFLA_LINKINFO)) ||
+            nla_put_string(msg, IFLA_INFO_KIND, "vxlan") < 0 ||
+            !(data = nla_nest_start(msg, IFLA_INFO_DATA)) ||
+            nla_put_u32(msg, IFLA_VXLAN_ID, vni) < 0 ||
+            (has_local && putIp(IFLA_VXLAN_LOCAL, IFLA_VXLAN_LOCAL6, local_ip) < 0) ||
+            (has_remote && putIp(IFLA_VXLAN_GROUP, IFLA_VXLAN_GROUP6, remote_ip) < 0) ||
+            (!learning && nla_put_u8(msg, IFLA_VXLAN_LEARNING, 0) < 0) ||
+            nla_put_u16(msg, IFLA_VXLAN_PORT, htons(port)) < 0 ||
+            (has_local && !local_ip.isV4() && nla_put_u8(msg, IFLA_VXLAN_UDP_ZERO_CSUM6_RX, 1) < 0))
+        {
+            nlmsg_free(msg);
+            return (struct nl_msg *)nullptr;
+        }
+        nla_nest_end(msg, data);
+        nla_nest_end(msg, linkinfo);
+        return msg;
+    });
+}
+
+void RtnlHelper::linkAddBridge(const string &alias)
+{
+    queue("link add " + alias + " type bridge", [alias]() {
+        struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, alias);
+        if (!msg)
+        {
+            return msg;
+        }
+
+        struct nlattr *linkinfo;
+        if (!(linkinfo = nla_nest_start(msg, IFLA_LINKINFO)) ||
+            nla_put_string(msg, IFLA_INFO_KIND, "bridge") < 0)
+        {
+            nlmsg_free(msg);
+            return (struct nl_msg *)nullptr;
+        }
+        nla_nest_end(msg, linkinfo);
+        return msg;
+    });
+}
+
+void RtnlHelper::linkAddVrf(const string &alias, uint32_t table)
+{
+    queue("link add " + alias + " type vrf table " + to_string(table), [alias, table]() {
+        struct nl_msg *msg = allocLinkMsg(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, AF_UNSPEC, 0, alias);
+        if (!msg)
+        {
+            return msg;
+        }
+
+        struct nlattr *linkinfo, *data;
+        if (!(linkinfo = nla_nest_start(msg, IFLA_LINKINFO)) ||
+            nla_put_string(msg, IFLA_INFO_KIND, "vrf") < 0 ||
+            !(data = nla_nest_start(msg, IFLA_INFO_DATA)) ||
+            nla_put_u32(msg, IFLA_VRF_TABLE, table) < 0)
+        {
+            nlmsg_free(msg);
+            return (struct nl_msg *)nullptr;
+        }
+        nla_nest_end(msg, data);
+        nla_nest_end(msg, linkinfo);
+        return msg;
+    });
+}
+
+void RtnlHelper::linkDel(const string &alias)
+{
+    queue("link del " + alias, [alias]() {
+        return allocLinkMsg(RTM_DELLINK, 0, AF_UNSPEC, 0, alias);
+    });
+}
+
+static struct nl_msg *buildAddrMsg(int type, int flags, const string &alias, const IpPrefix &prefix,
+                                   bool broadcast, uint32_t metric)
+{
+    uint32_t ifindex = if_nametoindex(alias.c_str());
+    if (!ifindex)
+    {
+        return nullptr;
+    }
+
+    struct nl_msg *msg = nlmsg_alloc_simple(type, NLM_F_REQUEST | NLM_F_ACK | flags);
+    if (!msg)
+    {
+        return nullptr;
+    }
+
+    ip_addr_t ip = prefix.getIp().getIp();
+    bool v4 = prefix.isV4();
+    int len = v4 ? (int)sizeof(ip.ip_addr.ipv4_addr) : (int)sizeof(ip.ip_addr.ipv6_addr);
+    const void *addr = v4 ? (const void *)&ip.ip_addr.ipv4_addr : (const void *)ip.ip_addr.ipv6_addr;
+
+    struct ifaddrmsg ifa;
+    memset(&ifa, 0, sizeof(ifa));
+    ifa.ifa_family = v4 ? AF_INET : AF_INET6;
+    ifa.ifa_prefixlen = static_cast<unsigned char>(prefix.getMaskLength());
+    ifa.ifa_index = ifindex;
+
+    int err = nlmsg_append(msg, &ifa, sizeof(ifa), NLMSG_ALIGNTO);
+    if (err >= 0)
+    {
+        err = nla_put(msg, IFA_LOCAL, len, addr);
+    }
+    if (err >= 0)
+    {
+        err = nla_put(msg, IFA_ADDRESS, len, addr);
+    }
+    if (err >= 0 && broadcast && v4)
+    {
+        ip_addr_t brd = prefix.getBroadcastIp().getIp();
+        err = nla_put(msg, IFA_BROADCAST, len, &brd.ip_addr.ipv4_addr);
+    }
+    if (err >= 0 && metric)
+    {
+        err = nla_put_u32(msg, IFA_RT_PRIORITY, metric);
+    }
+    if (err < 0)
+    {
+        nlmsg_free(msg);
+        return nullptr;
+    }
+
+    return msg;
+}
+
+void RtnlHelper::addrAdd(const string &alias, const IpPrefix &prefix, bool broadcast, uint32_t metric)
+{
+    queue("address add " + prefix.to_string() + " dev " + alias, [alias, prefix, broadcast, metric]() {
+        return buildAddrMsg(RTM_NEWADDR, NLM_F_CREATE | NLM_F_EXCL, alias, prefix, broadcast, metric);
+    });
+}
+
+void RtnlHelper::addrDel(const string &alias, const IpPrefix &prefix)
+{
+    queue("address del " + prefix.to_string() + " dev " + alias, [alias, prefix]() {
+        return buildAddrMsg(RTM_DELADDR, 0, alias, prefix, false, 0);
+    });
+}
+
+static struct nl_msg *buildBridgeVlanMsg(int type, const string &alias, uint16_t vid, bool pvidUntagged, bool self)
+{
+    /* AF_BRIDGE requests are only looked up by ifindex */
+    uint32_t ifindex = if_nametoindex(alias.c_str());
+    if (!ifindex)
+    {
+        return nullptr;
+    }
+
+    struct nl_msg *msg = allocLinkMsg(type, 0, AF_BRIDGE, ifindex, alias);
+    if (!msg)
+    {
+        return nullptr;
+    }
+
+    struct bridge_vlan_info vinfo;
+    memset(&vinfo, 0, sizeof(vinfo));
+    vinfo.vid = vid;
+    if (pvidUntagged)
+    {
+        vinfo.flags = BRIDGE_VLAN_INFO_PVID | BRIDGE_VLAN_INFO_UNTAGGED;
+    }
+
+    struct nlattr *afspec = nla_nest_start(msg, IFLA_AF_SPEC);
+    if (!afspec ||
+        (self && nla_put_u16(msg, IFLA_BRIDGE_FLAGS, BRIDGE_FLAGS_SELF) < 0) ||
+        nla_put(msg, IFLA_BRIDGE_VLAN_INFO, sizeof(vinfo), &vinfo) < 0)
+    {
+        nlmsg_free(msg);
+        return nullptr;
+    }
+    nla_nest_end(msg, afspec);
+
+    return msg;
+}
+
+void RtnlHelper::bridgeVlanAdd(const string &alias, uint16_t vid, bool pvidUntagged, bool self)
+{
+    queue("bridge vlan add vid " + to_string(vid) + " dev " + alias, [alias, vid, pvidUntagged, self]() {
+        return buildBridgeVlanMsg(RTM_SETLINK, alias, vid, pvidUntagged, self);
+    });
+}
+
+void RtnlHelper::bridgeVlanDel(const string &alias, uint16_t vid, bool self)
+{
+    queue("bridge vlan del vid " + to_string(vid) + " dev " + alias, [alias, vid, self]() {
+        return buildBridgeVlanMsg(RTM_DELLINK, alias, vid, false, self);
+    });
+}
+
+void RtnlHelper::bridgeLinkSetLearning(const string &alias, bool learning)
+{
+    queue("bridge link set dev " + alias + (learning ? " learning on" : " learning off"), [alias, learning]() {
+        uint32_t ifindex = if_nametoindex(alias.c_str());
+        if (!ifindex)
+        {
+            return (struct nl_msg *)nullptr;
+        }
+
+        struct nl_msg *msg = allocLinkMsg(RTM_SETLINK, 0, AF_BRIDGE, ifindex, alias);
+        if (!msg)
+        {
+            return msg;
+        }
+
+        /* Bridge port attributes are only parsed from a nest flagged as such */
+        struct nlattr *protinfo = nla_nest_start(msg, IFLA_PROTINFO | NLA_F_NESTED);
+        if (!protinfo ||
+            nla_put_u8(msg, IFLA_BRPORT_LEARNING, learning ? 1 : 0) < 0)
+        {
+            nlmsg_free(msg);
+            return (struct nl_msg *)nullptr;
+        }
+        nla_nest_end(msg, protinfo);
+        return msg;
+    });
+}
+
+int RtnlHelper::commit(string &err)
+{
+    SWSS_LOG_ENTER();
+
+    size_t sent = 0, acked = 0;
+    int rc = 0;
+
+    err.clear();
+
+    /* Collect the ACKs of the requests in flight, keeping the error of the first failed one */
+    auto waitForAcks = [&]() {
+        for (; acked < sent; acked++)
+        {
+            int ret = nl_wait_for_ack(m_sock);
+            if (ret < 0 && !rc)
+            {
+                SWSS_LOG_ERROR("Netlink request '%s' failed: %s", m_requests[acked].desc.c_str(), nl_geterror(ret));
+                rc = -ret;
+                err = m_requests[acked].desc + ": " + nl_geterror(ret);
+            }
+        }
+    };
+
+    while (!rc && sent < m_requests.size())
+    {
+        const Request &req = m_requests[sent];
+
+        struct nl_msg *msg = req.build();
+        if (!msg && acked < sent)
+        {
+            /* The interface may be created by a request in flight */
+            waitForAcks();
+            if (rc)
+            {
+                break;
+            }
+            msg = req.build();
+        }
+        if (!msg)
+        {
+            SWSS_LOG_ERROR("Netlink request '%s' failed: cannot find device", req.desc.c_str());
+            rc = ENODEV;
+            err = req.desc + ": cannot find device";
+            break;
+        }
+
+        if (sent - acked >= RTNL_HELPER_MAX_IN_FLIGHT)
+        {
+            waitForAcks();
+            if (rc)
+            {
+                nlmsg_free(msg);
+                break;
+            }
+        }
+
+        int ret = nl_send_auto(m_sock, msg);
+        nlmsg_free(msg);
+        if (ret < 0)
+        {
+            SWSS_LOG_ERROR("Netlink request '%s' failed: %s", req.desc.c_str(), nl_geterror(ret));
+            rc = -ret;
+            err = req.desc + ": " + nl_geterror(ret);
+            break;
+        }
+
+        SWSS_LOG_DEBUG("Netlink request '%s' sent", req.desc.c_str());
+        sent++;
+    }
+
+    waitForAcks();
+
+    m_requests.clear();
+
+    return rc;
+}
+
+int RtnlHelper::exec(const string &shellCmd, string &res)
+{
+    if (isEnabled())
+    {
+        return commit(res);
+    }
+
+    return swss::exec(shellCmd, res);
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "ipaddress.h"
+#include "ipprefix.h"
+#include "macaddress.h"
+
+struct nl_sock;
+struct nl_msg;
+
+namespace swss {
+
+/*
+ * Environment variable that switches the cfgmgr daemons from running
+ * /sbin/ip and /sbin/bridge through a shell to programming the kernel over
+ * rtnetlink. Set it to "1" or "true" to enable; anything else keeps the shell
+ * commands.
+ */
+#define RTNL_HELPER_ENABLE_ENV      "CFGMGR_USE_NETLINK"
+
+/* Like EXEC_WITH_ERROR_THROW, through RtnlHelper::exec() */
+#define RTNL_EXEC_WITH_ERROR_THROW(rtnl, cmd, res)  ({  \
+    int ret = (rtnl).exec(cmd, res);                   \
+    if (ret != 0)                                       \
+    {                                                   \
+        throw runtime_error(cmd + " : " + res);         \
+    }                                                   \
+})
+
+/* UDP port of the VXLAN netdevs created by the cfgmgr daemons */
+#define RTNL_HELPER_VXLAN_PORT      4789
+
+/*
+ * Runs link, address, bridge VLAN filter, master (VRF/bridge enslave) and
+ * MTU operations over one rtnetlink socket instead of forking ip/bridge.
+ *
+ * The operations of one shell command are queued and sent on commit() in a
+ * batch: the requests are sent back to back and their kernel ACKs collected
+ * afterwards. Interfaces are resolved when a request is sent; a request whose
+ * interface is not found waits for the ACKs of the requests in flight, so it
+ * may operate on links created by an earlier request of the same commit.
+ *
+ * Like the "cmd1 && cmd2" chains they replace, the first failure drops the
+ * requests not sent yet. The kernel has no rtnetlink transactions though:
+ * the requests already in flight when it fails are still applied.
+ *
+ * When the helper is disabled, operations are not queued and exec() runs the
+ * equivalent shell command instead, with the same return convention as
+ * swss::exec(), so callers keep a single error handling path:
+ *
+ *     m_rtnl.linkSetMtu(alias, mtu);
+ *     int ret = m_rtnl.exec(cmd, res);
+ */
+class RtnlHelper
+{
+public:
+    RtnlHelper();
+    ~RtnlHelper();
+
+    RtnlHelper(const RtnlHelper &) = delete;
+    RtnlHelper &operator=(const RtnlHelper &) = delete;
+
+    /* Enabled through RTNL_HELPER_ENABLE_ENV and connected */
+    bool isEnabled() const
+    {
+        return m_sock != nullptr;
+    }
+
+    /* ip link set <alias> mtu <mtu> */
+    void linkSetMtu(const std::string &alias, uint32_t mtu);
+    void linkSetMtu(const std::string &alias, const std::string &mtu);
+    /* ip link set <alias> up|down */
+    void linkSetAdminState(const std::string &alias, bool up);
+    /* ip link set <alias> master <master>, or nomaster if master is empty */
+    void linkSetMaster(const std::string &alias, const std::string &master);
+    /* ip link set <alias> address <mac> */
+    void linkSetAddress(const std::string &alias, const MacAddress &mac);
+    /* ip link add link <parent> [up] name <alias> [address <mac>] type vlan id <vid> */
+    void linkAddVlan(const std::string &parent, const std::string &alias, uint16_t vid,
+                     const MacAddress *mac = nullptr, bool up = false);
+    /*
+     * ip link add <alias> [address <mac>] type vxlan id <vni> [local <local>] [remote <remote>]
+     *     [nolearning] dstport <port> [udp6zerocsumrx if local is IPv6]
+     */
+    void linkAddVxlan(const std::string &alias, uint32_t vni, const IpAddress *local, const IpAddress *remote,
+                      const MacAddress *mac = nullptr, bool learning = true, uint16_t port = RTNL_HELPER_VXLAN_PORT);
+    /* ip link add <alias> type bridge */
+    void linkAddBridge(const std::string &alias);
+    /* ip link add <alias> type vrf table <table> */
+    void linkAddVrf(const std::string &alias, uint32_t table);
+    /* ip link del <alias> */
+    void linkDel(const std::string &alias);
+
+    /* ip address add|del <prefix> [broadcast <brd>] dev <alias> [metric <metric>] */
+    void addrAdd(const std::string &alias, const IpPrefix &prefix, bool broadcast = false, uint32_t metric = 0);
+    void addrDel(const std::string &alias, const IpPrefix &prefix);
+
+    /* bridge vlan add vid <vid> dev <alias> [pvid untagged] [self] */
+    void bridgeVlanAdd(const std::string &alias, uint16_t vid, bool pvidUntagged = false, bool self = false);
+    /* bridge vlan del vid <vid> dev <alias> [self] */
+    void bridgeVlanDel(const std::string &alias, uint16_t vid, bool self = false);
+    /* bridge link set dev <alias> learning on|off */
+    void bridgeLinkSetLearning(const std::string &alias, bool learning);
+
+    /*
+     * Send the queued requests in order and collect their ACKs. Returns 0 on
+     * success, or the error of the first failed request with its description
+     * in err; the requests not sent yet when it fails are dropped.
+     */
+    int commit(std::string &err);
+
+    /* commit() if enabled, otherwise run shellCmd through swss::exec() */
+    int exec(const std::string &shellCmd, std::string &res);
+
+private:
+    /* Builds the request; returns nullptr if an interface it refers to does not exist */
+    typedef std::function<struct nl_msg *()> RequestBuilder;
+
+    struct Request
+    {
+        std::string desc;
+        RequestBuilder build;
+    };
+
+    struct nl_sock *m_sock = nullptr;
+    std::vector<Request> m_requests;
+
+    void queue(const std::string &desc, RequestBuilder build);
+};
+
+}
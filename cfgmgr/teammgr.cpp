@@ -8,6 +8,7 @@
 #include <swss/redisutility.h>
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -235,6 +236,32 @@ void TeamMgr::cleanTeamProcesses()
 void TeamMgr::doLagTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
+
+    /*
+     * Start teamd for all the new LAGs of the batch upfront, so that the
+     * teamd instances come up concurrently rather than one after another.
+     */
+    map<string, string> teamdCmds;
+    for (const auto &entry : consumer.m_toSync)
+    {
+        const auto &t = entry.second;
+        const auto &alias = kfvKey(t);
+
+        if (kfvOp(t) != SET_COMMAND || m_lagList.find(alias) != m_lagList.end())
+        {
+            continue;
+        }
+
+        auto min_links = fvsGetValue(kfvFieldsValues(t), "min_links", true);
+        auto fallback = fvsGetValue(kfvFieldsValues(t), "fallback", true);
+        auto fast_rate = fvsGetValue(kfvFieldsValues(t), "fast_rate", true);
+        teamdCmds[alias] = getTeamdCmd(alias,
+                min_links ? stoi(*min_links) : 0,
+                fallback && *fallback == "true",
+                fast_rate && *fast_rate == "true");
+    }
+    auto started = addLags(teamdCmds);
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -306,7 +333,12 @@ void TeamMgr::doLagTask(Consumer &consumer)
 
             if (m_lagList.find(alias) == m_lagList.end())
             {
-                if (addLag(alias, min_links, fallback, fast_rate) == task_need_retry)
+                auto start = started.find(alias);
+                auto status = start != started.end() ? start->second :
+                    addLag(alias, min_links, fallback, fast_rate);
+                started.erase(alias);
+
+                if (status == task_need_retry)
                 {
                     // If LAG creation fails, we need to clean up any potentially orphaned teamd processes
                     removeLag(alias);
@@ -358,6 +390,9 @@ void TeamMgr::doLagMemberTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    /* Members to add, per LAG, which are enslaved to teamd together */
+    map<string, vector<SyncMap::iterator>> pending;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -381,19 +416,50 @@ void TeamMgr::doLagMemberTask(Consumer &consumer)
                 it++;
                 continue;
             }
-            if (addLagMember(lag, member) == task_need_retry)
-            {
-                it++;
-                continue;
-            }
+            pending[lag].push_back(it);
+            it++;
+            continue;
         }
         else if (op == DEL_COMMAND)
         {
+            /* Keep the order of additions and removals */
+            addPendingLagMembers(consumer, pending);
             removeLagMember(lag, member);
         }
 
         it = consumer.m_toSync.erase(it);
     }
+
+    addPendingLagMembers(consumer, pending);
+}
+
+void TeamMgr::addPendingLagMembers(Consumer &consumer, map<string, vector<SyncMap::iterator>> &pending)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &lagMembers : pending)
+    {
+        const auto &lag = lagMembers.first;
+        const auto &entries = lagMembers.second;
+
+        vector<string> members;
+        for (const auto &entry : entries)
+        {
+            auto tokens = tokenize(kfvKey(entry->second), config_db_key_delimiter);
+            members.push_back(tokens[1]);
+        }
+
+        auto results = addLagMembers(lag, members);
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            if (results[i] != task_need_retry)
+            {
+                consumer.m_toSync.erase(entries[i]);
+            }
+        }
+    }
+
+    pending.clear();
 }
 
 bool TeamMgr::checkPortIffUp(const string &port)
@@ -507,7 +573,8 @@ bool TeamMgr::setLagAdminStatus(const string &alias, const string &admin_status)
 
     // ip link set dev <port_channel_name> [up|down]
     cmd << IP_CMD << " link set dev " << shellquote(alias) << " " << shellquote(admin_status);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_rtnl.linkSetAdminState(alias, admin_status == "up");
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmd.str(), res);
 
     SWSS_LOG_NOTICE("Set port channel %s admin status to %s",
             alias.c_str(), admin_status.c_str());
@@ -524,7 +591,8 @@ bool TeamMgr::setLagMtu(const string &alias, const string &mtu)
 
     // ip link set dev <port_channel_name> mtu <mtu_value>
     cmd << IP_CMD << " link set dev " << shellquote(alias) << " mtu " << shellquote(mtu);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_rtnl.linkSetMtu(alias, mtu);
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmd.str(), res);
 
     vector<FieldValueTuple> fvs;
     FieldValueTuple fv("mtu", mtu);
@@ -680,13 +748,11 @@ bool TeamMgr::setLagSysmac(const string &alias, string &sys_mac)
     return true;
 }
 
-task_process_status TeamMgr::addLag(const string &alias, int min_links, bool fallback, bool fast_rate)
+string TeamMgr::getTeamdCmd(const string &alias, int min_links, bool fallback, bool fast_rate)
 {
     SWSS_LOG_ENTER();
 
     stringstream cmd;
-    string res;
-
     stringstream conf;
 
     const string dump_path = "/var/warmboot/teamd/";
@@ -756,7 +822,25 @@ task_process_status TeamMgr::addLag(const string &alias, int min_links, bool fal
         << " -L " << dump_path
         << " -g -d";
 
-    if (exec(cmd.str(), res) != 0)
+    return cmd.str();
+}
+
+task_process_status TeamMgr::addLag(const string &alias, int min_links, bool fallback, bool fast_rate)
+{
+    SWSS_LOG_ENTER();
+
+    return startTeamd(alias, getTeamdCmd(alias, min_links, fallback, fast_rate));
+}
+
+// Thread safe, teamd is started by multiple threads in addLags()
+task_process_status TeamMgr::startTeamd(const string &alias, const string &cmd)
+{
+    SWSS_LOG_ENTER();
+
+    string res;
+
+    // teamd -d returns once the daemon is up, or failed to come up
+    if (exec(cmd, res) != 0)
     {
         SWSS_LOG_INFO("Failed to start port channel %s with teamd, retry...",
                 alias.c_str());
@@ -768,6 +852,58 @@ task_process_status TeamMgr::addLag(const string &alias, int min_links, bool fal
     return task_success;
 }
 
+/*
+ * Start teamd for several port channels at once with up to
+ * TEAMD_MAX_CONCURRENT_STARTS teamd commands in flight, so that bringing up
+ * the port channels takes as long as the slowest teamd rather than the sum
+ * of all of them.
+ */
+map<string, task_process_status> TeamMgr::addLags(const map<string, string> &cmds)
+{
+    SWSS_LOG_ENTER();
+
+    map<string, task_process_status> results;
+
+    if (cmds.size() <= 1)
+    {
+        for (const auto &cmd : cmds)
+        {
+            results[cmd.first] = startTeamd(cmd.first, cmd.second);
+        }
+        return results;
+    }
+
+    vector<pair<string, string>> todo(cmds.begin(), cmds.end());
+    vector<task_process_status> statuses(todo.size(), task_need_retry);
+    atomic<size_t> next(0);
+
+    auto worker = [&]() {
+        for (size_t i = next++; i < todo.size(); i = next++)
+        {
+            statuses[i] = startTeamd(todo[i].first, todo[i].second);
+        }
+    };
+
+    vector<thread> workers;
+    for (size_t i = 0; i < min(todo.size(), (size_t)TEAMD_MAX_CONCURRENT_STARTS); i++)
+    {
+        workers.emplace_back(worker);
+    }
+    for (auto &w : workers)
+    {
+        w.join();
+    }
+
+    for (size_t i = 0; i < todo.size(); i++)
+    {
+        results[todo[i].first] = statuses[i];
+    }
+
+    SWSS_LOG_NOTICE("Started teamd for %zu port channels", todo.size());
+
+    return results;
+}
+
 bool TeamMgr::removeLag(const string &alias)
 {
     SWSS_LOG_ENTER();
@@ -845,9 +981,8 @@ uint16_t TeamMgr::generateLacpKey(const string& lag)
     return 0;
 }
 
-// Once a port is enslaved into a port channel, the port's MTU will
-// be inherited from the master's MTU while the port's admin status
-// will still be controlled separately.
+// Enslave a port into a port channel, see setLagMemberConfig() for the
+// configuration of the port once it is enslaved.
 task_process_status TeamMgr::addLagMember(const string &lag, const string &member)
 {
     SWSS_LOG_ENTER();
@@ -907,6 +1042,99 @@ task_process_status TeamMgr::addLagMember(const string &lag, const string &membe
         }
     }
 
+    return setLagMemberConfig(lag, member);
+}
+
+/*
+ * Enslave the members of a LAG with a single shell command instead of one
+ * shell per member. teamd still handles the port config update and the port
+ * addition of each member separately, so the members are not added as one
+ * transaction: members which don't exist are left out of the command and
+ * ignored, and members which aren't enslaved afterwards, e.g. because they
+ * were brought up concurrently, go through addLagMember() for the usual
+ * checks and error handling.
+ */
+vector<task_process_status> TeamMgr::addLagMembers(const string &lag, const vector<string> &members)
+{
+    SWSS_LOG_ENTER();
+
+    vector<task_process_status> results;
+
+    if (members.size() == 1)
+    {
+        results.push_back(addLagMember(lag, members[0]));
+        return results;
+    }
+
+    uint16_t keyId = generateLacpKey(lag);
+    set<string> enslaving;
+    set<string> missing;
+    stringstream cmd;
+    string res;
+
+    for (const auto &member : members)
+    {
+        if (isPortEnslaved(member) || enslaving.find(member) != enslaving.end() ||
+            missing.find(member) != missing.end())
+        {
+            continue;
+        }
+
+        // If port was already deleted, leave it out of the command
+        if (exec(IP_CMD " link show " + shellquote(member), res) != 0)
+        {
+            SWSS_LOG_WARN("Unable to find port %s", member.c_str());
+            missing.insert(member);
+            continue;
+        }
+        enslaving.insert(member);
+
+        // ip link set dev <member> down;
+        // teamdctl <port_channel_name> port config update <member> { "lacp_key": <lacp_key>, "link_watch": { "name": "ethtool" } };
+        // teamdctl <port_channel_name> port add <member>;
+        cmd << IP_CMD << " link set dev " << shellquote(member) << " down; ";
+        cmd << TEAMDCTL_CMD << " " << shellquote(lag) << " port config update " << shellquote(member)
+            << " '{\"lacp_key\":"
+            << keyId
+            << ",\"link_watch\": {\"name\": \"ethtool\"} }'; ";
+        cmd << TEAMDCTL_CMD << " " << shellquote(lag) << " port add " << shellquote(member) << "; ";
+    }
+
+    if (!enslaving.empty())
+    {
+        // The result of each member is checked below
+        exec(cmd.str(), res);
+    }
+
+    for (const auto &member : members)
+    {
+        if (missing.find(member) != missing.end())
+        {
+            results.push_back(task_ignore);
+        }
+        else if (enslaving.erase(member) && isPortEnslaved(member))
+        {
+            results.push_back(setLagMemberConfig(lag, member));
+        }
+        else
+        {
+            results.push_back(addLagMember(lag, member));
+        }
+    }
+
+    return results;
+}
+
+// Once a port is enslaved into a port channel, the port's MTU will
+// be inherited from the master's MTU while the port's admin status
+// will still be controlled separately.
+task_process_status TeamMgr::setLagMemberConfig(const string &lag, const string &member)
+{
+    SWSS_LOG_ENTER();
+
+    stringstream cmd;
+    string res;
+
     vector<FieldValueTuple> fvs;
     m_cfgPortTable.get(member, fvs);
 
@@ -937,7 +1165,8 @@ task_process_status TeamMgr::addLagMember(const string &lag, const string &membe
     // ip link set dev <member> [up|down]
     cmd.str(string());
     cmd << IP_CMD << " link set dev " << shellquote(member) << " " << shellquote(admin_status);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_rtnl.linkSetAdminState(member, admin_status == "up");
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmd.str(), res);
 
     fvs.clear();
     FieldValueTuple fv("mtu", mtu);
@@ -7,8 +7,12 @@
 #include "netmsg.h"
 #include "orch.h"
 #include "producerstatetable.h"
+#include "rtnlhelper.h"
 #include <sys/types.h>
 
+/* Max teamd instances being started at once */
+#define TEAMD_MAX_CONCURRENT_STARTS 16
+
 namespace swss {
 
 class TeamMgr : public Orch
@@ -37,14 +41,22 @@ private:
 
     MacAddress m_mac;
 
+    RtnlHelper m_rtnl;
+
     void doTask(Consumer &consumer);
     void doLagTask(Consumer &consumer);
     void doLagMemberTask(Consumer &consumer);
     void doPortUpdateTask(Consumer &consumer);
 
     task_process_status addLag(const std::string &alias, int min_links, bool fall_back, bool fast_rate);
+    std::map<std::string, task_process_status> addLags(const std::map<std::string, std::string> &cmds);
+    std::string getTeamdCmd(const std::string &alias, int min_links, bool fall_back, bool fast_rate);
+    task_process_status startTeamd(const std::string &alias, const std::string &cmd);
     bool removeLag(const std::string &alias);
     task_process_status addLagMember(const std::string &lag, const std::string &member);
+    std::vector<task_process_status> addLagMembers(const std::string &lag, const std::vector<std::string> &members);
+    task_process_status setLagMemberConfig(const std::string &lag, const std::string &member);
+    void addPendingLagMembers(Consumer &consumer, std::map<std::string, std::vector<SyncMap::iterator>> &pending);
     bool removeLagMember(const std::string &lag, const std::string &member);
 
     bool setLagAdminStatus(const std::string &alias, const std::string &admin_status);
@@ -131,8 +131,12 @@ bool VlanMgr::addHostVlan(int vlan_id)
                + " address " + gMacAddress.to_string()
                + " type vlan id " + std::to_string(vlan_id) + "\"";
 
+    m_rtnl.bridgeVlanAdd(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), false, true);
+    m_rtnl.linkAddVlan(DOT1Q_BRIDGE_NAME, VLAN_PREFIX + std::to_string(vlan_id), static_cast<uint16_t>(vlan_id),
+                       &gMacAddress, true);
+
     std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmds, res);
 
     res.clear();
     const std::string echo_cmd = std::string("")
@@ -154,8 +158,11 @@ bool VlanMgr::removeHostVlan(int vlan_id)
       + IP_CMD + " link del " + VLAN_PREFIX + std::to_string(vlan_id) + " && "
       + BRIDGE_CMD + " vlan del vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self\"";
 
+    m_rtnl.linkDel(VLAN_PREFIX + std::to_string(vlan_id));
+    m_rtnl.bridgeVlanDel(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), true);
+
     std::string res;
-    EXEC_WITH_ERROR_THROW(cmds, res);
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmds, res);
 
     return true;
 }
@@ -168,9 +175,10 @@ bool VlanMgr::setHostVlanAdminState(int vlan_id, const string &admin_status)
     // /sbin/ip link set Vlan{{vlan_id}} {{admin_status}}
     ostringstream cmds;
     cmds << IP_CMD " link set " VLAN_PREFIX + std::to_string(vlan_id) + " " << shellquote(admin_status);
+    m_rtnl.linkSetAdminState(VLAN_PREFIX + std::to_string(vlan_id), admin_status == "up");
 
     std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmds.str(), res);
 
     return true;
 }
@@ -183,9 +191,10 @@ bool VlanMgr::setHostVlanMtu(int vlan_id, uint32_t mtu)
     // /sbin/ip link set Vlan{{vlan_id}} mtu {{mtu}}
     const std::string cmds = std::string("")
       + IP_CMD + " link set " + VLAN_PREFIX + std::to_string(vlan_id) + " mtu " + std::to_string(mtu);
+    m_rtnl.linkSetMtu(VLAN_PREFIX + std::to_string(vlan_id), mtu);
 
     std::string res;
-    int ret = swss::exec(cmds, res);
+    int ret = m_rtnl.exec(cmds, res);
     if (ret == 0)
     {
         return true;
@@ -250,10 +259,17 @@ bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const str
       BRIDGE_CMD " vlan add vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " " + tagging_cmd;
     cmds << BASH_CMD " -c " << shellquote(inner.str());
 
+    auto queueMember = [&]() {
+        m_rtnl.linkSetMaster(port_alias, DOT1Q_BRIDGE_NAME);
+        m_rtnl.bridgeVlanDel(port_alias, static_cast<uint16_t>(stoi(DEFAULT_VLAN_ID)));
+        m_rtnl.bridgeVlanAdd(port_alias, static_cast<uint16_t>(vlan_id), !tagging_cmd.empty());
+    };
+
     std::string res;
     try
     {
-        EXEC_WITH_ERROR_THROW(cmds.str(), res);
+        queueMember();
+        RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmds.str(), res);
     }
     catch (const std::runtime_error& e)
     {
@@ -265,7 +281,8 @@ bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const str
 	}
         else
 	{
-            EXEC_WITH_ERROR_THROW(cmds.str(), res);
+            queueMember();
+            RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmds.str(), res);
 	}
     }
 
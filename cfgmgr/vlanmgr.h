@@ -4,6 +4,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "rtnlhelper.h"
 
 #include <set>
 #include <map>
@@ -29,6 +30,7 @@ private:
     std::set<std::string> m_vlanMemberReplay;
     bool replayDone;
     std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_PortVlanMember;
+    RtnlHelper m_rtnl;
     
     void doTask(Consumer &consumer);
     void doVlanTask(Consumer &consumer);
@@ -82,7 +82,8 @@ VrfMgr::VrfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, con
                     cmd.str("");
                     cmd.clear();
                     cmd << IP_CMD << " link del " << vrfName;
-                    int ret = swss::exec(cmd.str(), res);
+                    m_rtnl.linkDel(vrfName);
+                    int ret = m_rtnl.exec(cmd.str(), res);
                     if (ret)
                     {
                         SWSS_LOG_ERROR("Command '%s' failed with rc %d", cmd.str().c_str(), ret);
@@ -153,7 +154,8 @@ bool VrfMgr::delLink(const string& vrfName)
     }
 
     cmd << IP_CMD << " link del " << shellquote(vrfName);
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_rtnl.linkDel(vrfName);
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmd.str(), res);
 
     recycleTable(m_vrfTableMap[vrfName]);
     m_vrfTableMap.erase(vrfName);
@@ -189,14 +191,16 @@ bool VrfMgr::setLink(const string& vrfName)
     }
 
     cmd << IP_CMD << " link add " << shellquote(vrfName) << " type vrf table " << table;
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_rtnl.linkAddVrf(vrfName, table);
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmd.str(), res);
 
     m_vrfTableMap.emplace(vrfName, table);
 
     cmd.str("");
     cmd.clear();
     cmd << IP_CMD << " link set " << shellquote(vrfName) << " up";
-    EXEC_WITH_ERROR_THROW(cmd.str(), res);
+    m_rtnl.linkSetAdminState(vrfName, true);
+    RTNL_EXEC_WITH_ERROR_THROW(m_rtnl, cmd.str(), res);
 
     return true;
 }
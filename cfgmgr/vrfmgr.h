@@ -7,6 +7,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "rtnlhelper.h"
 
 using namespace std;
 
@@ -44,6 +45,8 @@ private:
 
     Table m_stateVrfTable, m_stateVrfObjectTable;
     ProducerStateTable m_appVrfTableProducer, m_appVnetTableProducer, m_appVxlanVrfTableProducer;
+
+    RtnlHelper m_rtnl;
 };
 
 }
@@ -52,7 +52,7 @@ static std::string getVxlanIfName(const swss::VxlanMgr::VxlanInfo & info)
 
 #define RET_SUCCESS 0
 
-static int cmdCreateVxlan(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdCreateVxlan(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // ip link add {{VXLAN}} type vxlan id {{VNI}} [local {{SOURCE IP}}] dstport 4789
     ostringstream cmd;
@@ -75,30 +75,50 @@ static int cmdCreateVxlan(const swss::VxlanMgr::VxlanInfo & info, std::string &
             cmd << " udp6zerocsumrx";
         }
     }
-    return swss::exec(cmd.str(), res);
+    if (rtnl.isEnabled())
+    {
+        try
+        {
+            IpAddress sourceIp;
+            if (!info.m_sourceIp.empty())
+            {
+                sourceIp = IpAddress(info.m_sourceIp);
+            }
+            rtnl.linkAddVxlan(info.m_vxlan, static_cast<uint32_t>(stoul(info.m_vni)),
+                              info.m_sourceIp.empty() ? nullptr : &sourceIp, nullptr);
+        }
+        catch (const std::logic_error &)
+        {
+            res = "invalid vni " + info.m_vni + " or source ip " + info.m_sourceIp;
+            return 1;
+        }
+    }
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdUpVxlan(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdUpVxlan(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // ip link set dev {{VXLAN}} up
     ostringstream cmd;
     cmd << IP_CMD " link set dev "
         << shellquote(info.m_vxlan)
         << " up";
-    return swss::exec(cmd.str(), res);
+    rtnl.linkSetAdminState(info.m_vxlan, true);
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdCreateVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdCreateVxlanIf(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // ip link add {{VXLAN_IF}} type bridge
     ostringstream cmd;
     cmd << IP_CMD " link add "
         << shellquote(info.m_vxlanIf)
         << " type bridge";
-    return swss::exec(cmd.str(), res);
+    rtnl.linkAddBridge(info.m_vxlanIf);
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdAddVxlanIntoVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdAddVxlanIntoVxlanIf(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // brctl addif {{VXLAN_IF}} {{VXLAN}}
     ostringstream cmd;
@@ -106,6 +126,20 @@ static int cmdAddVxlanIntoVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::s
         << shellquote(info.m_vxlanIf)
         << " "
         << shellquote(info.m_vxlan);
+    MacAddress macAddress;
+    if (rtnl.isEnabled() && !info.m_macAddress.empty())
+    {
+        try
+        {
+            macAddress = MacAddress(info.m_macAddress);
+        }
+        catch (const std::invalid_argument &)
+        {
+            res = "invalid MAC address " + info.m_macAddress;
+            return 1;
+        }
+    }
+    rtnl.linkSetMaster(info.m_vxlan, info.m_vxlanIf);
     if (!info.m_macAddress.empty())
     {
         // Change the MAC address of Vxlan bridge interface to ensure it's same with switch's.
@@ -115,11 +149,12 @@ static int cmdAddVxlanIntoVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::s
             << shellquote(info.m_vxlanIf)
             << " address "
             << shellquote(info.m_macAddress);
+        rtnl.linkSetAddress(info.m_vxlanIf, macAddress);
     }
-    return swss::exec(cmd.str(), res);
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdAttachVxlanIfToVnet(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdAttachVxlanIfToVnet(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // ip link set dev {{VXLAN_IF}} master {{VNET}}
     ostringstream cmd;
@@ -127,38 +162,42 @@ static int cmdAttachVxlanIfToVnet(const swss::VxlanMgr::VxlanInfo & info, std::s
         << shellquote(info.m_vxlanIf)
         << " master "
         << shellquote(info.m_vnet);
-    return swss::exec(cmd.str(), res);
+    rtnl.linkSetMaster(info.m_vxlanIf, info.m_vnet);
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdUpVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdUpVxlanIf(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // ip link set dev {{VXLAN_IF}} up
     ostringstream cmd;
     cmd << IP_CMD " link set dev "
         << shellquote(info.m_vxlanIf)
         << " up";
-    return swss::exec(cmd.str(), res);
+    rtnl.linkSetAdminState(info.m_vxlanIf, true);
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdDeleteVxlan(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdDeleteVxlan(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // ip link del dev {{VXLAN}}
     ostringstream cmd;
     cmd << IP_CMD " link del dev "
         << shellquote(info.m_vxlan);
-    return swss::exec(cmd.str(), res);
+    rtnl.linkDel(info.m_vxlan);
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdVxlanLearningOff(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdVxlanLearningOff(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // bridge link set dev {{VXLAN}} learning off
     ostringstream cmd;
     cmd << BRIDGE_CMD << " link set dev "
         << shellquote(info.m_vxlan) << " learning off";
-    return swss::exec(cmd.str(), res);
+    rtnl.bridgeLinkSetLearning(info.m_vxlan, false);
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdDeleteVxlanFromVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdDeleteVxlanFromVxlanIf(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // brctl delif {{VXLAN_IF}} {{VXLAN}}
     ostringstream cmd;
@@ -166,26 +205,29 @@ static int cmdDeleteVxlanFromVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std
         << shellquote(info.m_vxlanIf)
         << " "
         << shellquote(info.m_vxlan);
-    return swss::exec(cmd.str(), res);
+    rtnl.linkSetMaster(info.m_vxlan, "");
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdDeleteVxlanIf(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdDeleteVxlanIf(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // ip link del {{VXLAN_IF}}
     ostringstream cmd;
     cmd << IP_CMD " link del "
         << shellquote(info.m_vxlanIf);
-    return swss::exec(cmd.str(), res);
+    rtnl.linkDel(info.m_vxlanIf);
+    return rtnl.exec(cmd.str(), res);
 }
 
-static int cmdDetachVxlanIfFromVnet(const swss::VxlanMgr::VxlanInfo & info, std::string & res)
+static int cmdDetachVxlanIfFromVnet(RtnlHelper & rtnl, const swss::VxlanMgr::VxlanInfo & info, std::string & res)
 {
     // ip link set dev {{VXLAN_IF}} nomaster
     ostringstream cmd;
     cmd << IP_CMD " link set dev "
         << shellquote(info.m_vxlanIf)
         << " nomaster";
-    return swss::exec(cmd.str(), res);
+    rtnl.linkSetMaster(info.m_vxlanIf, "");
+    return rtnl.exec(cmd.str(), res);
 }
 
 // Vxlanmgr
@@ -829,7 +871,7 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     int ret = 0;
 
     // Create Vxlan
-    ret = cmdCreateVxlan(info, res);
+    ret = cmdCreateVxlan(m_rtnl, info, res);
     if (ret != RET_SUCCESS)
     {
         SWSS_LOG_WARN(
@@ -841,10 +883,10 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Up Vxlan
-    ret = cmdUpVxlan(info, res);
+    ret = cmdUpVxlan(m_rtnl, info, res);
     if (ret != RET_SUCCESS)
     {
-        cmdDeleteVxlan(info, res);
+        cmdDeleteVxlan(m_rtnl, info, res);
         SWSS_LOG_WARN(
             "Fail to up vxlan %s",
             info.m_vxlan.c_str());
@@ -852,10 +894,10 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Create Vxlan Interface
-    ret = cmdCreateVxlanIf(info, res);
+    ret = cmdCreateVxlanIf(m_rtnl, info, res);
     if (ret != RET_SUCCESS)
     {
-        cmdDeleteVxlan(info, res);
+        cmdDeleteVxlan(m_rtnl, info, res);
         SWSS_LOG_WARN(
             "Fail to create vxlan interface %s",
             info.m_vxlanIf.c_str());
@@ -863,11 +905,11 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Add vxlan into vxlan interface
-    ret = cmdAddVxlanIntoVxlanIf(info, res);
+    ret = cmdAddVxlanIntoVxlanIf(m_rtnl, info, res);
     if ( ret != RET_SUCCESS )
     {
-        cmdDeleteVxlanIf(info, res);
-        cmdDeleteVxlan(info, res);
+        cmdDeleteVxlanIf(m_rtnl, info, res);
+        cmdDeleteVxlan(m_rtnl, info, res);
         SWSS_LOG_WARN(
             "Fail to add %s into %s",
             info.m_vxlan.c_str(),
@@ -876,12 +918,12 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Attach vxlan interface to vnet
-    ret = cmdAttachVxlanIfToVnet(info, res);
+    ret = cmdAttachVxlanIfToVnet(m_rtnl, info, res);
     if ( ret != RET_SUCCESS )
     {
-        cmdDeleteVxlanFromVxlanIf(info, res);
-        cmdDeleteVxlanIf(info, res);
-        cmdDeleteVxlan(info, res);
+        cmdDeleteVxlanFromVxlanIf(m_rtnl, info, res);
+        cmdDeleteVxlanIf(m_rtnl, info, res);
+        cmdDeleteVxlan(m_rtnl, info, res);
         SWSS_LOG_WARN(
             "Fail to set %s master %s",
             info.m_vxlanIf.c_str(),
@@ -891,13 +933,13 @@ bool VxlanMgr::createVxlan(const VxlanInfo & info)
     }
 
     // Up Vxlan Interface
-    ret = cmdUpVxlanIf(info, res);
+    ret = cmdUpVxlanIf(m_rtnl, info, res);
     if ( ret != RET_SUCCESS )
     {
-        cmdDetachVxlanIfFromVnet(info, res);
-        cmdDeleteVxlanFromVxlanIf(info, res);
-        cmdDeleteVxlanIf(info, res);
-        cmdDeleteVxlan(info, res);
+        cmdDetachVxlanIfFromVnet(m_rtnl, info, res);
+        cmdDeleteVxlanFromVxlanIf(m_rtnl, info, res);
+        cmdDeleteVxlanIf(m_rtnl, info, res);
+        cmdDeleteVxlan(m_rtnl, info, res);
         SWSS_LOG_WARN(
             "Fail to up bridge %s",
             info.m_vxlanIf.c_str());
@@ -917,10 +959,10 @@ bool VxlanMgr::deleteVxlan(const VxlanInfo & info)
 
     std::string res;
 
-    cmdDetachVxlanIfFromVnet(info, res);
-    cmdDeleteVxlanFromVxlanIf(info, res);
-    cmdDeleteVxlanIf(info, res);
-    cmdDeleteVxlan(info, res);
+    cmdDetachVxlanIfFromVnet(m_rtnl, info, res);
+    cmdDeleteVxlanFromVxlanIf(m_rtnl, info, res);
+    cmdDeleteVxlanIf(m_rtnl, info, res);
+    cmdDeleteVxlan(m_rtnl, info, res);
 
     m_stateVxlanTable.del(info.m_vxlan);
 
@@ -1074,7 +1116,44 @@ int VxlanMgr::createVxlanNetdevice(std::string vxlanTunnelName, std::string vni_
 
     cmds += link_up_cmd + "\"";
 
-    return swss::exec(cmds,res);
+    if (m_rtnl.isEnabled())
+    {
+        uint32_t vni;
+        uint16_t vid;
+        IpAddress sourceIp, remoteIp;
+        try
+        {
+            vni = static_cast<uint32_t>(stoul(vni_id));
+            vid = static_cast<uint16_t>(stoul(vlan_id));
+            sourceIp = IpAddress(src_ip);
+            if (dst_ip != "")
+            {
+                remoteIp = IpAddress(dst_ip);
+            }
+        }
+        catch (const std::logic_error &)
+        {
+            SWSS_LOG_ERROR("Invalid vni %s, vlan %s or ip %s/%s for %s",
+                           vni_id.c_str(), vlan_id.c_str(), src_ip.c_str(), dst_ip.c_str(), vxlan_dev_name.c_str());
+            return 1;
+        }
+
+        m_rtnl.linkAddVxlan(vxlan_dev_name, vni, &sourceIp, (dst_ip == "") ? nullptr : &remoteIp, &gMacAddress, false);
+        m_rtnl.linkSetMaster(vxlan_dev_name, "Bridge");
+        m_rtnl.bridgeVlanAdd(vxlan_dev_name, vid);
+        m_rtnl.bridgeVlanAdd(vxlan_dev_name, vid, true);
+        if (vlan_id != "1")
+        {
+            m_rtnl.bridgeVlanDel(vxlan_dev_name, 1);
+        }
+        if (evpn_nvo)
+        {
+            m_rtnl.bridgeLinkSetLearning(vxlan_dev_name, false);
+        }
+        m_rtnl.linkSetAdminState(vxlan_dev_name, true);
+    }
+
+    return m_rtnl.exec(cmds, res);
 }
 
 int VxlanMgr::downVxlanNetdevice(std::string vxlan_dev_name)
@@ -1082,7 +1161,8 @@ int VxlanMgr::downVxlanNetdevice(std::string vxlan_dev_name)
     int ret = 0;
     std::string res;
     const std::string cmd = std::string("") + IP_CMD + " link set dev " + vxlan_dev_name + " down";
-    exec(cmd, res);
+    m_rtnl.linkSetAdminState(vxlan_dev_name, false);
+    m_rtnl.exec(cmd, res);
     return ret;
 }
 
@@ -1090,7 +1170,8 @@ int VxlanMgr::deleteVxlanNetdevice(std::string vxlan_dev_name)
 {
     std::string res;
     const std::string cmd = std::string("") + IP_CMD  + " link del dev " + vxlan_dev_name;
-    return swss::exec(cmd, res);
+    m_rtnl.linkDel(vxlan_dev_name);
+    return m_rtnl.exec(cmd, res);
 }
 
 std::vector<std::string> VxlanMgr::parseNetDev(const string& stdout){
@@ -1251,12 +1332,12 @@ void VxlanMgr::clearAllVxlanDevices()
         {
             info.m_vxlan = netdev_name;
             downVxlanNetdevice(netdev_name);
-            cmdDeleteVxlan(info, res);
+            cmdDeleteVxlan(m_rtnl, info, res);
         }
         else if(netdev_type.compare(VXLAN_IF))
         {
             info.m_vxlanIf = netdev_name;
-            cmdDeleteVxlanIf(info, res);
+            cmdDeleteVxlanIf(m_rtnl, info, res);
         }
         it = m_vxlanNetDevices.erase(it);
     }
@@ -1273,7 +1354,7 @@ void VxlanMgr::disableLearningForAllVxlanNetdevices()
         {
             SWSS_LOG_INFO("Disable learning for NetDevice %s\n", netdev_name.c_str());
             info.m_vxlan = netdev_name;
-            cmdVxlanLearningOff(info, res);
+            cmdVxlanLearningOff(m_rtnl, info, res);
         }
     }
 }
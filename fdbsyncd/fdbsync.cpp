@@ -42,6 +42,8 @@ FdbSync::FdbSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConnector
     {
         m_AppRestartAssist->registerAppTable(APP_VXLAN_FDB_TABLE_NAME, &m_fdbTable);
         m_AppRestartAssist->registerAppTable(APP_VXLAN_REMOTE_VNI_TABLE_NAME, &m_imetTable);
+        // Remote MAC tables can be large: only keep value hashes in the warm restart cache
+        m_AppRestartAssist->setHashedCache(true);
     }
     m_isFdbProtoSupported = checkFdbProtoSupport();
 }
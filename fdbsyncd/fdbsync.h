@@ -24,6 +24,13 @@
  */
 #define INTF_RESTORE_MAX_WAIT_TIME 180
 
+/*
+ * Max number of cached entries reconciled per select loop iteration once the
+ * warm-restart reconcile timer fires, so that a large VXLAN FDB table is
+ * reconciled in bounded batches instead of a single burst
+ */
+#define FDBSYNC_RECONCILE_BATCH_SIZE 1000
+
 namespace swss {
 
 enum FDB_OP_TYPE {
@@ -98,9 +98,26 @@ int main(int argc, char **argv)
             s.addSelectable(sync.getFdbStateTable());
             s.addSelectable(sync.getMclagRemoteFdbStateTable());
             s.addSelectable(sync.getCfgEvpnNvoTable());
+            bool reconcilePending = false;
             while (true)
             {
-                s.select(&temps);
+                /*
+                 * Reconcile the warm restart cache one batch per iteration,
+                 * polling instead of blocking so that netlink and DB events
+                 * keep being served in between
+                 */
+                if (reconcilePending &&
+                    sync.getRestartAssist()->reconcileBatch(FDBSYNC_RECONCILE_BATCH_SIZE))
+                {
+                    reconcilePending = false;
+                    SWSS_LOG_NOTICE("VXLAN FDB VNI Reconcillation Complete");
+                }
+
+                ret = s.select(&temps, reconcilePending ? 0 : -1);
+                if (ret != Select::OBJECT)
+                {
+                    continue;
+                }
 
                 if (temps == (Selectable *)sync.getFdbStateTable())
                 {
@@ -153,8 +170,7 @@ int main(int argc, char **argv)
                         {
                             sync.m_reconcileDone = true;
                             sync.getRestartAssist()->stopReconcileTimer(s);
-                            sync.getRestartAssist()->reconcile();
-                            SWSS_LOG_NOTICE("VXLAN FDB VNI Reconcillation Complete");
+                            reconcilePending = true;
                         }
                     }
                 }
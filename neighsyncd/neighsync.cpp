@@ -29,6 +29,7 @@ NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConne
     m_routeTable(pipelineAppDB, APP_ROUTE_TABLE_NAME, false),
     m_routeCheckTable(appDb, APP_ROUTE_TABLE_NAME),
     m_stateNeighRestoreTable(stateDb, STATE_NEIGH_RESTORE_TABLE_NAME),
+    m_stateStatsTable(stateDb, STATE_NEIGHSYNCD_STATS_TABLE_NAME),
     m_cfgInterfaceTable(cfgDb, CFG_INTF_TABLE_NAME),
     m_cfgLagInterfaceTable(cfgDb, CFG_LAG_INTF_TABLE_NAME),
     m_cfgVlanInterfaceTable(cfgDb, CFG_VLAN_INTF_TABLE_NAME),
@@ -62,6 +63,16 @@ NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConne
         m_nl_sock = NULL;
         SWSS_LOG_THROW("Failed to allocate link cache");
     }
+
+    /* Neighbor writes are pipelined and flushed by flushPendingNeighbors() */
+    m_neighTable.setBuffered(true);
+    m_routeTable.setBuffered(true);
+
+    /* Load the initial content of the cached config tables */
+    for (auto table : getCfgTables())
+    {
+        processCfgTable(table);
+    }
 }
 
 NeighSync::~NeighSync()
@@ -133,6 +144,76 @@ void NeighSync::processCfgEvpnNvo()
     }
 }
 
+vector<SubscriberStateTable *> NeighSync::getCfgTables()
+{
+    return { &m_cfgPeerSwitchTable, &m_cfgVlanInterfaceTable,
+             &m_cfgLagInterfaceTable, &m_cfgInterfaceTable };
+}
+
+bool NeighSync::processCfgTable(Selectable *table)
+{
+    if (table == &m_cfgPeerSwitchTable)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        m_cfgPeerSwitchTable.pops(entries);
+
+        for (const auto &entry : entries)
+        {
+            if (kfvOp(entry) == SET_COMMAND)
+            {
+                m_peerSwitches.insert(kfvKey(entry));
+            }
+            else
+            {
+                m_peerSwitches.erase(kfvKey(entry));
+            }
+        }
+        return true;
+    }
+
+    if (table != &m_cfgVlanInterfaceTable && table != &m_cfgLagInterfaceTable &&
+        table != &m_cfgInterfaceTable)
+    {
+        return false;
+    }
+
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    static_cast<SubscriberStateTable *>(table)->pops(entries);
+
+    for (const auto &entry : entries)
+    {
+        const string &port = kfvKey(entry);
+
+        /* Only the interface entries carry the link local setting, not the IP ones */
+        if (port.find(m_cfgInterfaceTable.getTableNameSeparator()) != string::npos)
+        {
+            continue;
+        }
+
+        bool enabled = false;
+        if (kfvOp(entry) == SET_COMMAND)
+        {
+            for (const auto &fv : kfvFieldsValues(entry))
+            {
+                if (fvField(fv) == "ipv6_use_link_local_only")
+                {
+                    enabled = (fvValue(fv) == "enable");
+                }
+            }
+        }
+
+        if (enabled)
+        {
+            m_linkLocalIntfs.insert(port);
+        }
+        else
+        {
+            m_linkLocalIntfs.erase(port);
+        }
+    }
+
+    return true;
+}
 
 // Check if neighbor table is restored in kernel
 bool NeighSync::isNeighRestoreDone()
@@ -156,9 +237,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     string key;
     string family;
     string intfName;
-    std::vector<std::string> peerSwitchKeys;
-    m_cfgPeerSwitchTable.getKeys(peerSwitchKeys);
-    bool is_dualtor = peerSwitchKeys.size() > 0;
+    bool is_dualtor = !m_peerSwitches.empty();
 
     if ((nlmsg_type != RTM_NEWNEIGH) && (nlmsg_type != RTM_GETNEIGH) &&
         (nlmsg_type != RTM_DELNEIGH))
@@ -249,6 +328,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     }
 
     SWSS_LOG_INFO("Get neighbor msg %s, state %d, type %d", ipStr, state, nlmsg_type);
+    m_eventsIn++;
 
     bool delete_key = false;
     bool use_zero_mac = false;
@@ -325,7 +405,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     {
         if (delete_key == true)
         {
-            m_neighTable.del(key);
+            addPendingNeighbor(key, true, {});
             return;
         }
 
@@ -338,56 +418,111 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
             hostRoute += ipStr;
 
             SWSS_LOG_INFO("Remove host route before adding neighbor %s", hostRoute.c_str());
-            m_routeTable.del(hostRoute);
+            m_pendingHostRouteDels.insert(hostRoute);
         }
 
-        m_neighTable.set(key, fvVector);
+        addPendingNeighbor(key, false, fvVector);
     }
 }
 
-/* To check the ipv6 link local is enabled on a given port */
-bool NeighSync::isLinkLocalEnabled(const string &port)
+/*
+ * Only the latest state of a neighbor matters to neighorch, so an update
+ * replaces whatever is still pending for the same key.
+ */
+void NeighSync::addPendingNeighbor(const string &key, bool del, const vector<FieldValueTuple> &fvs)
 {
-    vector<FieldValueTuple> values;
+    if (m_pendingNeighbors.empty())
+    {
+        m_pendingSince = chrono::steady_clock::now();
+    }
 
-    if (!port.compare(0, strlen("Vlan"), "Vlan"))
+    auto it = m_pendingNeighbors.find(key);
+    if (it != m_pendingNeighbors.end())
     {
-        if (!m_cfgVlanInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
+        m_coalesced++;
+        it->second = { del, fvs };
     }
-    else if (!port.compare(0, strlen("PortChannel"), "PortChannel"))
+    else
     {
-        if (!m_cfgLagInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
+        m_pendingNeighbors.emplace(key, NeighUpdate{ del, fvs });
+    }
+
+    if (m_pendingNeighbors.size() >= NEIGHSYNC_MAX_PENDING)
+    {
+        flushPendingNeighbors();
+    }
+}
+
+int NeighSync::getFlushTimeout() const
+{
+    if (m_pendingNeighbors.empty() && m_pendingHostRouteDels.empty())
+    {
+        return -1;
+    }
+
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - m_pendingSince);
+    return max(0, NEIGHSYNC_FLUSH_INTERVAL_MS - static_cast<int>(elapsed.count()));
+}
+
+void NeighSync::flushPendingNeighbors()
+{
+    /* Host routes go first so they never shadow the neighbors added below */
+    for (const auto &hostRoute : m_pendingHostRouteDels)
+    {
+        m_routeTable.del(hostRoute);
     }
-    else if (!port.compare(0, strlen("Ethernet"), "Ethernet"))
+    m_pendingHostRouteDels.clear();
+
+    for (const auto &neigh : m_pendingNeighbors)
     {
-        if (!m_cfgInterfaceTable.get(port, values))
+        if (neigh.second.del)
         {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
+            m_neighTable.del(neigh.first);
+        }
+        else
+        {
+            m_neighTable.set(neigh.first, neigh.second.fvs);
         }
+        m_writesOut++;
     }
-    else
+    m_pendingNeighbors.clear();
+
+    m_neighTable.flush();
+
+    publishStats();
+}
+
+void NeighSync::publishStats()
+{
+    auto now = chrono::steady_clock::now();
+    if (now - m_statsPublished < chrono::seconds(NEIGHSYNC_STATS_INTERVAL))
+    {
+        return;
+    }
+    m_statsPublished = now;
+
+    m_stateStatsTable.set("neighsyncd", {
+        { "events_in", to_string(m_eventsIn) },
+        { "writes_out", to_string(m_writesOut) },
+        { "coalesced", to_string(m_coalesced) }
+    });
+}
+
+/* To check the ipv6 link local is enabled on a given port */
+bool NeighSync::isLinkLocalEnabled(const string &port)
+{
+    if (port.compare(0, strlen("Vlan"), "Vlan") &&
+        port.compare(0, strlen("PortChannel"), "PortChannel") &&
+        port.compare(0, strlen("Ethernet"), "Ethernet"))
     {
         SWSS_LOG_INFO("IPv6 Link local is not supported for %s ", port.c_str());
         return false;
     }
 
-    auto it = std::find_if(values.begin(), values.end(), [](const FieldValueTuple& t){ return t.first == "ipv6_use_link_local_only";});
-    if (it != values.end())
+    if (m_linkLocalIntfs.find(port) != m_linkLocalIntfs.end())
     {
-        if (it->second == "enable")
-        {
-            SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
-            return true;
-        }
+        SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
+        return true;
     }
 
     SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
@@ -1,6 +1,11 @@
 #ifndef __NEIGHSYNC__
 #define __NEIGHSYNC__
 
+#include <chrono>
+#include <map>
+#include <set>
+#include <vector>
+
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "subscriberstatetable.h"
@@ -17,6 +22,18 @@
  */
 #define RESTORE_NEIGH_WAIT_TIME_OUT 180
 
+/*
+ * Neighbor updates are coalesced per key and written to APPL_DB at most this
+ * often (in milliseconds), or as soon as this many distinct keys are pending.
+ */
+#define NEIGHSYNC_FLUSH_INTERVAL_MS 50
+#define NEIGHSYNC_MAX_PENDING 1000
+
+/* Minimum interval (in seconds) between two publications of the counters */
+#define NEIGHSYNC_STATS_INTERVAL 1
+
+#define STATE_NEIGHSYNCD_STATS_TABLE_NAME "NEIGHSYNCD_STATS"
+
 namespace swss {
 
 class NeighSync : public NetMsg
@@ -46,18 +63,52 @@ public:
 
     void processCfgEvpnNvo();
 
+    /* Config tables whose content is cached in memory */
+    std::vector<SubscriberStateTable *> getCfgTables();
+
+    /* Refresh the cache of the given config table, false if it is not one of ours */
+    bool processCfgTable(Selectable *table);
+
+    /* Write the pending neighbor updates to APPL_DB */
+    void flushPendingNeighbors();
+
+    /* Milliseconds until the pending updates are due, -1 if there are none */
+    int getFlushTimeout() const;
+
 private:
-    Table m_stateNeighRestoreTable, m_cfgPeerSwitchTable, m_routeCheckTable;
+    struct NeighUpdate
+    {
+        bool del;
+        std::vector<FieldValueTuple> fvs;
+    };
+
+    Table m_stateNeighRestoreTable, m_routeCheckTable, m_stateStatsTable;
     ProducerStateTable m_neighTable;
     ProducerStateTable m_routeTable;
     SubscriberStateTable m_cfgEvpnNvoTable;
     struct nl_cache    *m_link_cache;
     struct nl_sock     *m_nl_sock;
     AppRestartAssist  *m_AppRestartAssist;
-    Table m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+    SubscriberStateTable m_cfgPeerSwitchTable;
+    SubscriberStateTable m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
     bool m_isEvpnNvoExist = false;
 
+    std::set<std::string> m_peerSwitches;
+    /* Interfaces with ipv6_use_link_local_only enabled */
+    std::set<std::string> m_linkLocalIntfs;
+
+    std::map<std::string, NeighUpdate> m_pendingNeighbors;
+    std::set<std::string> m_pendingHostRouteDels;
+    std::chrono::steady_clock::time_point m_pendingSince;
+
+    uint64_t m_eventsIn = 0;
+    uint64_t m_writesOut = 0;
+    uint64_t m_coalesced = 0;
+    std::chrono::steady_clock::time_point m_statsPublished;
+
     bool isLinkLocalEnabled(const std::string &port);
+    void addPendingNeighbor(const std::string &key, bool del, const std::vector<FieldValueTuple> &fvs);
+    void publishStats();
 };
 
 }
@@ -68,15 +68,37 @@ int main(int argc, char **argv)
 
             s.addSelectable(&netlink);
             s.addSelectable(sync.getCfgEvpnNvoTable());
+            for (auto table : sync.getCfgTables())
+            {
+                s.addSelectable(table);
+            }
             while (true)
             {
                 Selectable *temps;
-                s.select(&temps);
+                /* Wake up when the coalesced neighbor updates are due */
+                int ret = s.select(&temps, sync.getFlushTimeout());
+                if (ret == Select::TIMEOUT)
+                {
+                    sync.flushPendingNeighbors();
+                    continue;
+                }
+                if (ret != Select::OBJECT)
+                {
+                    continue;
+                }
                 if (temps == (Selectable *)sync.getCfgEvpnNvoTable())
                 {
                     sync.processCfgEvpnNvo();
                     continue;
                 }
+                if (sync.processCfgTable(temps))
+                {
+                    continue;
+                }
+                if (sync.getFlushTimeout() == 0)
+                {
+                    sync.flushPendingNeighbors();
+                }
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -87,6 +109,7 @@ int main(int argc, char **argv)
                     {
                         sync.getRestartAssist()->stopReconcileTimer(s);
                         sync.getRestartAssist()->reconcile();
+                        sync.flushPendingNeighbors();
                     }
                 }
             }
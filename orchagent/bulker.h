@@ -46,6 +46,13 @@ typedef sai_status_t (*sai_bulk_set_outbound_port_map_port_range_entry_attribute
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
 
+typedef sai_status_t (*sai_bulk_set_eni_ether_address_map_entry_attribute_fn) (
+        _In_ uint32_t object_count,
+        _In_ const sai_eni_ether_address_map_entry_t *entry,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
+
 static inline bool operator==(const sai_ip_prefix_t& a, const sai_ip_prefix_t& b)
 {
     if (a.addr_family != b.addr_family) return false;
@@ -155,6 +162,13 @@ static inline bool operator==(const sai_outbound_port_map_port_range_entry_t& a,
         ;
 }
 
+static inline bool operator==(const sai_eni_ether_address_map_entry_t& a, const sai_eni_ether_address_map_entry_t& b)
+{
+    return a.switch_id == b.switch_id
+        && memcmp(a.address, b.address, sizeof(a.address)) == 0
+        ;
+}
+
 static inline std::size_t hash_value(const sai_ip_prefix_t& a)
 {
     size_t seed = 0;
@@ -306,6 +320,18 @@ namespace std
             return seed;
         }
     };
+
+    template <>
+    struct hash<sai_eni_ether_address_map_entry_t>
+    {
+        size_t operator()(const sai_eni_ether_address_map_entry_t& a) const noexcept
+        {
+            size_t seed = 0;
+            boost::hash_combine(seed, a.switch_id);
+            boost::hash_combine(seed, a.address);
+            return seed;
+        }
+    };
 }
 
 // SAI typedef which is not available in SAI 1.5
@@ -384,6 +410,19 @@ struct SaiBulkerTraits<sai_next_hop_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_lag_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_lag_api_t;
+    using create_entry_fn = sai_create_lag_member_fn;
+    using remove_entry_fn = sai_remove_lag_member_fn;
+    using set_entry_attribute_fn = sai_set_lag_member_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_mpls_api_t>
 {
@@ -498,6 +537,16 @@ struct SaiBulkerTraits<sai_dash_tunnel_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_dash_acl_api_t>
+{
+    // cannot set entry_t or the non-bulk create/remove functions since there are multiple object types defined in the DASH ACL API
+    using api_t = sai_dash_acl_api_t;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_dash_outbound_port_map_api_t>
 {
@@ -511,6 +560,18 @@ struct SaiBulkerTraits<sai_dash_outbound_port_map_api_t>
     using bulk_set_entry_attribute_fn = sai_bulk_set_outbound_port_map_port_range_entry_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_dash_eni_api_t>
+{
+    // ENI objects and ENI ether address map entries come from the same DASH API,
+    // entry_t and the entry bulk functions are only used by EntityBulker
+    using api_t = sai_dash_eni_api_t;
+    using entry_t = sai_eni_ether_address_map_entry_t;
+    using bulk_create_entry_fn = sai_bulk_create_eni_ether_address_map_entry_fn;
+    using bulk_remove_entry_fn = sai_bulk_remove_eni_ether_address_map_entry_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_set_eni_ether_address_map_entry_attribute_fn;
+};
+
 template <typename T>
 class EntityBulker
 {
@@ -1015,6 +1076,14 @@ inline EntityBulker<sai_dash_outbound_port_map_api_t>::EntityBulker(sai_dash_out
     set_entries_attribute = nullptr;
 }
 
+template <>
+inline EntityBulker<sai_dash_eni_api_t>::EntityBulker(sai_dash_eni_api_t *api, size_t max_bulk_size) : max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_eni_ether_address_map_entries;
+    remove_entries = api->remove_eni_ether_address_map_entries;
+    set_entries_attribute = nullptr;
+}
+
 template <typename T>
 class ObjectBulker
 {
@@ -1357,6 +1426,17 @@ inline ObjectBulker<sai_next_hop_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_h
     set_entries_attribute = api->set_next_hops_attribute;
 }
 
+template <>
+inline ObjectBulker<sai_lag_api_t>::ObjectBulker(SaiBulkerTraits<sai_lag_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_lag_members;
+    remove_entries = api->remove_lag_members;
+    // SAI has no bulk set for LAG members
+    set_entries_attribute = nullptr;
+}
+
 template <>
 inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_vnet_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
     switch_id(switch_id),
@@ -1407,6 +1487,31 @@ inline ObjectBulker<sai_dash_tunnel_api_t>::ObjectBulker(SaiBulkerTraits<sai_das
     }
 }
 
+template <>
+inline ObjectBulker<sai_dash_acl_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_acl_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size, sai_object_type_extensions_t object_type) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    switch (object_type)
+    {
+        case SAI_OBJECT_TYPE_DASH_ACL_GROUP:
+            create_entries = api->create_dash_acl_groups;
+            remove_entries = api->remove_dash_acl_groups;
+            set_entries_attribute = nullptr;
+            break;
+        case SAI_OBJECT_TYPE_DASH_ACL_RULE:
+            create_entries = api->create_dash_acl_rules;
+            remove_entries = api->remove_dash_acl_rules;
+            set_entries_attribute = nullptr;
+            break;
+        default:
+            std::string type_str = sai_serialize_object_type((sai_object_type_t) object_type);
+            std::stringstream ss;
+            ss << "Invalid object type for sai_dash_acl_api_t: " << type_str;
+            throw std::invalid_argument(ss.str());
+    }
+}
+
 template <>
 inline ObjectBulker<sai_dash_outbound_port_map_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_outbound_port_map_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
     switch_id(switch_id),
@@ -1415,3 +1520,14 @@ inline ObjectBulker<sai_dash_outbound_port_map_api_t>::ObjectBulker(SaiBulkerTra
     create_entries = api->create_outbound_port_maps;
     remove_entries = api->remove_outbound_port_maps;
 }
+
+template <>
+inline ObjectBulker<sai_dash_eni_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_eni_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_enis;
+    remove_entries = api->remove_enis;
+    // SAI has no bulk set for ENIs
+    set_entries_attribute = nullptr;
+}
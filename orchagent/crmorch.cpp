@@ -7,9 +7,14 @@
 #include "saihelper.h"
 
 #define CRM_POLLING_INTERVAL "polling_interval"
+#define CRM_FULL_REFRESH_INTERVAL "full_refresh_interval"
 #define CRM_COUNTERS_TABLE_KEY "STATS"
 
 #define CRM_POLLING_INTERVAL_DEFAULT (5 * 60)
+// Availability of resources that are not touched by orchagent may still change
+// (e.g. shared hash tables), so all resources are re-queried every few polls
+// unless full_refresh_interval is configured
+#define CRM_FULL_REFRESH_POLLS_DEFAULT 3
 #define CRM_THRESHOLD_TYPE_DEFAULT CrmThresholdType::CRM_PERCENTAGE
 #define CRM_THRESHOLD_LOW_DEFAULT 70
 #define CRM_THRESHOLD_HIGH_DEFAULT 85
@@ -490,6 +495,13 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 auto interv = timespec { .tv_sec = (time_t)m_pollingInterval.count(), .tv_nsec = 0 };
                 m_timer->setInterval(interv);
                 m_timer->reset();
+                m_fullRefreshPending = true;
+            }
+            else if (field == CRM_FULL_REFRESH_INTERVAL)
+            {
+                m_fullRefreshInterval = chrono::seconds(to_uint<uint32_t>(value));
+                m_fullRefreshIntervalSet = true;
+                m_fullRefreshPending = true;
             }
             else if (crmThreshTypeResMap.find(field) != crmThreshTypeResMap.end())
             {
@@ -545,7 +557,7 @@ void CrmOrch::incCrmResUsedCounter(CrmResourceType resource)
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter++;
+        touchResCounter(resource, CRM_COUNTERS_TABLE_KEY).usedCounter++;
     }
     catch (...)
     {
@@ -560,7 +572,7 @@ void CrmOrch::decCrmResUsedCounter(CrmResourceType resource)
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter--;
+        touchResCounter(resource, CRM_COUNTERS_TABLE_KEY).usedCounter--;
     }
     catch (...)
     {
@@ -575,7 +587,7 @@ void CrmOrch::incCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter++;
+        touchResCounter(resource, getCrmAclKey(stage, point)).usedCounter++;
     }
     catch (...)
     {
@@ -590,7 +602,7 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter--;
+        touchResCounter(resource, getCrmAclKey(stage, point)).usedCounter--;
 
         // remove acl_entry and acl_counter in this acl table
         if (resource == CrmResourceType::CRM_ACL_TABLE)
@@ -629,8 +641,9 @@ void CrmOrch::incCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter++;
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].id = tableId;
+        auto &cnt = touchResCounter(resource, getCrmAclTableKey(tableId));
+        cnt.usedCounter++;
+        cnt.id = tableId;
     }
     catch (...)
     {
@@ -645,7 +658,7 @@ void CrmOrch::decCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter--;
+        touchResCounter(resource, getCrmAclTableKey(tableId)).usedCounter--;
     }
     catch (...)
     {
@@ -660,7 +673,7 @@ void CrmOrch::incCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter++;
+        touchResCounter(resource, getCrmP4rtTableKey(table_name)).usedCounter++;
     }
     catch (...)
     {
@@ -675,7 +688,7 @@ void CrmOrch::decCrmExtTableUsedCounter(CrmResourceType resource, std::string ta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmP4rtTableKey(table_name)].usedCounter--;
+        touchResCounter(resource, getCrmP4rtTableKey(table_name)).usedCounter--;
     }
     catch (...)
     {
@@ -693,20 +706,20 @@ void CrmOrch::incCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
         {
             incCrmResUsedCounter(resource);
-            auto &rule_cnt = m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = touchResCounter(CrmResourceType::CRM_DASH_IPV4_ACL_RULE, getCrmDashAclGroupKey(tableId));
             rule_cnt.usedCounter = 0;
             rule_cnt.id = tableId;
         }
         else if (resource == CrmResourceType::CRM_DASH_IPV6_ACL_GROUP)
         {
             incCrmResUsedCounter(resource);
-            auto &rule_cnt = m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = touchResCounter(CrmResourceType::CRM_DASH_IPV6_ACL_RULE, getCrmDashAclGroupKey(tableId));
             rule_cnt.usedCounter = 0;
             rule_cnt.id = tableId;
         }
         else 
         {
-            auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = touchResCounter(resource, getCrmDashAclGroupKey(tableId));
             ++rule_cnt.usedCounter;
         }
     }
@@ -737,7 +750,7 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         }
         else 
         {
-            auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = touchResCounter(resource, getCrmDashAclGroupKey(tableId));
             --rule_cnt.usedCounter;
         }
     }
@@ -748,11 +761,35 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
     }
 }
 
+CrmOrch::CrmResourceCounter &CrmOrch::touchResCounter(CrmResourceType resource, const string &key)
+{
+    auto &res = m_resourcesMap.at(resource);
+    auto &cnt = res.countersMap[key];
+
+    res.dirty = true;
+    cnt.dirty = true;
+
+    return cnt;
+}
+
 void CrmOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
-    getResAvailableCounters();
+    auto fullRefreshInterval = m_fullRefreshIntervalSet ?
+        m_fullRefreshInterval : CRM_FULL_REFRESH_POLLS_DEFAULT * m_pollingInterval;
+
+    // Half a poll of slack, so that a timer firing a little early doesn't delay the refresh by a poll
+    auto now = chrono::steady_clock::now();
+    bool fullRefresh = m_fullRefreshPending ||
+        (now - m_lastFullRefresh + m_pollingInterval / 2 >= fullRefreshInterval);
+    if (fullRefresh)
+    {
+        m_fullRefreshPending = false;
+        m_lastFullRefresh = now;
+    }
+
+    getResAvailableCounters(fullRefresh);
     updateCrmCountersTable();
     checkCrmThresholds();
 }
@@ -829,12 +866,14 @@ bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
         availCount = attr.value.u32;
     }
 
-    res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = static_cast<uint32_t>(availCount);
+    auto &cnt = res.countersMap[CRM_COUNTERS_TABLE_KEY];
+    cnt.availableCounter = static_cast<uint32_t>(availCount);
+    cnt.dirty = false;
 
     return true;
 }
 
-bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res)
+bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res, bool fullRefresh)
 {
     if (gMySwitchType != "dpu")
     {
@@ -845,7 +884,12 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
     sai_object_type_t objType = crmResSaiObjAttrMap.at(type);
 
     for (auto &cnt : res.countersMap)
-    { 
+    {
+        if (!fullRefresh && !cnt.second.dirty)
+        {
+            continue;
+        }
+
         sai_attribute_t attr;
         attr.id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
         attr.value.oid = cnt.second.id;
@@ -870,12 +914,13 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
         }
 
         cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+        cnt.second.dirty = false;
     }
 
     return true;
 }
 
-void CrmOrch::getResAvailableCounters()
+void CrmOrch::getResAvailableCounters(bool fullRefresh)
 {
     SWSS_LOG_ENTER();
 
@@ -887,6 +932,14 @@ void CrmOrch::getResAvailableCounters()
             continue;
         }
 
+        // only query SAI for resources that were changed since the last tick
+        if (!fullRefresh && !res.second.dirty)
+        {
+            continue;
+        }
+
+        res.second.dirty = false;
+
         switch (res.first)
         {
             case CrmResourceType::CRM_IPV4_ROUTE:
@@ -996,6 +1049,11 @@ void CrmOrch::getResAvailableCounters()
 
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!fullRefresh && !cnt.second.dirty)
+                    {
+                        continue;
+                    }
+
                     sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
                     if ((status == SAI_STATUS_NOT_SUPPORTED) ||
                         (status == SAI_STATUS_NOT_IMPLEMENTED) ||
@@ -1014,6 +1072,7 @@ void CrmOrch::getResAvailableCounters()
                     }
 
                     cnt.second.availableCounter = attr.value.u32;
+                    cnt.second.dirty = false;
                 }
 
                 break;
@@ -1023,6 +1082,11 @@ void CrmOrch::getResAvailableCounters()
             {
                 for (auto &cnt : res.second.countersMap)
                 {
+                    if (!fullRefresh && !cnt.second.dirty)
+                    {
+                        continue;
+                    }
+
                     std::string table_name = cnt.first;
                     sai_object_type_t objType = crmResSaiObjAttrMap.at(res.first);
                     sai_attribute_t attr;
@@ -1042,6 +1106,7 @@ void CrmOrch::getResAvailableCounters()
                     }
 
                     cnt.second.availableCounter = static_cast<uint32_t>(availCount);
+                    cnt.second.dirty = false;
                 }
                 break;
             }
@@ -1049,7 +1114,7 @@ void CrmOrch::getResAvailableCounters()
             case CrmResourceType::CRM_DASH_IPV4_ACL_RULE:
             case CrmResourceType::CRM_DASH_IPV6_ACL_RULE:
             {
-                getDashAclGroupResAvailability(res.first, res.second);
+                getDashAclGroupResAvailability(res.first, res.second, fullRefresh);
                 break;
             }
 
@@ -1064,22 +1129,30 @@ void CrmOrch::updateCrmCountersTable()
 {
     SWSS_LOG_ENTER();
 
+    // Collect only the fields which changed since the last update, grouped per key
+    map<string, vector<FieldValueTuple>> changedFields;
+
     // Update CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (cnt.second.usedPublished && cnt.second.publishedUsedCounter == cnt.second.usedCounter)
+                {
+                    continue;
+                }
+
+                changedFields[cnt.first].emplace_back(i.first, to_string(cnt.second.usedCounter));
+                cnt.second.usedPublished = true;
+                cnt.second.publishedUsedCounter = cnt.second.usedCounter;
             }
         }
         catch(const out_of_range &e)
@@ -1093,17 +1166,22 @@ void CrmOrch::updateCrmCountersTable()
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (cnt.second.availablePublished && cnt.second.publishedAvailableCounter == cnt.second.availableCounter)
+                {
+                    continue;
+                }
+
+                changedFields[cnt.first].emplace_back(i.first, to_string(cnt.second.availableCounter));
+                cnt.second.availablePublished = true;
+                cnt.second.publishedAvailableCounter = cnt.second.availableCounter;
             }
         }
         catch(const out_of_range &e)
@@ -1111,6 +1189,11 @@ void CrmOrch::updateCrmCountersTable()
             // expected when a resource is unavailable
         }
     }
+
+    for (const auto &fields : changedFields)
+    {
+        m_countersCrmTable->set(fields.first, fields.second);
+    }
 }
 
 void CrmOrch::checkCrmThresholds()
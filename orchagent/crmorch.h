@@ -104,6 +104,13 @@ private:
         uint32_t availableCounter = 0;
         uint32_t usedCounter = 0;
         uint32_t exceededLogCounter = 0;
+        // Set when the counter changed since the last availability query
+        bool dirty = true;
+        // Last values written to COUNTERS_DB, used to skip unchanged fields
+        bool usedPublished = false;
+        bool availablePublished = false;
+        uint32_t publishedUsedCounter = 0;
+        uint32_t publishedAvailableCounter = 0;
     };
 
     struct CrmResourceEntry
@@ -119,18 +126,26 @@ private:
         std::map<std::string, CrmResourceCounter> countersMap;
 
         CrmResourceStatus resStatus = CrmResourceStatus::CRM_RES_SUPPORTED;
+
+        // Set when any counter of this resource changed since the last availability query
+        bool dirty = true;
     };
 
     std::chrono::seconds m_pollingInterval;
+    std::chrono::seconds m_fullRefreshInterval;
+    bool m_fullRefreshIntervalSet = false;
+    std::chrono::steady_clock::time_point m_lastFullRefresh;
+    bool m_fullRefreshPending = true;
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
+    CrmResourceCounter &touchResCounter(CrmResourceType resource, const std::string &key);
     bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
-    bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res);
-    void getResAvailableCounters();
+    bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res, bool fullRefresh);
+    void getResAvailableCounters(bool fullRefresh = true);
     void updateCrmCountersTable();
     void checkCrmThresholds();
     std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
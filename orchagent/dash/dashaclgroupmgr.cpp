@@ -1,6 +1,9 @@
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <algorithm>
+#include <deque>
 #include <map>
+#include <tuple>
 
 #include "dashaclgroupmgr.h"
 
@@ -14,6 +17,7 @@
 extern sai_dash_acl_api_t* sai_dash_acl_api;
 extern sai_dash_eni_api_t* sai_dash_eni_api;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 extern CrmOrch *gCrmOrch;
 
 using namespace std;
@@ -128,21 +132,22 @@ sai_attr_id_t getSaiStage(DashAclDirection d, sai_ip_addr_family_t f, DashAclSta
 }
 
 DashAclRuleInfo::DashAclRuleInfo(const DashAclRule &rule) :
-    m_src_tags(rule.m_src_tags),
-    m_dst_tags(rule.m_dst_tags)
+    m_rule(rule)
 {
     SWSS_LOG_ENTER();
 }
 
 bool DashAclRuleInfo::isTagUsed(const std::string &tag_id) const
 {
-    return (m_src_tags.find(tag_id) != end(m_src_tags)) || (m_dst_tags.find(tag_id) != end(m_dst_tags));
+    return (m_rule.m_src_tags.find(tag_id) != end(m_rule.m_src_tags)) || (m_rule.m_dst_tags.find(tag_id) != end(m_rule.m_dst_tags));
 }
 
 DashAclGroupMgr::DashAclGroupMgr(DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch) :
     m_dash_orch(dashorch),
     m_dash_acl_orch(aclorch),
-    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME))
+    m_dash_acl_rules_table(new Table(db, APP_DASH_ACL_RULE_TABLE_NAME)),
+    m_group_bulker(sai_dash_acl_api, gSwitchId, gMaxBulkSize, SAI_OBJECT_TYPE_DASH_ACL_GROUP),
+    m_rule_bulker(sai_dash_acl_api, gSwitchId, gMaxBulkSize, SAI_OBJECT_TYPE_DASH_ACL_RULE)
 {
     SWSS_LOG_ENTER();
 }
@@ -164,28 +169,39 @@ void DashAclGroupMgr::create(DashAclGroup& group)
     attrs.back().id = SAI_DASH_ACL_GROUP_ATTR_IP_ADDR_FAMILY;
     attrs.back().value.s32 = group.m_ip_version;
 
-    auto status = sai_dash_acl_api->create_dash_acl_group(&group.m_dash_acl_group_id, gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
+    m_group_bulker.create_entry(&group.m_dash_acl_group_id, static_cast<uint32_t>(attrs.size()), attrs.data());
+}
+
+task_process_status DashAclGroupMgr::create(const string& group_id, DashAclGroupBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    if (exists(group_id))
     {
-        SWSS_LOG_ERROR("Failed to create ACL group: %d, %s", status, sai_serialize_status(status).c_str());
-        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, status);
+        return task_failed;
     }
 
-    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
-        CrmResourceType::CRM_DASH_IPV4_ACL_GROUP : CrmResourceType::CRM_DASH_IPV6_ACL_GROUP;
-    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+    create(ctxt.group);
+
+    return task_success;
 }
 
-task_process_status DashAclGroupMgr::create(const string& group_id, DashAclGroup& group)
+task_process_status DashAclGroupMgr::createPost(const string& group_id, DashAclGroupBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
-    if (exists(group_id))
+    auto& group = ctxt.group;
+
+    if (group.m_dash_acl_group_id == SAI_NULL_OBJECT_ID)
     {
-        return task_failed;
+        sai_status_t status = m_group_bulker.create_status(SAI_NULL_OBJECT_ID);
+        SWSS_LOG_ERROR("Failed to create ACL group %s: %s", group_id.c_str(), sai_serialize_status(status).c_str());
+        return createFailureStatus(status);
     }
 
-    create(group);
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+        CrmResourceType::CRM_DASH_IPV4_ACL_GROUP : CrmResourceType::CRM_DASH_IPV6_ACL_GROUP;
+    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
 
     m_groups_table.emplace(group_id, group);
 
@@ -194,6 +210,23 @@ task_process_status DashAclGroupMgr::create(const string& group_id, DashAclGroup
     return task_success;
 }
 
+/*
+ * The bulkers only keep the status of the first failed creation of a flush:
+ * it is used for all the objects that failed with it. An object whose
+ * creation only lacks resources is retried, it can't be tracked otherwise.
+ */
+task_process_status DashAclGroupMgr::createFailureStatus(sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, status) == task_need_retry)
+    {
+        return task_need_retry;
+    }
+
+    return task_failed;
+}
+
 void DashAclGroupMgr::remove(DashAclGroup& group)
 {
     SWSS_LOG_ENTER();
@@ -203,6 +236,31 @@ void DashAclGroupMgr::remove(DashAclGroup& group)
         return;
     }
 
+    // The rules have to be removed before their group
+    deque<sai_status_t> rule_statuses;
+    for (const auto& rule_it : group.m_dash_acl_rule_table)
+    {
+        if (rule_it.second.m_dash_acl_rule_id != SAI_NULL_OBJECT_ID)
+        {
+            rule_statuses.emplace_back();
+            m_rule_bulker.remove_entry(&rule_statuses.back(), rule_it.second.m_dash_acl_rule_id);
+        }
+    }
+    m_rule_bulker.flush();
+
+    for (auto rule_status : rule_statuses)
+    {
+        if (rule_status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule: %d, %s", rule_status, sai_serialize_status(rule_status).c_str());
+        }
+    }
+
+    for (auto& rule_it : group.m_dash_acl_rule_table)
+    {
+        rule_it.second.m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
+    }
+
     sai_status_t status = sai_dash_acl_api->remove_dash_acl_group(group.m_dash_acl_group_id);
     if (status != SAI_STATUS_SUCCESS)
     {
@@ -239,8 +297,9 @@ task_process_status DashAclGroupMgr::remove(const string& group_id)
 
     remove(group);
 
-    m_groups_table.erase(group_id);
     detachTags(group_id, group.m_tags);
+    m_dirty_groups.erase(group_id);
+    m_groups_table.erase(group_it);
     SWSS_LOG_INFO("Removed ACL group %s", group_id.c_str());
 
     return task_success;
@@ -253,15 +312,17 @@ bool DashAclGroupMgr::exists(const string& group_id) const
     return m_groups_table.find(group_id) != m_groups_table.end();
 }
 
-DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& rule)
+void DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRuleBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
     vector<sai_attribute_t> attrs;
-    vector<sai_ip_prefix_t> src_prefixes = {};
-    vector<sai_ip_prefix_t> dst_prefixes = {};
+    auto& rule = ctxt.rule;
+    auto& protocols = ctxt.protocols;
+    auto& src_prefixes = ctxt.src_prefixes;
+    auto& dst_prefixes = ctxt.dst_prefixes;
 
-    DashAclRuleInfo rule_info = rule;
+    ctxt.rule_info = rule;
 
     auto any_ip = [] (const auto& g)
     {
@@ -291,7 +352,6 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.emplace_back();
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_PROTOCOL;
 
-    vector<uint8_t> protocols;
     if (rule.m_protocols.size()) {
         protocols = rule.m_protocols;
     } else {
@@ -318,7 +378,6 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
         const auto& prefixes = m_dash_acl_orch->getDashAclTagMgr().getPrefixes(tag);
         src_prefixes.insert(src_prefixes.end(),
             prefixes.begin(), prefixes.end());
-        group.m_tags.insert(tag);
     }
 
     for (const auto &tag : rule.m_dst_tags)
@@ -327,7 +386,6 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
 
         dst_prefixes.insert(dst_prefixes.end(),
             prefixes.begin(), prefixes.end());
-        group.m_tags.insert(tag);
     }
 
     if (src_prefixes.empty())
@@ -364,24 +422,15 @@ DashAclRuleInfo DashAclGroupMgr::createRule(DashAclGroup& group, DashAclRule& ru
     attrs.back().id = SAI_DASH_ACL_RULE_ATTR_DASH_ACL_GROUP_ID;
     attrs.back().value.oid = group.m_dash_acl_group_id;
 
-    auto status = sai_dash_acl_api->create_dash_acl_rule(&rule_info.m_dash_acl_rule_id, gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to create ACL rule: %d, %s", status, sai_serialize_status(status).c_str());
-        handleSaiCreateStatus((sai_api_t)SAI_API_DASH_ACL, status);
-    }
-
-    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
-            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
-    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
-
-    return rule_info;
+    m_rule_bulker.create_entry(&ctxt.rule_info.m_dash_acl_rule_id, static_cast<uint32_t>(attrs.size()), attrs.data());
 }
 
-task_process_status DashAclGroupMgr::createRule(const string& group_id, const string& rule_id, DashAclRule& rule)
+task_process_status DashAclGroupMgr::createRule(const string& group_id, const string& rule_id, DashAclRuleBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
+    auto& rule = ctxt.rule;
+
     auto group_it = m_groups_table.find(group_id);
     if (group_it == m_groups_table.end())
     {
@@ -408,17 +457,414 @@ task_process_status DashAclGroupMgr::createRule(const string& group_id, const st
         }
     }
 
-    auto rule_info = createRule(group, rule);
+    if (isBound(group) || m_dirty_groups.find(group_id) != m_dirty_groups.end())
+    {
+        // Rules of a bound group are not changed in place, the whole group is rebuilt in refresh()
+        group.m_pending_rules[rule_id] = DashAclRuleInfo(rule);
+        updateTags(group_id, group);
+        m_dirty_groups.insert(group_id);
+        ctxt.shadowed = true;
+
+        return task_success;
+    }
+
+    auto rule_it = group.m_dash_acl_rule_table.find(rule_id);
+    if (rule_it != group.m_dash_acl_rule_table.end())
+    {
+        ctxt.old_rule_id = rule_it->second.m_dash_acl_rule_id;
+        m_rule_bulker.remove_entry(&ctxt.remove_status, ctxt.old_rule_id);
+    }
+
+    createRule(group, ctxt);
+
+    return task_success;
+}
+
+task_process_status DashAclGroupMgr::createRulePost(const string& group_id, const string& rule_id, DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
 
-    group.m_rule_count++;
-    attachTags(group_id, group.m_tags);
+    if (ctxt.shadowed)
+    {
+        // The change is still pending if the group couldn't be rebuilt
+        return m_dirty_groups.find(group_id) == m_dirty_groups.end() ? task_success : task_need_retry;
+    }
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end())
+    {
+        SWSS_LOG_ERROR("ACL group %s was removed while creating rule %s", group_id.c_str(), rule_id.c_str());
+        return task_failed;
+    }
+    auto& group = group_it->second;
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+
+    if (ctxt.old_rule_id != SAI_NULL_OBJECT_ID)
+    {
+        if (ctxt.remove_status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %s", group_id.c_str(), rule_id.c_str(), sai_serialize_status(ctxt.remove_status).c_str());
+            if (ctxt.rule_info.m_dash_acl_rule_id != SAI_NULL_OBJECT_ID)
+            {
+                sai_dash_acl_api->remove_dash_acl_rule(ctxt.rule_info.m_dash_acl_rule_id);
+            }
+            return task_failed;
+        }
+
+        gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+        group.m_dash_acl_rule_table.erase(rule_id);
+    }
+
+    if (ctxt.rule_info.m_dash_acl_rule_id == SAI_NULL_OBJECT_ID)
+    {
+        sai_status_t status = m_rule_bulker.create_status(SAI_NULL_OBJECT_ID);
+        SWSS_LOG_ERROR("Failed to create ACL rule %s:%s: %s", group_id.c_str(), rule_id.c_str(), sai_serialize_status(status).c_str());
+        updateTags(group_id, group);
+        return createFailureStatus(status);
+    }
+
+    gCrmOrch->incCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+
+    group.m_dash_acl_rule_table[rule_id] = ctxt.rule_info;
+    updateTags(group_id, group);
 
     SWSS_LOG_INFO("Created ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
 
     return task_success;
 }
 
-void DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
+task_process_status DashAclGroupMgr::removeRule(const string& group_id, const string& rule_id, DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end())
+    {
+        SWSS_LOG_INFO("ACL group %s doesn't exist", group_id.c_str());
+        return task_success;
+    }
+    auto& group = group_it->second;
+
+    auto rule_it = group.m_dash_acl_rule_table.find(rule_id);
+    auto pending_it = group.m_pending_rules.find(rule_id);
+    bool rule_exists = (pending_it != group.m_pending_rules.end()) ?
+        static_cast<bool>(pending_it->second) : rule_it != group.m_dash_acl_rule_table.end();
+    if (!rule_exists)
+    {
+        SWSS_LOG_INFO("ACL rule %s:%s doesn't exist", group_id.c_str(), rule_id.c_str());
+        return task_success;
+    }
+
+    if (isBound(group) || m_dirty_groups.find(group_id) != m_dirty_groups.end())
+    {
+        group.m_pending_rules[rule_id] = boost::none;
+        updateTags(group_id, group);
+        m_dirty_groups.insert(group_id);
+        ctxt.shadowed = true;
+
+        return task_success;
+    }
+
+    ctxt.old_rule_id = rule_it->second.m_dash_acl_rule_id;
+    m_rule_bulker.remove_entry(&ctxt.remove_status, ctxt.old_rule_id);
+
+    return task_success;
+}
+
+task_process_status DashAclGroupMgr::removeRulePost(const string& group_id, const string& rule_id, DashAclRuleBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    if (ctxt.shadowed)
+    {
+        // The change is still pending if the group couldn't be rebuilt
+        return m_dirty_groups.find(group_id) == m_dirty_groups.end() ? task_success : task_need_retry;
+    }
+
+    if (ctxt.old_rule_id == SAI_NULL_OBJECT_ID)
+    {
+        return task_success;
+    }
+
+    if (ctxt.remove_status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to remove ACL rule %s:%s: %s", group_id.c_str(), rule_id.c_str(), sai_serialize_status(ctxt.remove_status).c_str());
+        return task_failed;
+    }
+
+    auto group_it = m_groups_table.find(group_id);
+    if (group_it == m_groups_table.end())
+    {
+        return task_success;
+    }
+    auto& group = group_it->second;
+
+    CrmResourceType crm_rtype = (group.m_ip_version == SAI_IP_ADDR_FAMILY_IPV4) ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+    gCrmOrch->decCrmDashAclUsedCounter(crm_rtype, group.m_dash_acl_group_id);
+
+    group.m_dash_acl_rule_table.erase(rule_id);
+    updateTags(group_id, group);
+
+    SWSS_LOG_INFO("Removed ACL rule %s:%s", group_id.c_str(), rule_id.c_str());
+
+    return task_success;
+}
+
+void DashAclGroupMgr::flush()
+{
+    SWSS_LOG_ENTER();
+
+    m_group_bulker.flush();
+    m_rule_bulker.flush();
+}
+
+void DashAclGroupMgr::onTagUpdate(const string& group_id)
+{
+    SWSS_LOG_ENTER();
+
+    if (exists(group_id))
+    {
+        m_dirty_groups.insert(group_id);
+    }
+}
+
+/*
+ * Rebuild the groups whose rules or tags changed in shadow SAI groups:
+ * the shadow groups and all their rules are created in bulk, every ENI
+ * bound to a group is then moved to its shadow group with one attribute set
+ * per ENI stage, and the replaced groups are torn down last. The ENIs thus
+ * see either the old or the new rule set, never a partial one.
+ *
+ * The rule table of a group is only updated once its ENIs use the shadow
+ * group. A group whose shadow can't be built, or whose ENIs can't all be
+ * moved to it, keeps its current SAI group and rules. If SAI only lacked
+ * resources the group stays dirty with its changes pending, to be retried
+ * on a later refresh. Otherwise its pending changes are dropped and the
+ * rules they came from are reported as failed.
+ */
+void DashAclGroupMgr::refresh()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_dirty_groups.empty())
+    {
+        return;
+    }
+
+    struct ShadowGroup
+    {
+        DashAclGroup group;
+        map<string, DashAclRuleBulkContext> rules;
+        task_process_status status = task_success;
+    };
+    map<string, ShadowGroup> shadows;
+
+    for (const auto& group_id : m_dirty_groups)
+    {
+        auto group_it = m_groups_table.find(group_id);
+        if (group_it == m_groups_table.end())
+        {
+            continue;
+        }
+
+        auto& shadow = shadows[group_id];
+        shadow.group.m_ip_version = group_it->second.m_ip_version;
+        create(shadow.group);
+    }
+    m_group_bulker.flush();
+
+    for (auto& shadow_it : shadows)
+    {
+        auto& shadow = shadow_it.second;
+        if (shadow.group.m_dash_acl_group_id == SAI_NULL_OBJECT_ID)
+        {
+            shadow.status = createFailureStatus(m_group_bulker.create_status(SAI_NULL_OBJECT_ID));
+            continue;
+        }
+
+        const auto& group = m_groups_table[shadow_it.first];
+        map<string, const DashAclRule*> rules;
+        for (const auto& rule_it : group.m_dash_acl_rule_table)
+        {
+            rules[rule_it.first] = &rule_it.second.m_rule;
+        }
+        for (const auto& rule_it : group.m_pending_rules)
+        {
+            if (rule_it.second)
+            {
+                rules[rule_it.first] = &rule_it.second->m_rule;
+            }
+            else
+            {
+                rules.erase(rule_it.first);
+            }
+        }
+
+        for (const auto& rule_it : rules)
+        {
+            auto& ctxt = shadow.rules.emplace(piecewise_construct, forward_as_tuple(rule_it.first), forward_as_tuple()).first->second;
+            ctxt.rule = *rule_it.second;
+            createRule(shadow.group, ctxt);
+        }
+    }
+    m_rule_bulker.flush();
+
+    deque<sai_status_t> statuses;
+    for (auto& shadow_it : shadows)
+    {
+        const auto& group_id = shadow_it.first;
+        auto& shadow = shadow_it.second;
+        auto& group = m_groups_table[group_id];
+
+        if (shadow.status == task_success &&
+            any_of(shadow.rules.begin(), shadow.rules.end(), [](const auto& rule_it) {
+                return rule_it.second.rule_info.m_dash_acl_rule_id == SAI_NULL_OBJECT_ID;
+            }))
+        {
+            shadow.status = createFailureStatus(m_rule_bulker.create_status(SAI_NULL_OBJECT_ID));
+        }
+
+        if (shadow.status == task_success)
+        {
+            shadow.status = moveBindings(group, shadow.group);
+        }
+
+        vector<sai_object_id_t> rule_ids;
+        sai_object_id_t group_oid;
+
+        if (shadow.status == task_success)
+        {
+            // Tear down the replaced group
+            for (const auto& rule_it : group.m_dash_acl_rule_table)
+            {
+                rule_ids.push_back(rule_it.second.m_dash_acl_rule_id);
+            }
+            group_oid = group.m_dash_acl_group_id;
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to rebuild ACL group %s, keeping its current rules", group_id.c_str());
+            if (shadow.status != task_need_retry)
+            {
+                dropPendingRules(group_id, group);
+            }
+
+            // Tear down what was created of the shadow group
+            for (const auto& rule_it : shadow.rules)
+            {
+                rule_ids.push_back(rule_it.second.rule_info.m_dash_acl_rule_id);
+            }
+            group_oid = shadow.group.m_dash_acl_group_id;
+        }
+
+        for (auto rule_id : rule_ids)
+        {
+            if (rule_id != SAI_NULL_OBJECT_ID)
+            {
+                statuses.emplace_back();
+                m_rule_bulker.remove_entry(&statuses.back(), rule_id);
+            }
+        }
+        if (group_oid != SAI_NULL_OBJECT_ID)
+        {
+            statuses.emplace_back();
+            m_group_bulker.remove_entry(&statuses.back(), group_oid);
+        }
+    }
+    // The rules have to be removed before their group
+    m_rule_bulker.flush();
+    m_group_bulker.flush();
+
+    for (auto status : statuses)
+    {
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove replaced ACL object: %d, %s", status, sai_serialize_status(status).c_str());
+        }
+    }
+
+    for (auto& shadow_it : shadows)
+    {
+        const auto& group_id = shadow_it.first;
+        auto& shadow = shadow_it.second;
+        if (shadow.status != task_success)
+        {
+            continue;
+        }
+
+        auto& group = m_groups_table[group_id];
+
+        CrmResourceType crm_group_rtype = group.isIpV4() ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_GROUP : CrmResourceType::CRM_DASH_IPV6_ACL_GROUP;
+        CrmResourceType crm_rule_rtype = group.isIpV4() ?
+            CrmResourceType::CRM_DASH_IPV4_ACL_RULE : CrmResourceType::CRM_DASH_IPV6_ACL_RULE;
+        gCrmOrch->decCrmDashAclUsedCounter(crm_group_rtype, group.m_dash_acl_group_id);
+        gCrmOrch->incCrmDashAclUsedCounter(crm_group_rtype, shadow.group.m_dash_acl_group_id);
+
+        for (const auto& rule_it : group.m_pending_rules)
+        {
+            if (rule_it.second)
+            {
+                group.m_dash_acl_rule_table[rule_it.first] = *rule_it.second;
+            }
+            else
+            {
+                group.m_dash_acl_rule_table.erase(rule_it.first);
+            }
+        }
+        group.m_pending_rules.clear();
+
+        group.m_dash_acl_group_id = shadow.group.m_dash_acl_group_id;
+        for (const auto& rule_it : shadow.rules)
+        {
+            group.m_dash_acl_rule_table[rule_it.first].m_dash_acl_rule_id = rule_it.second.rule_info.m_dash_acl_rule_id;
+            gCrmOrch->incCrmDashAclUsedCounter(crm_rule_rtype, group.m_dash_acl_group_id);
+        }
+        updateTags(group_id, group);
+
+        m_dirty_groups.erase(group_id);
+
+        SWSS_LOG_NOTICE("Rebuilt ACL group %s with %zu rules", group_id.c_str(), shadow.rules.size());
+    }
+}
+
+bool DashAclGroupMgr::hasDirtyGroups() const
+{
+    SWSS_LOG_ENTER();
+
+    return !m_dirty_groups.empty();
+}
+
+void DashAclGroupMgr::dropPendingRules(const string& group_id, DashAclGroup& group)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_ERROR("Dropping %zu pending rule changes of ACL group %s", group.m_pending_rules.size(), group_id.c_str());
+
+    for (const auto& rule_it : group.m_pending_rules)
+    {
+        m_failed_rules.insert(group_id + ":" + rule_it.first);
+    }
+    group.m_pending_rules.clear();
+    updateTags(group_id, group);
+
+    m_dirty_groups.erase(group_id);
+}
+
+set<string> DashAclGroupMgr::takeFailedRules()
+{
+    SWSS_LOG_ENTER();
+
+    set<string> failed_rules;
+    failed_rules.swap(m_failed_rules);
+
+    return failed_rules;
+}
+
+task_process_status DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage)
 {
     SWSS_LOG_ENTER();
 
@@ -431,8 +877,51 @@ void DashAclGroupMgr::bind(const DashAclGroup& group, const EniEntry& eni, DashA
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to bind ACL group to ENI: %d", status);
-        handleSaiSetStatus((sai_api_t)SAI_API_DASH_ENI, status);
+        return handleSaiSetStatus((sai_api_t)SAI_API_DASH_ENI, status);
     }
+
+    return task_success;
+}
+
+/*
+ * Move the ENI stages bound to a group over to its shadow group. If one of
+ * them can't be moved, the ones already moved are bound back to the group
+ * so that all the ENIs keep using the same rules.
+ */
+task_process_status DashAclGroupMgr::moveBindings(const DashAclGroup& group, const DashAclGroup& shadow)
+{
+    SWSS_LOG_ENTER();
+
+    vector<tuple<const EniEntry*, DashAclDirection, DashAclStage>> moved;
+
+    for (const auto& direction : { DashAclDirection::IN, DashAclDirection::OUT })
+    {
+        const auto& table = (direction == DashAclDirection::IN) ? group.m_in_tables : group.m_out_tables;
+        for (const auto& eni_it : table)
+        {
+            auto eni = m_dash_orch->getEni(eni_it.first);
+            if (!eni)
+            {
+                continue;
+            }
+            for (auto stage : eni_it.second)
+            {
+                auto status = bind(shadow, *eni, direction, stage);
+                if (status != task_success)
+                {
+                    SWSS_LOG_ERROR("Failed to move ENI %s to the rebuilt ACL group, restoring %zu moved bindings", eni_it.first.c_str(), moved.size());
+                    for (auto it = moved.rbegin(); it != moved.rend(); it++)
+                    {
+                        bind(group, *get<0>(*it), get<1>(*it), get<2>(*it));
+                    }
+                    return status;
+                }
+                moved.emplace_back(eni, direction, stage);
+            }
+        }
+    }
+
+    return task_success;
 }
 
 task_process_status DashAclGroupMgr::bind(const string& group_id, const string& eni_id, DashAclDirection direction, DashAclStage stage)
@@ -448,7 +937,7 @@ task_process_status DashAclGroupMgr::bind(const string& group_id, const string&
 
     auto& group = group_it->second;
 
-    if (group.m_rule_count == 0)
+    if (group.m_dash_acl_rule_table.empty())
     {
         SWSS_LOG_INFO("Failed to bind ACL group %s to ENI %s. ACL group has no rules attached.", group_id.c_str(), eni_id.c_str());
         return task_failed;
@@ -461,7 +950,11 @@ task_process_status DashAclGroupMgr::bind(const string& group_id, const string&
         return task_failed;
     }
 
-    bind(group, *eni, direction, stage);
+    auto status = bind(group, *eni, direction, stage);
+    if (status != task_success)
+    {
+        return status;
+    }
 
     auto& table = (direction == DashAclDirection::IN) ? group.m_in_tables : group.m_out_tables;
     auto& eni_stages = table[eni_id];
@@ -565,6 +1058,47 @@ void DashAclGroupMgr::attachTags(const string &group_id, const unordered_set<str
     }
 }
 
+void DashAclGroupMgr::updateTags(const string &group_id, DashAclGroup& group)
+{
+    SWSS_LOG_ENTER();
+
+    unordered_set<string> tags;
+    for (const auto& rule_it : group.m_dash_acl_rule_table)
+    {
+        tags.insert(rule_it.second.m_rule.m_src_tags.begin(), rule_it.second.m_rule.m_src_tags.end());
+        tags.insert(rule_it.second.m_rule.m_dst_tags.begin(), rule_it.second.m_rule.m_dst_tags.end());
+    }
+    // Tags of the pending rules are needed to rebuild the group
+    for (const auto& rule_it : group.m_pending_rules)
+    {
+        if (rule_it.second)
+        {
+            tags.insert(rule_it.second->m_rule.m_src_tags.begin(), rule_it.second->m_rule.m_src_tags.end());
+            tags.insert(rule_it.second->m_rule.m_dst_tags.begin(), rule_it.second->m_rule.m_dst_tags.end());
+        }
+    }
+
+    unordered_set<string> added, unused;
+    for (const auto& tag_id : tags)
+    {
+        if (group.m_tags.find(tag_id) == group.m_tags.end())
+        {
+            added.insert(tag_id);
+        }
+    }
+    for (const auto& tag_id : group.m_tags)
+    {
+        if (tags.find(tag_id) == tags.end())
+        {
+            unused.insert(tag_id);
+        }
+    }
+
+    detachTags(group_id, unused);
+    attachTags(group_id, added);
+    group.m_tags = move(tags);
+}
+
 void DashAclGroupMgr::detachTags(const string &group_id, const unordered_set<string>& tags)
 {
     SWSS_LOG_ENTER();
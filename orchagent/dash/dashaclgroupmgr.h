@@ -1,12 +1,16 @@
 #pragma once
 
+#include <boost/optional.hpp>
+#include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 
 #include <saitypes.h>
 #include <sai.h>
 #include <logger.h>
 
+#include "bulker.h"
 #include "dashorch.h"
 #include "dashtagmgr.h"
 #include "table.h"
@@ -55,8 +59,8 @@ struct DashAclRuleInfo
 {
     sai_object_id_t m_dash_acl_rule_id = SAI_NULL_OBJECT_ID;
 
-    std::unordered_set<std::string> m_src_tags;
-    std::unordered_set<std::string> m_dst_tags;
+    // Kept to recreate the rule in a shadow group
+    DashAclRule m_rule;
 
     DashAclRuleInfo() = default;
     DashAclRuleInfo(const DashAclRule &rule);
@@ -67,9 +71,14 @@ struct DashAclRuleInfo
 struct DashAclGroup
 {
     using EniTable = std::unordered_map<std::string, std::unordered_set<DashAclStage>>;
+    using RuleTable = std::unordered_map<std::string, DashAclRuleInfo>;
     sai_object_id_t m_dash_acl_group_id = SAI_NULL_OBJECT_ID;
     std::unordered_set<std::string> m_tags;
-    int m_rule_count = 0;
+    RuleTable m_dash_acl_rule_table;
+
+    // Rule changes waiting for a shadow rebuild of the group, an empty rule is a removal.
+    // They are applied to the rule table once the ENIs use the rebuilt group.
+    std::unordered_map<std::string, boost::optional<DashAclRuleInfo>> m_pending_rules;
 
     sai_ip_addr_family_t m_ip_version;
     
@@ -87,6 +96,35 @@ struct DashAclGroup
     }
 };
 
+struct DashAclGroupBulkContext
+{
+    DashAclGroup group;
+
+    DashAclGroupBulkContext() {}
+    DashAclGroupBulkContext(const DashAclGroupBulkContext&) = delete;
+    DashAclGroupBulkContext(DashAclGroupBulkContext&&) = delete;
+};
+
+struct DashAclRuleBulkContext
+{
+    DashAclRule rule;
+    DashAclRuleInfo rule_info;
+
+    // The change waits for a shadow rebuild of the group, see DashAclGroupMgr::refresh()
+    bool shadowed = false;
+    sai_object_id_t old_rule_id = SAI_NULL_OBJECT_ID;
+    sai_status_t remove_status = SAI_STATUS_NOT_EXECUTED;
+
+    // Storage of the list attributes, referenced until the bulker is flushed
+    std::vector<std::uint8_t> protocols;
+    std::vector<sai_ip_prefix_t> src_prefixes;
+    std::vector<sai_ip_prefix_t> dst_prefixes;
+
+    DashAclRuleBulkContext() {}
+    DashAclRuleBulkContext(const DashAclRuleBulkContext&) = delete;
+    DashAclRuleBulkContext(DashAclRuleBulkContext&&) = delete;
+};
+
 bool from_pb(const dash::acl_rule::AclRule& data, DashAclRule& rule);
 bool from_pb(const dash::acl_group::AclGroup &data, DashAclGroup& group);
 
@@ -98,16 +136,37 @@ class DashAclGroupMgr
     DashAclOrch *m_dash_acl_orch;
     std::unordered_map<std::string, DashAclGroup> m_groups_table;
     std::unique_ptr<swss::Table> m_dash_acl_rules_table;
+    ObjectBulker<sai_dash_acl_api_t> m_group_bulker;
+    ObjectBulker<sai_dash_acl_api_t> m_rule_bulker;
+    // Groups whose rules or tags changed since their SAI group was built
+    std::set<std::string> m_dirty_groups;
+    // Keys of the pending rule changes dropped by a failed rebuild, to be reported
+    std::set<std::string> m_failed_rules;
 
 public:
     DashAclGroupMgr(swss::DBConnector *db, DashOrch *dashorch, DashAclOrch *aclorch);
 
-    task_process_status create(const std::string& group_id, DashAclGroup& group);
+    // Groups and rules are created in bulk: queued by create*(), completed by create*Post() after flush()
+    task_process_status create(const std::string& group_id, DashAclGroupBulkContext& ctxt);
+    task_process_status createPost(const std::string& group_id, DashAclGroupBulkContext& ctxt);
     task_process_status remove(const std::string& group_id);
     bool exists(const std::string& group_id) const;
     bool isBound(const std::string& group_id);
 
-    task_process_status createRule(const std::string& group_id, const std::string& rule_id, DashAclRule& rule);
+    task_process_status createRule(const std::string& group_id, const std::string& rule_id, DashAclRuleBulkContext& ctxt);
+    task_process_status createRulePost(const std::string& group_id, const std::string& rule_id, DashAclRuleBulkContext& ctxt);
+    task_process_status removeRule(const std::string& group_id, const std::string& rule_id, DashAclRuleBulkContext& ctxt);
+    task_process_status removeRulePost(const std::string& group_id, const std::string& rule_id, DashAclRuleBulkContext& ctxt);
+
+    void flush();
+
+    // The prefixes of a tag used by the group changed
+    void onTagUpdate(const std::string& group_id);
+    // Rebuild the groups with pending changes
+    void refresh();
+    bool hasDirtyGroups() const;
+    // Keys of the rule changes dropped since the last call
+    std::set<std::string> takeFailedRules();
 
     task_process_status bind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
     task_process_status unbind(const std::string& group_id, const std::string& eni_id, DashAclDirection direction, DashAclStage stage);
@@ -117,11 +176,15 @@ private:
     void create(DashAclGroup& group);
     void remove(DashAclGroup& group);
 
-    DashAclRuleInfo createRule(DashAclGroup& group, DashAclRule& rule);
+    void createRule(DashAclGroup& group, DashAclRuleBulkContext& ctxt);
+    task_process_status createFailureStatus(sai_status_t status);
 
-    void bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
+    task_process_status bind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
+    task_process_status moveBindings(const DashAclGroup& group, const DashAclGroup& shadow);
+    void dropPendingRules(const std::string& group_id, DashAclGroup& group);
     void unbind(const DashAclGroup& group, const EniEntry& eni, DashAclDirection direction, DashAclStage stage);
     bool isBound(const DashAclGroup& group);
     void attachTags(const std::string &group_id, const std::unordered_set<std::string>& tags);
     void detachTags(const std::string &group_id, const std::unordered_set<std::string>& tags);
+    void updateTags(const std::string &group_id, DashAclGroup& group);
 };
@@ -12,6 +12,7 @@
 #include "crmorch.h"
 #include "dashaclgroupmgr.h"
 #include "dashtagmgr.h"
+#include "dashresulthelper.h"
 #include "saihelper.h"
 
 using namespace std;
@@ -23,6 +24,8 @@ using namespace dash::acl_group;
 using namespace dash::tag;
 using namespace dash::types;
 
+#define DASH_ACL_REFRESH_RETRY_INTERVAL_SEC 1
+
 template <typename T, typename... Args>
 static bool extractVariables(const string &input, char delimiter, T &output, Args &... args)
 {
@@ -84,6 +87,10 @@ DashAclOrch::DashAclOrch(DBConnector *db, const vector<string> &tables, DashOrch
 {
     SWSS_LOG_ENTER();
 
+    m_result_pipeline = make_unique<RedisPipeline>(app_state_db);
+    m_dash_acl_group_result_table = make_unique<Table>(m_result_pipeline.get(), APP_DASH_ACL_GROUP_TABLE_NAME, true);
+    m_dash_acl_rule_result_table = make_unique<Table>(m_result_pipeline.get(), APP_DASH_ACL_RULE_TABLE_NAME, true);
+
     /* Disable swss.rec recording for high-volume child tables */
     for (const auto &tbl : {APP_DASH_ACL_RULE_TABLE_NAME, APP_DASH_PREFIX_TAG_TABLE_NAME})
     {
@@ -93,6 +100,11 @@ DashAclOrch::DashAclOrch(DBConnector *db, const vector<string> &tables, DashOrch
             consumer->setRecordable(false);
         }
     }
+
+    auto interval = timespec { .tv_sec = DASH_ACL_REFRESH_RETRY_INTERVAL_SEC, .tv_nsec = 0 };
+    m_refresh_timer = new SelectableTimer(interval);
+    auto executor = new ExecutableTimer(m_refresh_timer, this, "DASH_ACL_REFRESH_TIMER");
+    Orch::addExecutor(executor);
 }
 
 DashAclGroupMgr& DashAclOrch::getDashAclGroupMgr()
@@ -107,23 +119,85 @@ DashTagMgr& DashAclOrch::getDashAclTagMgr()
     return m_tag_mgr;
 }
 
+void DashAclOrch::doTask(SelectableTimer &timer)
+{
+    SWSS_LOG_ENTER();
+
+    m_refresh_timer->stop();
+    m_refresh_timer_armed = false;
+
+    auto *rule_consumer = getConsumerBase(APP_DASH_ACL_RULE_TABLE_NAME);
+    if (rule_consumer)
+    {
+        refreshAclGroups(*rule_consumer);
+    }
+}
+
+/*
+ * Rebuild the groups with pending changes. The rule entries whose changes
+ * were dropped by a failed rebuild are completed as failed. The groups that
+ * lacked SAI resources are retried when the timer fires rather than on
+ * every run of the orch.
+ */
+void DashAclOrch::refreshAclGroups(ConsumerBase &rule_consumer)
+{
+    SWSS_LOG_ENTER();
+
+    m_group_mgr.refresh();
+
+    auto failed_rules = m_group_mgr.takeFailedRules();
+    auto itr = rule_consumer.m_toSync.begin();
+    while (!failed_rules.empty() && itr != rule_consumer.m_toSync.end())
+    {
+        auto &message = itr->second;
+        const string &key = kfvKey(message);
+        if (failed_rules.find(key) == failed_rules.end())
+        {
+            itr++;
+            continue;
+        }
+
+        SWSS_LOG_ERROR("Task %s - %s failed", rule_consumer.getTableName().c_str(), kfvOp(message).c_str());
+        if (kfvOp(message) == SET_COMMAND)
+        {
+            writeResultToDB(m_dash_acl_rule_result_table, key, DASH_RESULT_FAILURE);
+        }
+        itr = rule_consumer.m_toSync.erase(itr);
+    }
+    flushResultsToDB(m_dash_acl_rule_result_table);
+
+    if (m_group_mgr.hasDirtyGroups() && !m_refresh_timer_armed)
+    {
+        m_refresh_timer->start();
+        m_refresh_timer_armed = true;
+    }
+}
+
 void DashAclOrch::doTask(ConsumerBase &consumer)
 {
     SWSS_LOG_ENTER();
 
+    const string &table_name = consumer.getTableName();
+    if (table_name == APP_DASH_ACL_GROUP_TABLE_NAME)
+    {
+        doAclGroupTask(consumer);
+        return;
+    }
+    if (table_name == APP_DASH_ACL_RULE_TABLE_NAME)
+    {
+        doAclRuleTask(consumer);
+        return;
+    }
+
     const static TaskMap TaskMap = {
         PbWorker<AclIn>::makeMemberTask(APP_DASH_ACL_IN_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclIn, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_IN_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclIn, this),
         PbWorker<AclOut>::makeMemberTask(APP_DASH_ACL_OUT_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclOut, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_OUT_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclOut, this),
-        PbWorker<AclGroup>::makeMemberTask(APP_DASH_ACL_GROUP_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclGroup, this),
-        KeyOnlyWorker::makeMemberTask(APP_DASH_ACL_GROUP_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashAclGroup, this),
-        PbWorker<AclRule>::makeMemberTask(APP_DASH_ACL_RULE_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashAclRule, this),
         PbWorker<PrefixTag>::makeMemberTask(APP_DASH_PREFIX_TAG_TABLE_NAME, SET_COMMAND, &DashAclOrch::taskUpdateDashPrefixTag, this),
         KeyOnlyWorker::makeMemberTask(APP_DASH_PREFIX_TAG_TABLE_NAME, DEL_COMMAND, &DashAclOrch::taskRemoveDashPrefixTag, this),
      };
 
-    const string &table_name = consumer.getTableName();
     auto itr = consumer.m_toSync.begin();
     while (itr != consumer.m_toSync.end())
     {
@@ -169,6 +243,243 @@ void DashAclOrch::doTask(ConsumerBase &consumer)
             itr = consumer.m_toSync.erase(itr);
         }
     }
+
+    for (const auto &task : TaskMap)
+    {
+        task.second->drained();
+    }
+
+    auto *rule_consumer = getConsumerBase(APP_DASH_ACL_RULE_TABLE_NAME);
+    if (table_name == APP_DASH_PREFIX_TAG_TABLE_NAME && rule_consumer)
+    {
+        // Rebuild the groups using the updated tags
+        refreshAclGroups(*rule_consumer);
+    }
+}
+
+/*
+ * ACL groups and rules are created in bulk: the SET entries of the batch are
+ * queued into the group manager's bulkers, flushed at once and then
+ * completed one by one, writing the result of every entry. An entry whose
+ * object couldn't be created for lack of resources stays in the consumer to
+ * be retried, the others of the batch are done.
+ */
+void DashAclOrch::doAclGroupTask(ConsumerBase &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    const string &table_name = consumer.getTableName();
+    ExecutorStat &parse_stat = getPbParseStat(table_name);
+    map<string, DashAclGroupBulkContext> toBulk;
+
+    auto itr = consumer.m_toSync.begin();
+    while (itr != consumer.m_toSync.end())
+    {
+        auto &message = itr->second;
+        const string &key = kfvKey(message);
+        const string &op = kfvOp(message);
+
+        try
+        {
+            if (toBulk.find(key) != toBulk.end())
+            {
+                // Wait for the pending creation of the group
+                itr++;
+                continue;
+            }
+
+            if (op == SET_COMMAND)
+            {
+                AclGroup data;
+                auto &ctxt = toBulk.emplace(piecewise_construct, forward_as_tuple(key), forward_as_tuple()).first->second;
+                if (parsePbMessage(kfvFieldsValues(message), data, parse_stat) &&
+                    taskUpdateDashAclGroup(key, data, ctxt) == task_success)
+                {
+                    itr++;
+                    continue;
+                }
+
+                SWSS_LOG_ERROR("Task %s - %s failed", table_name.c_str(), op.c_str());
+                toBulk.erase(key);
+                writeResultToDB(m_dash_acl_group_result_table, key, DASH_RESULT_FAILURE);
+            }
+            else if (op == DEL_COMMAND)
+            {
+                if (taskRemoveDashAclGroup(key) == task_success)
+                {
+                    removeResultFromDB(m_dash_acl_group_result_table, key);
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Task %s - %s failed", table_name.c_str(), op.c_str());
+                }
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Unknown task : %s - %s", table_name.c_str(), op.c_str());
+            }
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("Exception caught processing %s entry %s: %s", table_name.c_str(), key.c_str(), e.what());
+            toBulk.erase(key);
+        }
+
+        itr = consumer.m_toSync.erase(itr);
+    }
+
+    m_group_mgr.flush();
+
+    itr = consumer.m_toSync.begin();
+    while (itr != consumer.m_toSync.end())
+    {
+        auto &message = itr->second;
+        const string key = kfvKey(message);
+
+        auto found = toBulk.find(key);
+        if (kfvOp(message) != SET_COMMAND || found == toBulk.end())
+        {
+            itr++;
+            continue;
+        }
+
+        auto status = m_group_mgr.createPost(key, found->second);
+        toBulk.erase(found);
+        if (status == task_need_retry)
+        {
+            itr++;
+            continue;
+        }
+
+        writeResultToDB(m_dash_acl_group_result_table, key,
+                        status == task_success ? DASH_RESULT_SUCCESS : DASH_RESULT_FAILURE);
+        itr = consumer.m_toSync.erase(itr);
+    }
+
+    flushResultsToDB(m_dash_acl_group_result_table);
+}
+
+void DashAclOrch::doAclRuleTask(ConsumerBase &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    const string &table_name = consumer.getTableName();
+    ExecutorStat &parse_stat = getPbParseStat(table_name);
+    map<string, DashAclRuleBulkContext> toBulk;
+
+    auto itr = consumer.m_toSync.begin();
+    while (itr != consumer.m_toSync.end())
+    {
+        auto &message = itr->second;
+        const string &key = kfvKey(message);
+        const string &op = kfvOp(message);
+
+        try
+        {
+            if (toBulk.find(key) != toBulk.end())
+            {
+                // Wait for the pending change of the rule
+                itr++;
+                continue;
+            }
+
+            if (op == SET_COMMAND)
+            {
+                AclRule data;
+                auto &ctxt = toBulk.emplace(piecewise_construct, forward_as_tuple(key), forward_as_tuple()).first->second;
+                if (parsePbMessage(kfvFieldsValues(message), data, parse_stat) &&
+                    taskUpdateDashAclRule(key, data, ctxt) == task_success)
+                {
+                    itr++;
+                    continue;
+                }
+
+                SWSS_LOG_ERROR("Task %s - %s failed", table_name.c_str(), op.c_str());
+                toBulk.erase(key);
+                writeResultToDB(m_dash_acl_rule_result_table, key, DASH_RESULT_FAILURE);
+            }
+            else if (op == DEL_COMMAND)
+            {
+                auto &ctxt = toBulk.emplace(piecewise_construct, forward_as_tuple(key), forward_as_tuple()).first->second;
+                if (taskRemoveDashAclRule(key, ctxt) == task_success)
+                {
+                    itr++;
+                    continue;
+                }
+
+                SWSS_LOG_ERROR("Task %s - %s failed", table_name.c_str(), op.c_str());
+                toBulk.erase(key);
+            }
+            else
+            {
+                SWSS_LOG_ERROR("Unknown task : %s - %s", table_name.c_str(), op.c_str());
+            }
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("Exception caught processing %s entry %s: %s", table_name.c_str(), key.c_str(), e.what());
+            toBulk.erase(key);
+        }
+
+        itr = consumer.m_toSync.erase(itr);
+    }
+
+    m_group_mgr.flush();
+    // Complete the changes made in place first, the rebuild flushes the bulkers again
+    doAclRuleTaskPost(consumer, toBulk, false);
+    // Changes of bound groups are applied by rebuilding the groups
+    refreshAclGroups(consumer);
+    doAclRuleTaskPost(consumer, toBulk, true);
+
+    flushResultsToDB(m_dash_acl_rule_result_table);
+}
+
+void DashAclOrch::doAclRuleTaskPost(ConsumerBase &consumer, map<string, DashAclRuleBulkContext> &toBulk, bool shadowed)
+{
+    SWSS_LOG_ENTER();
+
+    const string &table_name = consumer.getTableName();
+
+    auto itr = consumer.m_toSync.begin();
+    while (itr != consumer.m_toSync.end())
+    {
+        auto &message = itr->second;
+        const string key = kfvKey(message);
+        const string op = kfvOp(message);
+
+        auto found = toBulk.find(key);
+        if (found == toBulk.end() || found->second.shadowed != shadowed)
+        {
+            itr++;
+            continue;
+        }
+
+        auto status = (op == SET_COMMAND) ?
+            taskUpdateDashAclRulePost(key, found->second) : taskRemoveDashAclRulePost(key, found->second);
+        if (status == task_need_retry)
+        {
+            toBulk.erase(found);
+            itr++;
+            continue;
+        }
+
+        if (op == SET_COMMAND)
+        {
+            writeResultToDB(m_dash_acl_rule_result_table, key,
+                            status == task_success ? DASH_RESULT_SUCCESS : DASH_RESULT_FAILURE);
+        }
+        else if (status == task_success)
+        {
+            removeResultFromDB(m_dash_acl_rule_result_table, key);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Task %s - %s failed", table_name.c_str(), op.c_str());
+        }
+
+        toBulk.erase(found);
+        itr = consumer.m_toSync.erase(itr);
+    }
 }
 
 task_process_status DashAclOrch::taskUpdateDashAclIn(
@@ -233,7 +544,8 @@ task_process_status DashAclOrch::taskRemoveDashAclOut(
 
 task_process_status DashAclOrch::taskUpdateDashAclGroup(
     const string &key,
-    const AclGroup &data)
+    const AclGroup &data,
+    DashAclGroupBulkContext &ctxt)
 {
     SWSS_LOG_ENTER();
 
@@ -243,13 +555,12 @@ task_process_status DashAclOrch::taskUpdateDashAclGroup(
         return task_failed;
     }
 
-    DashAclGroup group = {};
-    if (!from_pb(data, group))
+    if (!from_pb(data, ctxt.group))
     {
         return task_failed;
     }
 
-    return m_group_mgr.create(key, group);
+    return m_group_mgr.create(key, ctxt);
 }
 
 task_process_status DashAclOrch::taskRemoveDashAclGroup(
@@ -262,7 +573,8 @@ task_process_status DashAclOrch::taskRemoveDashAclGroup(
 
 task_process_status DashAclOrch::taskUpdateDashAclRule(
     const string &key,
-    const AclRule &data)
+    const AclRule &data,
+    DashAclRuleBulkContext &ctxt)
 {
     SWSS_LOG_ENTER();
 
@@ -273,20 +585,60 @@ task_process_status DashAclOrch::taskUpdateDashAclRule(
         return task_failed;
     }
 
-    DashAclRule rule = {};
+    if (!from_pb(data, ctxt.rule))
+    {
+        return task_failed;
+    }
+
+    return m_group_mgr.createRule(group_id, rule_id, ctxt);
+}
+
+task_process_status DashAclOrch::taskUpdateDashAclRulePost(
+    const string &key,
+    DashAclRuleBulkContext &ctxt)
+{
+    SWSS_LOG_ENTER();
 
-    if (!from_pb(data, rule))
+    string group_id, rule_id;
+    if (!extractVariables(key, ':', group_id, rule_id))
     {
+        SWSS_LOG_ERROR("Failed to parse key %s", key.c_str());
         return task_failed;
     }
 
-    if (m_group_mgr.isBound(group_id))
+    return m_group_mgr.createRulePost(group_id, rule_id, ctxt);
+}
+
+task_process_status DashAclOrch::taskRemoveDashAclRule(
+    const string &key,
+    DashAclRuleBulkContext &ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    string group_id, rule_id;
+    if (!extractVariables(key, ':', group_id, rule_id))
     {
-        SWSS_LOG_INFO("Failed to set dash ACL rule %s:%s, ACL group is bound to the ENI", group_id.c_str(), rule_id.c_str());
+        SWSS_LOG_ERROR("Failed to parse key %s", key.c_str());
+        return task_failed;
+    }
+
+    return m_group_mgr.removeRule(group_id, rule_id, ctxt);
+}
+
+task_process_status DashAclOrch::taskRemoveDashAclRulePost(
+    const string &key,
+    DashAclRuleBulkContext &ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    string group_id, rule_id;
+    if (!extractVariables(key, ':', group_id, rule_id))
+    {
+        SWSS_LOG_ERROR("Failed to parse key %s", key.c_str());
         return task_failed;
     }
 
-    return m_group_mgr.createRule(group_id, rule_id, rule);
+    return m_group_mgr.removeRulePost(group_id, rule_id, ctxt);
 }
 
 task_process_status DashAclOrch::taskUpdateDashPrefixTag(
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <map>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -11,8 +12,10 @@
 #include <sai.h>
 #include <logger.h>
 #include <dbconnector.h>
+#include <redispipeline.h>
 #include <bulker.h>
 #include <orch.h>
+#include "timer.h"
 #include "zmqorch.h"
 #include "zmqserver.h"
 
@@ -41,6 +44,11 @@ public:
 
 private:
     void doTask(ConsumerBase &consumer);
+    void doTask(swss::SelectableTimer &timer) override;
+    void doAclGroupTask(ConsumerBase &consumer);
+    void doAclRuleTask(ConsumerBase &consumer);
+    void doAclRuleTaskPost(ConsumerBase &consumer, std::map<std::string, DashAclRuleBulkContext> &toBulk, bool shadowed);
+    void refreshAclGroups(ConsumerBase &rule_consumer);
 
     task_process_status taskUpdateDashAclIn(
         const std::string &key,
@@ -56,13 +64,24 @@ private:
 
     task_process_status taskUpdateDashAclGroup(
         const std::string &key,
-        const dash::acl_group::AclGroup &data);
+        const dash::acl_group::AclGroup &data,
+        DashAclGroupBulkContext &ctxt);
     task_process_status taskRemoveDashAclGroup(
         const std::string &key);
 
     task_process_status taskUpdateDashAclRule(
         const std::string &key,
-        const dash::acl_rule::AclRule &data);
+        const dash::acl_rule::AclRule &data,
+        DashAclRuleBulkContext &ctxt);
+    task_process_status taskUpdateDashAclRulePost(
+        const std::string &key,
+        DashAclRuleBulkContext &ctxt);
+    task_process_status taskRemoveDashAclRule(
+        const std::string &key,
+        DashAclRuleBulkContext &ctxt);
+    task_process_status taskRemoveDashAclRulePost(
+        const std::string &key,
+        DashAclRuleBulkContext &ctxt);
 
     task_process_status taskUpdateDashPrefixTag(
         const std::string &key,
@@ -86,4 +105,12 @@ private:
     DashTagMgr m_tag_mgr;
 
     DashOrch *m_dash_orch;
+
+    std::unique_ptr<swss::RedisPipeline> m_result_pipeline;
+    std::unique_ptr<swss::Table> m_dash_acl_group_result_table;
+    std::unique_ptr<swss::Table> m_dash_acl_rule_result_table;
+
+    // Retries the rebuild of the groups that lacked SAI resources
+    swss::SelectableTimer *m_refresh_timer;
+    bool m_refresh_timer_armed = false;
 };
@@ -11,7 +11,8 @@
 template<CounterType CT, typename TableT>
 struct DashCounter
 {
-    FlexCounterManager stat_manager;
+    // Counters are cached and installed in one go on flush()
+    FlexCounterTaggedCachedManager<void> stat_manager;
     bool fc_status = false;
     std::unordered_set<std::string> counter_stats;
 
@@ -45,6 +46,11 @@ struct DashCounter
         stat_manager.clearCounterIdList(oid);
     }
 
+    void flush()
+    {
+        stat_manager.flush();
+    }
+
     void refreshStats(bool install, const TableT& entries)
     {
         for (auto it = entries.begin(); it != entries.end(); it++)
@@ -58,6 +64,7 @@ struct DashCounter
                 removeFromFC(it->second.getOid(), it->first);
             }
         }
+        flush();
     }
 
     void handleStatusUpdate(bool enabled, const TableT& entries)
@@ -367,6 +367,7 @@ bool DashHaOrch::addHaSetEntry(const std::string &key, const dash::ha_set::HaSet
     }
     m_ha_set_entries[key] = HaSetEntry {sai_ha_set_oid, entry};
     HaSetCounter.addToFC(sai_ha_set_oid, key);
+    HaSetCounter.flush();
 
     std::vector<FieldValueTuple> nameMapFvs;
     nameMapFvs.emplace_back(key, sai_serialize_object_id(sai_ha_set_oid));
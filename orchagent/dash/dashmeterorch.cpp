@@ -261,6 +261,8 @@ void DashMeterOrch::doTaskMeterPolicyTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
 
     while (it != consumer.m_toSync.end())
@@ -276,7 +278,7 @@ void DashMeterOrch::doTaskMeterPolicyTable(ConsumerBase& consumer)
                 MeterPolicyContext ctxt;
                 ctxt.meter_policy = key;
 
-                if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata, parse_stat))
                 {
                     SWSS_LOG_WARN("Requires protobuff at MeterPolicy :%s", key.c_str());
                     it = consumer.m_toSync.erase(it);
@@ -461,6 +463,8 @@ void DashMeterOrch::doTaskMeterRuleTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
 
     while (it != consumer.m_toSync.end())
@@ -499,7 +503,7 @@ void DashMeterOrch::doTaskMeterRuleTable(ConsumerBase& consumer)
 
                 if (op == SET_COMMAND)
                 {
-                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata, parse_stat))
                     {
                         SWSS_LOG_WARN("Requires protobuff at MeterRule :%s", key.c_str());
                         it = consumer.m_toSync.erase(it);
@@ -60,6 +60,8 @@ static const std::unordered_map<string, sai_direction_lookup_entry_action_t> dir
 
 DashOrch::DashOrch(DBConnector *db, vector<string> &tableName, DBConnector *app_state_db, ZmqServer *zmqServer) :
     ZmqOrch(db, tableName, zmqServer),
+    eni_bulker_(sai_dash_eni_api, gSwitchId, gMaxBulkSize),
+    eni_addr_map_bulker_(sai_dash_eni_api, gMaxBulkSize),
     EniCounter(ENI_STAT_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, ENI_STAT_FLEX_COUNTER_POLLING_INTERVAL_MS, false),
     MeterCounter(METER_STAT_COUNTER_FLEX_COUNTER_GROUP, StatsMode::READ, METER_STAT_FLEX_COUNTER_POLLING_INTERVAL_MS, false)
 {
@@ -427,6 +429,8 @@ void DashOrch::doTaskApplianceTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
     while (it != consumer.m_toSync.end())
@@ -443,7 +447,7 @@ void DashOrch::doTaskApplianceTable(ConsumerBase& consumer)
             {
                 dash::appliance::Appliance entry;
 
-                if (!parsePbMessage(kfvFieldsValues(t), entry))
+                if (!parsePbMessage(kfvFieldsValues(t), entry, parse_stat))
                 {
                     SWSS_LOG_ERROR("Requires protobuff at appliance :%s", appliance_id.c_str());
                     writeResultToDB(dash_appliance_result_table_, appliance_id, DASH_RESULT_FAILURE);
@@ -522,6 +526,8 @@ void DashOrch::doTaskRoutingTypeTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
     while (it != consumer.m_toSync.end())
@@ -550,7 +556,7 @@ void DashOrch::doTaskRoutingTypeTable(ConsumerBase& consumer)
             {
                 dash::route_type::RouteType entry;
 
-                if (!parsePbMessage(kfvFieldsValues(t), entry))
+                if (!parsePbMessage(kfvFieldsValues(t), entry, parse_stat))
                 {
                     SWSS_LOG_ERROR("Requires protobuff at routing type :%s", routing_type_str.c_str());
                     writeResultToDB(dash_routing_type_result_table_, routing_type_str, DASH_RESULT_FAILURE);
@@ -620,10 +626,11 @@ bool DashOrch::setEniAdminState(const string& eni, const EniEntry& entry)
     return true;
 }
 
-bool DashOrch::addEniObject(const string& eni, EniEntry& entry)
+bool DashOrch::addEniObject(const string& eni, EniBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
+    EniEntry &entry = ctxt.entry;
     const string &vnet = entry.metadata.vnet();
 
     if (!vnet.empty() && gVnetNameToId.find(vnet) == gVnetNameToId.end())
@@ -663,7 +670,6 @@ bool DashOrch::addEniObject(const string& eni, EniEntry& entry)
         }
     }
 
-    sai_object_id_t &eni_id = entry.eni_id;
     sai_attribute_t eni_attr;
     vector<sai_attribute_t> eni_attrs;
 
@@ -792,24 +798,36 @@ bool DashOrch::addEniObject(const string& eni, EniEntry& entry)
         eni_attrs.push_back(eni_attr);
     }
 
-    sai_status_t status = sai_dash_eni_api->create_eni(&eni_id, gSwitchId,
-                                (uint32_t)eni_attrs.size(), eni_attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
+    eni_bulker_.create_entry(&entry.eni_id, (uint32_t)eni_attrs.size(), eni_attrs.data());
+
+    return true;
+}
+
+bool DashOrch::addEniObjectPost(const string& eni, const EniBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    const EniEntry &entry = ctxt.entry;
+    sai_object_id_t eni_id = entry.eni_id;
+    if (eni_id == SAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_ERROR("Failed to create ENI object for %s", eni.c_str());
-        task_process_status handle_status = handleSaiCreateStatus((sai_api_t) SAI_API_DASH_ENI, status);
-        if (handle_status != task_success)
-        {
-            return false;
-        }
+        return false;
     }
 
+    // Counters are installed by the flush at the end of the batch
     addEniMapEntry(eni_id, eni);
     EniCounter.addToFC(eni_id, eni);
     MeterCounter.addToFC(eni_id, eni);
 
     gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_DASH_ENI);
 
+    DashMeterOrch *dash_meter_orch = gDirectory.get<DashMeterOrch*>();
+    const string &v4_meter_policy  = entry.metadata.has_v4_meter_policy_id() ?
+                                     entry.metadata.v4_meter_policy_id() : "";
+    const string &v6_meter_policy  = entry.metadata.has_v6_meter_policy_id() ?
+                                     entry.metadata.v6_meter_policy_id() : "";
+
     if (!v4_meter_policy.empty())
     {
         dash_meter_orch->incrMeterPolicyEniBindCount(v4_meter_policy);
@@ -824,24 +842,36 @@ bool DashOrch::addEniObject(const string& eni, EniEntry& entry)
     return true;
 }
 
-bool DashOrch::addEniAddrMapEntry(const string& eni, const EniEntry& entry)
+void DashOrch::addEniAddrMapEntry(const string& eni, EniBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
     uint32_t attr_count = 1;
     sai_eni_ether_address_map_entry_t eni_ether_address_map_entry;
     eni_ether_address_map_entry.switch_id = gSwitchId;
-    memcpy(eni_ether_address_map_entry.address, entry.metadata.mac_address().c_str(), sizeof(sai_mac_t));
+    memcpy(eni_ether_address_map_entry.address, ctxt.entry.metadata.mac_address().c_str(), sizeof(sai_mac_t));
 
     sai_attribute_t eni_ether_address_map_entry_attr;
     eni_ether_address_map_entry_attr.id = SAI_ENI_ETHER_ADDRESS_MAP_ENTRY_ATTR_ENI_ID;
-    eni_ether_address_map_entry_attr.value.oid = entry.eni_id;
+    eni_ether_address_map_entry_attr.value.oid = ctxt.entry.eni_id;
+
+    eni_addr_map_bulker_.create_entry(&ctxt.addr_map_status, &eni_ether_address_map_entry, attr_count,
+                                      &eni_ether_address_map_entry_attr);
+}
+
+bool DashOrch::addEniAddrMapEntryPost(const string& eni, const EniBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
 
-    sai_status_t status = sai_dash_eni_api->create_eni_ether_address_map_entry(&eni_ether_address_map_entry, attr_count,
-                                                                                &eni_ether_address_map_entry_attr);
+    const EniEntry &entry = ctxt.entry;
+    sai_status_t status = ctxt.addr_map_status;
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create ENI ether address map entry for %s", MacAddress::to_string(reinterpret_cast<const uint8_t *>(entry.metadata.mac_address().c_str())).c_str());
+        if (status == SAI_STATUS_NOT_EXECUTED)
+        {
+            return false;
+        }
         task_process_status handle_status = handleSaiCreateStatus((sai_api_t) SAI_API_DASH_ENI, status);
         if (handle_status != task_success)
         {
@@ -894,27 +924,41 @@ bool DashOrch::addEniTrustedVnis(const std::string& eni, const EniEntry& entry)
     return success;
 }
 
-bool DashOrch::addEni(const string& eni, EniEntry &entry)
+bool DashOrch::addEni(const string& eni, EniBulkContext& ctxt)
 {
     SWSS_LOG_ENTER();
 
     auto it = eni_entries_.find(eni);
     if (it != eni_entries_.end())
     {
-        bool changed = false;
-        if (it->second.metadata.admin_state() != entry.metadata.admin_state())
+        if (it->second.metadata.admin_state() != ctxt.entry.metadata.admin_state())
         {
             SWSS_LOG_INFO("ENI %s already exists, updating admin state", eni.c_str());
-            return setEniAdminState(eni, entry);
-        }
-        if (!changed)
-        {
-            SWSS_LOG_WARN("ENI %s already exists", eni.c_str());
+            if (!setEniAdminState(eni, ctxt.entry))
+            {
+                ctxt.pre_op_result = DASH_RESULT_FAILURE;
+            }
+            return true;
         }
+        SWSS_LOG_WARN("ENI %s already exists", eni.c_str());
+        return true;
+    }
+
+    if (!addEniObject(eni, ctxt))
+    {
+        ctxt.pre_op_result = DASH_RESULT_FAILURE;
         return true;
     }
 
-    if (!addEniObject(eni, entry))
+    return false;
+}
+
+bool DashOrch::addEniPost(const string& eni, const EniBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    const EniEntry &entry = ctxt.entry;
+    if (!addEniObjectPost(eni, ctxt))
     {
         return false;
     }
@@ -923,7 +967,7 @@ bool DashOrch::addEni(const string& eni, EniEntry &entry)
     // clear out the trusted VNIs list. They will be readded by addEniTrustedVni() after successful creation to ensure that internal cache state is consistent with SAI state
     eni_entries_[eni].metadata.clear_trusted_vnis_list();
 
-    if (!addEniAddrMapEntry(eni, entry))
+    if (!addEniAddrMapEntryPost(eni, ctxt))
     {
         SWSS_LOG_ERROR("Failed to add ENI address map entry for %s. Removing ENI object.", eni.c_str());
         if (!removeEniObject(eni))
@@ -966,7 +1010,6 @@ bool DashOrch::removeEniObject(const string& eni)
     SWSS_LOG_ENTER();
 
     EniEntry entry = eni_entries_[eni];
-    DashMeterOrch *dash_meter_orch = gDirectory.get<DashMeterOrch*>();
 
     sai_status_t status = sai_dash_eni_api->remove_eni(entry.eni_id);
     if (status != SAI_STATUS_SUCCESS)
@@ -984,6 +1027,24 @@ bool DashOrch::removeEniObject(const string& eni)
         }
     }
 
+    releaseEniObject(eni, entry);
+
+    return true;
+}
+
+void DashOrch::removeEniObject(const string& eni, EniBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    eni_bulker_.remove_entry(&ctxt.eni_status, ctxt.entry.eni_id);
+}
+
+void DashOrch::releaseEniObject(const string& eni, const EniEntry& entry)
+{
+    SWSS_LOG_ENTER();
+
+    DashMeterOrch *dash_meter_orch = gDirectory.get<DashMeterOrch*>();
+
     MeterCounter.removeFromFC(entry.eni_id, eni);
     EniCounter.removeFromFC(entry.eni_id, eni);
     removeEniMapEntry(entry.eni_id, eni);
@@ -1005,8 +1066,6 @@ bool DashOrch::removeEniObject(const string& eni)
     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_DASH_ENI);
 
     SWSS_LOG_NOTICE("Removed ENI object for %s", eni.c_str());
-
-    return true;
 }
 
 bool DashOrch::removeEniAddrMapEntry(const string& eni)
@@ -1041,6 +1100,49 @@ bool DashOrch::removeEniAddrMapEntry(const string& eni)
     return true;
 }
 
+void DashOrch::removeEniAddrMapEntry(const string& eni, EniBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    sai_eni_ether_address_map_entry_t eni_ether_address_map_entry;
+    eni_ether_address_map_entry.switch_id = gSwitchId;
+    memcpy(eni_ether_address_map_entry.address, ctxt.entry.metadata.mac_address().c_str(), sizeof(sai_mac_t));
+
+    eni_addr_map_bulker_.remove_entry(&ctxt.addr_map_status, &eni_ether_address_map_entry);
+}
+
+bool DashOrch::removeEniAddrMapEntryPost(const string& eni, const EniBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    sai_status_t status = ctxt.addr_map_status;
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        if (status == SAI_STATUS_ITEM_NOT_FOUND || status == SAI_STATUS_INVALID_PARAMETER)
+        {
+            // Entry might have already been deleted. Do not retry
+            return true;
+        }
+        if (status == SAI_STATUS_NOT_EXECUTED)
+        {
+            SWSS_LOG_ERROR("Failed to remove ENI ether address map entry for %s: remove was not executed", eni.c_str());
+            return false;
+        }
+        SWSS_LOG_ERROR("Failed to remove ENI ether address map entry for %s", eni.c_str());
+        task_process_status handle_status = handleSaiRemoveStatus((sai_api_t) SAI_API_DASH_ENI, status);
+        if (handle_status != task_success)
+        {
+            return false;
+        }
+    }
+
+    gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_DASH_ENI_ETHER_ADDRESS_MAP);
+
+    SWSS_LOG_NOTICE("Removed ENI ether address map entry for %s", eni.c_str());
+
+    return true;
+}
+
 bool DashOrch::removeEniTrustedVnis(const std::string& eni, const EniEntry& entry)
 {
     SWSS_LOG_ENTER();
@@ -1109,44 +1211,185 @@ bool DashOrch::removeEni(const string& eni)
     return true;
 }
 
+bool DashOrch::removeEni(const string& eni, EniBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = eni_entries_.find(eni);
+    if (it == eni_entries_.end())
+    {
+        SWSS_LOG_WARN("ENI %s does not exist", eni.c_str());
+        return true;
+    }
+
+    if (!it->second.metadata.trusted_vnis_list().empty())
+    {
+        bool all_trusted_vnis_removed = removeEniTrustedVnis(eni, it->second);
+        if (!all_trusted_vnis_removed)
+        {
+            SWSS_LOG_ERROR("Failed to remove all trusted vni entries for ENI %s.", eni.c_str());
+            ctxt.pre_op_result = DASH_RESULT_FAILURE;
+            return true;
+        }
+    }
+
+    ctxt.entry = it->second;
+    // The ENI object is removed once its address map entry is gone
+    removeEniAddrMapEntry(eni, ctxt);
+
+    return false;
+}
+
+bool DashOrch::removeEniPost(const string& eni, const EniBulkContext& ctxt)
+{
+    SWSS_LOG_ENTER();
+
+    sai_status_t status = ctxt.eni_status;
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        if (status == SAI_STATUS_NOT_EXECUTED)
+        {
+            SWSS_LOG_ERROR("Failed to remove ENI object for %s: object remove was not executed", eni.c_str());
+            return false;
+        }
+        if (status == SAI_STATUS_OBJECT_IN_USE)
+        {
+            SWSS_LOG_ERROR("Failed to remove ENI object for %s: object in use", eni.c_str());
+            return false;
+        }
+        SWSS_LOG_ERROR("Failed to remove ENI object for %s", eni.c_str());
+        task_process_status handle_status = handleSaiRemoveStatus((sai_api_t) SAI_API_DASH_ENI, status);
+        if (handle_status != task_success)
+        {
+            return false;
+        }
+    }
+
+    releaseEniObject(eni, ctxt.entry);
+    eni_entries_.erase(eni);
+
+    return true;
+}
+
 void DashOrch::doTaskEniTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
-    uint32_t result;
     while (it != consumer.m_toSync.end())
     {
-        KeyOpFieldsValuesTuple t = it->second;
-        string eni = kfvKey(t);
-        string op = kfvOp(t);
+        // ENIs created and removed in this batch, keyed by ENI name
+        std::map<std::string, EniBulkContext> to_create;
+        std::map<std::string, EniBulkContext> to_remove;
 
-        try
+        while (it != consumer.m_toSync.end())
         {
-            result = DASH_RESULT_SUCCESS;
-            if (op == SET_COMMAND)
+            const KeyOpFieldsValuesTuple &tuple = it->second;
+            const string eni = kfvKey(tuple);
+            const string op = kfvOp(tuple);
+
+            // An ENI that is re-created has to wait for its removal to be flushed
+            if (to_create.find(eni) != to_create.end() || to_remove.find(eni) != to_remove.end())
             {
-                EniEntry entry;
+                break;
+            }
 
-                if (!parsePbMessage(kfvFieldsValues(t), entry.metadata))
+            try
+            {
+                if (op == SET_COMMAND)
                 {
-                    SWSS_LOG_ERROR("Requires protobuff at ENI :%s", eni.c_str());
-                    writeResultToDB(dash_eni_result_table_, eni, DASH_RESULT_FAILURE);
-                    it = consumer.m_toSync.erase(it);
-                    continue;
+                    auto& ctxt = to_create[eni];
+
+                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.entry.metadata, parse_stat))
+                    {
+                        SWSS_LOG_ERROR("Requires protobuff at ENI :%s", eni.c_str());
+                        writeResultToDB(dash_eni_result_table_, eni, DASH_RESULT_FAILURE);
+                        to_create.erase(eni);
+                    }
+                    else if (addEni(eni, ctxt))
+                    {
+                        if (ctxt.pre_op_result != DASH_RESULT_SUCCESS)
+                        {
+                            SWSS_LOG_ERROR("Failed to add ENI entry for %s", eni.c_str());
+                        }
+                        writeResultToDB(dash_eni_result_table_, eni, ctxt.pre_op_result);
+                        to_create.erase(eni);
+                    }
+                }
+                else if (op == DEL_COMMAND)
+                {
+                    auto& ctxt = to_remove[eni];
+
+                    if (removeEni(eni, ctxt))
+                    {
+                        if (ctxt.pre_op_result == DASH_RESULT_SUCCESS)
+                        {
+                            removeResultFromDB(dash_eni_result_table_, eni);
+                        }
+                        else
+                        {
+                            SWSS_LOG_ERROR("Failed to remove ENI entry for %s", eni.c_str());
+                        }
+                        to_remove.erase(eni);
+                    }
+                }
+                else
+                {
+                    SWSS_LOG_ERROR("Unknown operation %s", op.c_str());
                 }
+            }
+            catch (const std::exception& e)
+            {
+                SWSS_LOG_ERROR("Exception caught processing %s entry %s: %s", consumer.getTableName().c_str(), eni.c_str(), e.what());
+                writeResultToDB(dash_eni_result_table_, eni, DASH_RESULT_FAILURE);
+                to_create.erase(eni);
+                to_remove.erase(eni);
+            }
+            it = consumer.m_toSync.erase(it);
+        }
 
-                if (!addEni(eni, entry))
+        /*
+         * Address map entries are removed before their ENIs and created after them,
+         * so the batch is flushed in three steps. Failed operations keep their
+         * NOT_EXECUTED or SAI status and are reported by the post handlers.
+         */
+        try
+        {
+            eni_addr_map_bulker_.flush();
+            for (auto& it_remove : to_remove)
+            {
+                if (removeEniAddrMapEntryPost(it_remove.first, it_remove.second))
                 {
-                    SWSS_LOG_ERROR("Failed to add ENI entry for %s", eni.c_str());
-                    result = DASH_RESULT_FAILURE;
+                    removeEniObject(it_remove.first, it_remove.second);
                 }
-                it = consumer.m_toSync.erase(it);
-                writeResultToDB(dash_eni_result_table_, eni, result);
             }
-            else if (op == DEL_COMMAND)
+
+            eni_bulker_.flush();
+            for (auto& it_create : to_create)
             {
-                if (removeEni(eni))
+                if (it_create.second.entry.eni_id != SAI_NULL_OBJECT_ID)
+                {
+                    addEniAddrMapEntry(it_create.first, it_create.second);
+                }
+            }
+
+            eni_addr_map_bulker_.flush();
+        }
+        catch (const std::exception& e)
+        {
+            SWSS_LOG_ERROR("Exception caught flushing %s entries: %s", consumer.getTableName().c_str(), e.what());
+            eni_bulker_.clear();
+            eni_addr_map_bulker_.clear();
+        }
+
+        for (auto& it_remove : to_remove)
+        {
+            const string& eni = it_remove.first;
+            try
+            {
+                if (removeEniPost(eni, it_remove.second))
                 {
                     removeResultFromDB(dash_eni_result_table_, eni);
                 }
@@ -1154,20 +1397,35 @@ void DashOrch::doTaskEniTable(ConsumerBase& consumer)
                 {
                     SWSS_LOG_ERROR("Failed to remove ENI entry for %s", eni.c_str());
                 }
-                it = consumer.m_toSync.erase(it);
             }
-            else
+            catch (const std::exception& e)
             {
-                SWSS_LOG_ERROR("Unknown operation %s", op.c_str());
-                it = consumer.m_toSync.erase(it);
+                SWSS_LOG_ERROR("Exception caught processing %s entry %s: %s", consumer.getTableName().c_str(), eni.c_str(), e.what());
             }
         }
-        catch (const std::exception& e)
+
+        for (auto& it_create : to_create)
         {
-            SWSS_LOG_ERROR("Exception caught processing %s entry %s: %s", consumer.getTableName().c_str(), eni.c_str(), e.what());
-            writeResultToDB(dash_eni_result_table_, eni, DASH_RESULT_FAILURE);
-            it = consumer.m_toSync.erase(it);
+            const string& eni = it_create.first;
+            uint32_t result = DASH_RESULT_SUCCESS;
+            try
+            {
+                if (!addEniPost(eni, it_create.second))
+                {
+                    SWSS_LOG_ERROR("Failed to add ENI entry for %s", eni.c_str());
+                    result = DASH_RESULT_FAILURE;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                SWSS_LOG_ERROR("Exception caught processing %s entry %s: %s", consumer.getTableName().c_str(), eni.c_str(), e.what());
+                result = DASH_RESULT_FAILURE;
+            }
+            writeResultToDB(dash_eni_result_table_, eni, result);
         }
+
+        EniCounter.flush();
+        MeterCounter.flush();
     }
 }
 
@@ -1202,6 +1460,8 @@ bool DashOrch::removeQosEntry(const string& qos_name)
 
 void DashOrch::doTaskQosTable(ConsumerBase& consumer)
 {
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
     while (it != consumer.m_toSync.end())
@@ -1218,7 +1478,7 @@ void DashOrch::doTaskQosTable(ConsumerBase& consumer)
             {
                 dash::qos::Qos entry;
 
-                if (!parsePbMessage(kfvFieldsValues(t), entry))
+                if (!parsePbMessage(kfvFieldsValues(t), entry, parse_stat))
                 {
                     SWSS_LOG_ERROR("Requires protobuff at QOS :%s", qos_name.c_str());
                     writeResultToDB(dash_qos_result_table_, qos_name, DASH_RESULT_FAILURE);
@@ -1265,7 +1525,6 @@ bool DashOrch::setEniRoute(const std::string& eni, const dash::eni_route::EniRou
 {
     SWSS_LOG_ENTER();
 
-
     if (eni_entries_.find(eni) == eni_entries_.end())
     {
         SWSS_LOG_ERROR("ENI %s not yet created, cannot program ENI route entry", eni.c_str());
@@ -1363,6 +1622,8 @@ bool DashOrch::removeEniRoute(const std::string& eni)
 
 void DashOrch::doTaskEniRouteTable(ConsumerBase& consumer)
 {
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
     while (it != consumer.m_toSync.end())
@@ -1379,7 +1640,7 @@ void DashOrch::doTaskEniRouteTable(ConsumerBase& consumer)
             {
                 dash::eni_route::EniRoute entry;
 
-                if (!parsePbMessage(kfvFieldsValues(t), entry))
+                if (!parsePbMessage(kfvFieldsValues(t), entry, parse_stat))
                 {
                     SWSS_LOG_ERROR("Requires protobuf at ENI route:%s", eni.c_str());
                     writeResultToDB(dash_eni_route_result_table_, eni, DASH_RESULT_FAILURE);
@@ -46,6 +46,22 @@ struct EniEntry
 
 typedef std::map<std::string, EniEntry> EniTable;
 
+struct EniBulkContext
+{
+    EniEntry entry;
+    sai_status_t addr_map_status = SAI_STATUS_NOT_EXECUTED;
+    sai_status_t eni_status = SAI_STATUS_NOT_EXECUTED;
+    uint32_t pre_op_result = DASH_RESULT_SUCCESS;
+
+    EniBulkContext()
+    {
+        entry.eni_id = SAI_NULL_OBJECT_ID;
+    }
+
+    EniBulkContext(const EniBulkContext&) = delete;
+    EniBulkContext(EniBulkContext&&) = delete;
+};
+
 using DashEniCounter = DashCounter<CounterType::ENI, EniTable>;
 using DashMeterCounter = DashCounter<CounterType::DASH_METER, EniTable>;
 
@@ -82,6 +98,8 @@ private:
     std::unique_ptr<swss::Table> dash_appliance_result_table_;
     std::unique_ptr<swss::Table> dash_eni_route_result_table_;
     std::unique_ptr<swss::Table> dash_routing_type_result_table_;
+    ObjectBulker<sai_dash_eni_api_t> eni_bulker_;
+    EntityBulker<sai_dash_eni_api_t> eni_addr_map_bulker_;
     void doTask(ConsumerBase &consumer);
     void doTaskApplianceTable(ConsumerBase &consumer);
     void doTaskRoutingTypeTable(ConsumerBase &consumer);
@@ -96,14 +114,24 @@ private:
     bool removeApplianceTrustedVni(const std::string& appliance_id, const dash::appliance::Appliance& entry);
     bool addRoutingTypeEntry(const dash::route_type::RoutingType &routing_type, const dash::route_type::RouteType &entry);
     bool removeRoutingTypeEntry(const dash::route_type::RoutingType &routing_type);
-    bool addEniObject(const std::string& eni, EniEntry& entry);
-    bool addEniAddrMapEntry(const std::string& eni, const EniEntry& entry);
+    bool addEniObject(const std::string& eni, EniBulkContext& ctxt);
+    bool addEniObjectPost(const std::string& eni, const EniBulkContext& ctxt);
+    void addEniAddrMapEntry(const std::string& eni, EniBulkContext& ctxt);
+    bool addEniAddrMapEntryPost(const std::string& eni, const EniBulkContext& ctxt);
     bool addEniTrustedVnis(const std::string& eni, const EniEntry& entry);
-    bool addEni(const std::string& eni, EniEntry &entry);
+    bool addEni(const std::string& eni, EniBulkContext& ctxt);
+    bool addEniPost(const std::string& eni, const EniBulkContext& ctxt);
+    void removeEniObject(const std::string& eni, EniBulkContext& ctxt);
+    void removeEniAddrMapEntry(const std::string& eni, EniBulkContext& ctxt);
+    bool removeEniAddrMapEntryPost(const std::string& eni, const EniBulkContext& ctxt);
+    bool removeEni(const std::string& eni, EniBulkContext& ctxt);
+    bool removeEniPost(const std::string& eni, const EniBulkContext& ctxt);
+    // Single object removal, used to roll back a partially created ENI
     bool removeEniObject(const std::string& eni);
     bool removeEniAddrMapEntry(const std::string& eni);
     bool removeEniTrustedVnis(const std::string& eni, const EniEntry& entry);
     bool removeEni(const std::string& eni);
+    void releaseEniObject(const std::string& eni, const EniEntry& entry);
     bool setEniAdminState(const std::string& eni, const EniEntry& entry);
     bool addQosEntry(const std::string& qos_name, const dash::qos::Qos &entry);
     bool removeQosEntry(const std::string& qos_name);
@@ -316,6 +316,8 @@ void DashPortMapOrch::doTaskPortMapRangeTable(ConsumerBase &consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
 
@@ -353,7 +355,7 @@ void DashPortMapOrch::doTaskPortMapRangeTable(ConsumerBase &consumer)
 
             if (op == SET_COMMAND)
             {
-                if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata, parse_stat))
                 {
                     SWSS_LOG_ERROR("Failed to parse protobuf message for port map range %s", key.c_str());
                     writeResultToDB(dash_port_map_range_result_table_, key, DASH_RESULT_FAILURE);
@@ -313,6 +313,8 @@ void DashRouteOrch::doTaskRouteTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
     while (it != consumer.m_toSync.end())
@@ -322,8 +324,8 @@ void DashRouteOrch::doTaskRouteTable(ConsumerBase& consumer)
 
         while (it != consumer.m_toSync.end())
         {
-            KeyOpFieldsValuesTuple tuple = it->second;
-            const string& key = kfvKey(tuple);
+            const KeyOpFieldsValuesTuple &tuple = it->second;
+            const string key = kfvKey(tuple);
             auto op = kfvOp(tuple);
 
             try
@@ -352,7 +354,7 @@ void DashRouteOrch::doTaskRouteTable(ConsumerBase& consumer)
 
                 if (op == SET_COMMAND)
                 {
-                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata, parse_stat))
                     {
                         SWSS_LOG_ERROR("Requires protobuff at OutboundRouting :%s", key.c_str());
                         writeResultToDB(dash_route_result_table_, key, DASH_RESULT_FAILURE);
@@ -615,6 +617,8 @@ void DashRouteOrch::doTaskRouteRuleTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
     while (it != consumer.m_toSync.end())
@@ -624,8 +628,8 @@ void DashRouteOrch::doTaskRouteRuleTable(ConsumerBase& consumer)
 
         while (it != consumer.m_toSync.end())
         {
-            KeyOpFieldsValuesTuple tuple = it->second;
-            const string& key = kfvKey(tuple);
+            const KeyOpFieldsValuesTuple &tuple = it->second;
+            const string key = kfvKey(tuple);
             auto op = kfvOp(tuple);
 
             try
@@ -681,7 +685,7 @@ void DashRouteOrch::doTaskRouteRuleTable(ConsumerBase& consumer)
 
                 if (op == SET_COMMAND)
                 {
-                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata, parse_stat))
                     {
                         SWSS_LOG_ERROR("Requires protobuff at InboundRouting :%s", key.c_str());
                         writeResultToDB(dash_route_rule_result_table_, key, DASH_RESULT_FAILURE);
@@ -905,6 +909,8 @@ void DashRouteOrch::doTaskRouteGroupTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
     while (it != consumer.m_toSync.end())
@@ -919,7 +925,7 @@ void DashRouteOrch::doTaskRouteGroupTable(ConsumerBase& consumer)
             if (op == SET_COMMAND)
             {
                 dash::route_group::RouteGroup entry;
-                if (!parsePbMessage(kfvFieldsValues(t), entry))
+                if (!parsePbMessage(kfvFieldsValues(t), entry, parse_stat))
                 {
                     SWSS_LOG_ERROR("Requires protobuf at RouteGroup :%s", route_group.c_str());
                     writeResultToDB(dash_route_group_result_table_, route_group, DASH_RESULT_FAILURE);
@@ -67,6 +67,12 @@ task_process_status DashTagMgr::update(const string& tag_id, const DashTag& new_
     // Update tag prefixes
     tag.m_prefixes = new_tag.m_prefixes;
 
+    // The rules of the groups using the tag are rebuilt in a shadow group
+    for (const auto& group_id : tag.m_groups)
+    {
+        m_dash_acl_orch->getDashAclGroupMgr().onTagUpdate(group_id);
+    }
+
     return task_success;
 }
 
@@ -94,6 +94,8 @@ void DashTunnelOrch::doTask(ConsumerBase &consumer)
     */
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     const auto& tn = consumer.getTableName();
     uint32_t result;
     SWSS_LOG_INFO("doTask: %s", tn.c_str());
@@ -129,7 +131,7 @@ void DashTunnelOrch::doTask(ConsumerBase &consumer)
                 }
                 if (op == SET_COMMAND)
                 {
-                    if (!parsePbMessage(kfvFieldsValues(t), ctxt.metadata))
+                    if (!parsePbMessage(kfvFieldsValues(t), ctxt.metadata, parse_stat))
                     {
                         SWSS_LOG_ERROR("Requires protobuf at Tunnel :%s", tunnel_name.c_str());
                         writeResultToDB(dash_tunnel_result_table_, tunnel_name, DASH_RESULT_FAILURE);
@@ -189,6 +189,8 @@ void DashVnetOrch::doTaskVnetTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
     while (it != consumer.m_toSync.end())
@@ -199,8 +201,8 @@ void DashVnetOrch::doTaskVnetTable(ConsumerBase& consumer)
 
         while (it != consumer.m_toSync.end())
         {
-            KeyOpFieldsValuesTuple tuple = it->second;
-            const string& key = kfvKey(tuple);
+            const KeyOpFieldsValuesTuple &tuple = it->second;
+            const string key = kfvKey(tuple);
             auto op = kfvOp(tuple);
 
             try
@@ -219,7 +221,7 @@ void DashVnetOrch::doTaskVnetTable(ConsumerBase& consumer)
                 vnet_ctxt.vnet_name = key;
                 if (op == SET_COMMAND)
                 {
-                    if (!parsePbMessage(kfvFieldsValues(tuple), vnet_ctxt.metadata))
+                    if (!parsePbMessage(kfvFieldsValues(tuple), vnet_ctxt.metadata, parse_stat))
                     {
                         SWSS_LOG_ERROR("Requires protobuff at Vnet :%s", key.c_str());
                         writeResultToDB(dash_vnet_result_table_, key, DASH_RESULT_FAILURE);
@@ -759,6 +761,8 @@ void DashVnetOrch::doTaskVnetMapTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    ExecutorStat &parse_stat = getPbParseStat(consumer.getTableName());
+
     auto it = consumer.m_toSync.begin();
     uint32_t result;
     while (it != consumer.m_toSync.end())
@@ -768,8 +772,8 @@ void DashVnetOrch::doTaskVnetMapTable(ConsumerBase& consumer)
 
         while (it != consumer.m_toSync.end())
         {
-            KeyOpFieldsValuesTuple tuple = it->second;
-            const string& key = kfvKey(tuple);
+            const KeyOpFieldsValuesTuple &tuple = it->second;
+            const string key = kfvKey(tuple);
             auto op = kfvOp(tuple);
 
             try
@@ -797,7 +801,7 @@ void DashVnetOrch::doTaskVnetMapTable(ConsumerBase& consumer)
 
                 if (op == SET_COMMAND)
                 {
-                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                    if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata, parse_stat))
                     {
                         SWSS_LOG_ERROR("Requires protobuff at VnetMap :%s", key.c_str());
                         writeResultToDB(dash_vnet_map_result_table_, key, DASH_RESULT_FAILURE);
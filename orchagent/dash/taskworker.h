@@ -1,11 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <map>
 #include <string>
 #include <tuple>
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/message.h>
 
 #include <swss/logger.h>
@@ -13,6 +15,7 @@
 #include <swss/rediscommand.h>
 
 #include <orch.h>
+#include <taskstats.h>
 
 class TaskWorker
 {
@@ -20,6 +23,9 @@ public:
     virtual task_process_status process(
         const std::string &key,
         const std::vector<swss::FieldValueTuple> &data) = 0;
+
+    // Called once the entries of a consumer drain have been processed
+    virtual void drained() {}
 };
 
 using TaskKey = std::tuple<const std::string, const std::string>;
@@ -28,6 +34,13 @@ using TaskMap = std::map<TaskKey, TaskFunc>;
 
 #define PbIdentifier "pb"
 
+// Time spent decoding the protobuf messages of a table, reported with the orch task stats
+inline ExecutorStat &getPbParseStat(const std::string &table)
+{
+    return getOrchOpStats()[table + ":pb_parse"];
+}
+
+// Parses the message in place from the field value, without copying the serialized message
 template<typename MessageType>
 bool parsePbMessage(
     const std::vector<swss::FieldValueTuple> &data,
@@ -35,33 +48,58 @@ bool parsePbMessage(
 {
     SWSS_LOG_ENTER();
 
-    auto pb = swss::fvsGetValue(data, PbIdentifier);
-    if (pb)
+    for (const auto &fv : data)
     {
-        if (msg.ParseFromString(*pb))
+        if (fvField(fv) != PbIdentifier)
         {
-            return true;
+            continue;
         }
-        else
+
+        const auto &pb = fvValue(fv);
+        if (msg.ParseFromArray(pb.data(), static_cast<int>(pb.size())))
         {
-            SWSS_LOG_WARN("Failed to parse protobuf message from string: %s", pb->c_str());
+            return true;
         }
+
+        SWSS_LOG_WARN("Failed to parse protobuf message from string: %s", pb.c_str());
+        return false;
     }
-    else
-    {
-        SWSS_LOG_WARN("Protobuf field cannot be found");
-    }
+
+    SWSS_LOG_WARN("Protobuf field cannot be found");
 
     return false;
 }
 
+template<typename MessageType>
+bool parsePbMessage(
+    const std::vector<swss::FieldValueTuple> &data,
+    MessageType &msg,
+    ExecutorStat &parse_stat)
+{
+    auto start = std::chrono::steady_clock::now();
+    bool ret = parsePbMessage(data, msg);
+    parse_stat.record_run(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count()));
+
+    return ret;
+}
+
+/*
+ * Decodes every entry into the same message, allocated on an arena which is
+ * released once the consumer is drained: the nested messages and strings
+ * of a message are reused by the next entry instead of being reallocated.
+ */
 template<typename MessageType>
 class PbWorker : public TaskWorker
 {
 public:
     using Task = std::function<task_process_status(const std::string &, const MessageType &)>;
 
-    PbWorker(const Task &func) : m_func(func) {}
+    PbWorker(const std::string &table, const Task &func) :
+        m_func(func),
+        m_parse_stat(getPbParseStat(table))
+    {
+    }
 
     virtual task_process_status process(
             const std::string &key,
@@ -69,10 +107,18 @@ public:
     {
         SWSS_LOG_ENTER();
 
-        MessageType msg;
-        if (parsePbMessage(data, msg))
+        if (m_msg == nullptr)
         {
-            return m_func(key, msg);
+            m_msg = google::protobuf::Arena::CreateMessage<MessageType>(&m_arena);
+        }
+        else
+        {
+            m_msg->Clear();
+        }
+
+        if (parsePbMessage(data, *m_msg, m_parse_stat))
+        {
+            return m_func(key, *m_msg);
         }
         else
         {
@@ -82,6 +128,12 @@ public:
         return task_process_status::task_invalid_entry;
     }
 
+    virtual void drained()
+    {
+        m_msg = nullptr;
+        m_arena.Reset();
+    }
+
     template<typename MemberFunc, typename ObjType>
     static TaskMap::value_type makeMemberTask(
         const std::string &table,
@@ -92,11 +144,14 @@ public:
         return std::make_pair(
             std::make_tuple(table, op),
             std::make_shared<PbWorker<MessageType> >(
-                std::bind(func, obj, std::placeholders::_1, std::placeholders::_2)));
+                table, std::bind(func, obj, std::placeholders::_1, std::placeholders::_2)));
     }
 
 private:
      Task m_func;
+     ExecutorStat &m_parse_stat;
+     google::protobuf::Arena m_arena;
+     MessageType *m_msg = nullptr;
 };
 
 class KeyOnlyWorker : public TaskWorker
@@ -38,7 +38,8 @@ FdbOrch::FdbOrch(DBConnector* applDbConnector, vector<table_name_with_pri_t> app
     DBConnector* configDb) :
     Orch(applDbConnector, appFdbTables),
     m_portsOrch(port),
-    m_fdbStateTable(stateDbFdbConnector.first, stateDbFdbConnector.second),
+    m_stateDbPipeline(stateDbFdbConnector.first),
+    m_fdbStateTable(&m_stateDbPipeline, stateDbFdbConnector.second, false),
     m_mclagFdbStateTable(stateDbMclagFdbConnector.first, stateDbMclagFdbConnector.second)
 {
     for(auto it: appFdbTables)
@@ -46,6 +47,13 @@ FdbOrch::FdbOrch(DBConnector* applDbConnector, vector<table_name_with_pri_t> app
         m_appTables.push_back(new Table(applDbConnector, it.first));
     }
 
+    /* bake() refills the FDB consumer from the STATE_DB FDB table too */
+    auto fdbConsumer = dynamic_cast<ConsumerBase *>(getExecutor(APP_FDB_TABLE_NAME));
+    if (fdbConsumer != NULL)
+    {
+        fdbConsumer->addRefillTable(&m_fdbStateTable, stateDbFdbConnector.first);
+    }
+
     m_portsOrch->attach(this);
     m_flushNotificationsConsumer = new NotificationConsumer(applDbConnector, "FLUSHFDBREQUEST");
     m_flushNotificationsConsumer->setOpAllowList({"ALL", "PORT", "VLAN", "PORTVLAN"});
@@ -163,7 +171,7 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
             oldFdbData = it->second;
 
             //Remove the existing entry since its port_name may be changed
-            (void)m_entries.erase(entry);
+            eraseFdbEntry(entry);
         }
 
         fdbdata.bridge_port_id = update.port.m_bridge_port_id;
@@ -175,11 +183,11 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
         fdbdata.esi = "";
         fdbdata.vni = 0;
 
-        m_entries[entry] = fdbdata;
+        setFdbEntry(entry, fdbdata);
         SWSS_LOG_INFO("FdbOrch notification: mac %s was inserted in port %s into bv_id 0x%" PRIx64,
                         entry.mac.to_string().c_str(), portName.c_str(), entry.bv_id);
         SWSS_LOG_INFO("m_entries size=%zu mac=%s port=0x%" PRIx64,
-            m_entries.size(), entry.mac.to_string().c_str(),  m_entries[entry].bridge_port_id);
+            m_entries.size(), entry.mac.to_string().c_str(),  fdbdata.bridge_port_id);
 
         if (mac_move && (oldFdbData.origin == FDB_ORIGIN_MCLAG_ADVERTIZED))
         {
@@ -208,7 +216,8 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
             oldFdbData = it->second;
         }
 
-        size_t erased = m_entries.erase(entry);
+        size_t erased = m_entries.count(entry);
+        eraseFdbEntry(entry);
         SWSS_LOG_DEBUG("FdbOrch notification: mac %s was removed from bv_id 0x%" PRIx64, entry.mac.to_string().c_str(), entry.bv_id);
 
         if (erased == 0)
@@ -311,57 +320,28 @@ void FdbOrch::handleSyncdFlushNotif(const sai_object_id_t& bv_id,
             }
         }
     }
-    else if (bv_id == SAI_NULL_OBJECT_ID)
+    else
     {
-        /* FLUSH based on PORT */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+        /* FLUSH based on PORT, BV_ID or both */
+        for (const auto &key : getFdbEntries(bridge_port_id, bv_id))
         {
-            auto curr = itr++;
-            if (curr->second.bridge_port_id == bridge_port_id)
+            auto curr = m_entries.find(key);
+            if (curr == m_entries.end())
             {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first, curr->second);
-                }
+                continue;
             }
-        }
-    }
-    else if (bridge_port_id == SAI_NULL_OBJECT_ID)
-    {
-        /* FLUSH based on BV_ID */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
-        {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id)
+
+            if (curr->second.sai_fdb_type == sai_fdb_type &&
+                (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
             {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first, curr->second);
-                }
+                SWSS_LOG_DEBUG("Try to handle flush for FDB entry %s", curr->first.mac.to_string().c_str());
+                clearFdbEntry(curr->first, curr->second);
             }
-        }
-    }
-    else
-    {
-        /* FLUSH based on port and VLAN */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
-        {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id && curr->second.bridge_port_id == bridge_port_id)
+            else if (bridge_port_id != SAI_NULL_OBJECT_ID && bv_id != SAI_NULL_OBJECT_ID &&
+                     curr->first.mac == mac)
             {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    SWSS_LOG_DEBUG("Try to handle flush for FDB entry %s", mac.to_string().c_str());
-                    clearFdbEntry(curr->first, curr->second);
-                }
-                else if (curr->first.mac == mac)
-                {
-                    /* Unexpected, leave a warning message for future to improve if we hit this case */
-                    SWSS_LOG_WARN("Failed to handle flush for FDB entry %s", mac.to_string().c_str());
-               }
+                /* Unexpected, leave a warning message for future to improve if we hit this case */
+                SWSS_LOG_WARN("Failed to handle flush for FDB entry %s", mac.to_string().c_str());
             }
         }
     }
@@ -544,7 +524,7 @@ void FdbOrch::update(sai_fdb_event_t        type,
                 SWSS_LOG_INFO("update: EVPN_MH_UC: remote mac entry exists for this Received LEARN event for bvid=0x%" PRIx64 "mac=%s port=0x%" PRIx64, entry->bv_id, update.entry.mac.to_string().c_str(), bridge_port_id);
                 if (existing_entry->second.dest_type == FdbDest::IFNAME && existing_entry->second.type == "dynamic" && bridge_port_id == existing_entry->second.bridge_port_id) {
                     SWSS_LOG_NOTICE("update: EVPN_MH_UC: C -> (C+D) transition bvid=0x%" PRIx64 "mac=%s port=0x%" PRIx64, entry->bv_id, update.entry.mac.to_string().c_str(), bridge_port_id);
-                    m_entries[update.entry].type = "dynamic";
+                    existing_entry->second.type = "dynamic";
                     return;
                 }
                 SWSS_LOG_INFO("FdbOrch LEARN notification: mac %s is already in bv_id 0x%"
@@ -725,8 +705,8 @@ void FdbOrch::update(sai_fdb_event_t        type,
                 SWSS_LOG_NOTICE("update: EVPN_MH_UC: ageout (C+D) -> C, type %s FDB %s in %s on %s",
                         existing_entry->second.type.c_str(), update.entry.mac.to_string().c_str(),
                         vlan.m_alias.c_str(), update.port.m_alias.c_str());
-                m_entries[update.entry].type = "dynamic";
-                m_entries[update.entry].origin = FDB_ORIGIN_VXLAN_ADVERTIZED;
+                existing_entry->second.type = "dynamic";
+                existing_entry->second.origin = FDB_ORIGIN_VXLAN_ADVERTIZED;
 
                 Port vlan;
                 if (!m_portsOrch->getPort(update.entry.bv_id, vlan))
@@ -1285,15 +1265,55 @@ void FdbOrch::doTask(NotificationConsumer& consumer)
     std::deque<KeyOpFieldsValuesTuple> entries;
     consumer.pops(entries);
 
-    if (&consumer == m_fdbNotificationConsumer && entries.size() > 1000)
+    if (&consumer != m_fdbNotificationConsumer)
     {
-        SWSS_LOG_WARN("FDB notification batch: %zu entries drained", entries.size());
+        for (auto& entry : entries)
+        {
+            handleNotification(consumer, entry);
+        }
+        return;
     }
 
+    uint64_t dropped = m_droppedRelearns;
+    m_fdbOverload = (entries.size() >= FDB_NOTIF_OVERLOAD_THRESHOLD);
+
+    /* STATE_DB FDB writes of the whole batch go out in one pipeline flush */
+    m_fdbStateTable.setBuffered(true);
     for (auto& entry : entries)
     {
         handleNotification(consumer, entry);
     }
+    m_fdbStateTable.flush();
+    m_fdbStateTable.setBuffered(false);
+
+    if (m_fdbOverload)
+    {
+        SWSS_LOG_WARN("FDB notification batch: %zu entries drained, %" PRIu64 " redundant learns dropped",
+                      entries.size(), m_droppedRelearns - dropped);
+    }
+    m_fdbOverload = false;
+}
+
+/*
+ * A LEARN for a MAC already learnt locally on the same bridge port changes
+ * nothing; under overload such repeats are dropped within the relearn window.
+ */
+bool FdbOrch::isRedundantLearn(const sai_fdb_entry_t& entry, sai_object_id_t bridge_port_id)
+{
+    FdbEntry key;
+    key.mac = entry.mac_address;
+    key.bv_id = entry.bv_id;
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end() ||
+        it->second.origin != FDB_ORIGIN_LEARN ||
+        it->second.bridge_port_id != bridge_port_id)
+    {
+        return false;
+    }
+
+    return (chrono::steady_clock::now() - it->second.last_learn <
+            chrono::milliseconds(FDB_RELEARN_WINDOW_MS));
 }
 
 void FdbOrch::handleNotification(NotificationConsumer& consumer, const KeyOpFieldsValuesTuple& entry)
@@ -1437,7 +1457,27 @@ void FdbOrch::handleNotification(NotificationConsumer& consumer, const KeyOpFiel
                 }
             }
 
+            if (fdbevent[i].event_type == SAI_FDB_EVENT_LEARNED && m_fdbOverload &&
+                isRedundantLearn(fdbevent[i].fdb_entry, oid))
+            {
+                m_droppedRelearns++;
+                continue;
+            }
+
             this->update(fdbevent[i].event_type, &fdbevent[i].fdb_entry, oid, sai_fdb_type);
+
+            if (fdbevent[i].event_type == SAI_FDB_EVENT_LEARNED)
+            {
+                FdbEntry key;
+                key.mac = fdbevent[i].fdb_entry.mac_address;
+                key.bv_id = fdbevent[i].fdb_entry.bv_id;
+
+                auto it = m_entries.find(key);
+                if (it != m_entries.end())
+                {
+                    it->second.last_learn = chrono::steady_clock::now();
+                }
+            }
         }
 
         sai_deserialize_free_fdb_event_ntf(count, fdbevent);
@@ -1506,14 +1546,9 @@ void FdbOrch::flushFDBEntries(sai_object_id_t bridge_port_oid,
     }
 
     if (SAI_STATUS_SUCCESS == rv) {
-        for (map<FdbEntry, FdbData>::iterator it = m_entries.begin();
-                it != m_entries.end(); it++)
+        for (const auto &key : getFdbEntries(bridge_port_oid, vlan_oid))
         {
-            if ((!bridge_port_exist || it->second.bridge_port_id == bridge_port_oid) &&
-                (!vlan_exist || it->first.bv_id == vlan_oid))
-            {
-                it->second.is_flush_pending = true;
-            }
+            m_entries.at(key).is_flush_pending = true;
         }
     }
 }
@@ -1580,11 +1615,10 @@ void FdbOrch::flushAllFDBEntries(sai_object_id_t bridge_port_oid,
         {
             SWSS_LOG_NOTICE("Try to flushAllFDB for port %s of type %d, bridge_port_id 0x%" PRIx64, port.m_alias.c_str(), port.m_type, bridge_port_oid);
             /* Try to remove all remote FDB under this tunnel port one by one */
-            for (auto itr = m_entries.begin(); itr != m_entries.end();)
+            for (const auto &key : getFdbEntries(bridge_port_oid, vlan_oid))
             {
-                auto curr = itr++;
-                if ((curr->second.bridge_port_id == bridge_port_oid) &&
-                    (!vlan_exist || (curr->first.bv_id == vlan_oid)))
+                auto curr = m_entries.find(key);
+                if (curr != m_entries.end())
                 {
                     SWSS_LOG_DEBUG("FdbOrch flush tunnel port: mac=%s bv_id=0x%" PRIx64 " origin %d", curr->first.mac.to_string().c_str(), curr->first.bv_id, curr->second.origin);
 
@@ -1629,7 +1663,7 @@ void FdbOrch::flushAllFDBEntries(sai_object_id_t bridge_port_oid,
                         m_portsOrch->setPort(vlan.m_alias, vlan);
                     }
 
-                    (void)m_entries.erase(curr);
+                    eraseFdbEntry(entry);
                     removeFdbEntryFromPortCache(entry, port);
 
                     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_FDB_ENTRY);
@@ -1663,14 +1697,9 @@ void FdbOrch::flushAllFDBEntries(sai_object_id_t bridge_port_oid,
     }
 
     if (SAI_STATUS_SUCCESS == rv) {
-        for (map<FdbEntry, FdbData>::iterator it = m_entries.begin();
-                it != m_entries.end(); it++)
+        for (const auto &key : getFdbEntries(bridge_port_oid, vlan_oid))
         {
-            if ((!bridge_port_exist || it->second.bridge_port_id == bridge_port_oid) &&
-                (!vlan_exist || it->first.bv_id == vlan_oid))
-            {
-                it->second.is_flush_pending = true;
-            }
+            m_entries.at(key).is_flush_pending = true;
         }
     }
 }
@@ -1709,16 +1738,16 @@ void FdbOrch::notifyObserversFDBFlush(Port &port, sai_object_id_t& bvid)
     FdbFlushUpdate flushUpdate;
     flushUpdate.port = port;
 
-    for (auto itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+    for (const auto &key : getFdbEntries(SAI_NULL_OBJECT_ID, bvid))
     {
-        if ((itr->first.port_name == port.m_alias) &&
-            (itr->first.bv_id == bvid))
+        if ((key.port_name == port.m_alias) &&
+            (key.bv_id == bvid))
         {
             SWSS_LOG_INFO("Adding MAC learnt on [ port:%s , bvid:0x%" PRIx64 "]\
                            to ARP flush", port.m_alias.c_str(), bvid);
             FdbEntry entry;
-            entry.mac = itr->first.mac;
-            entry.bv_id = itr->first.bv_id;
+            entry.mac = key.mac;
+            entry.bv_id = key.bv_id;
             flushUpdate.entries.push_back(entry);
         }
     }
@@ -1827,6 +1856,112 @@ void FdbOrch::removeFdbEntryFromPortCache(const FdbEntry& entry, const Port& por
     }
 }
 
+/*
+ * Store entry in m_entries and keep the bridge port and bv_id indexes in
+ * sync, including when an existing entry moves to another bridge port.
+ */
+void FdbOrch::setFdbEntry(const FdbEntry& entry, const FdbData& fdbData)
+{
+    auto it = m_entries.find(entry);
+    if (it != m_entries.end() && it->second.bridge_port_id != fdbData.bridge_port_id)
+    {
+        auto port_idx = m_entries_by_bridge_port.find(it->second.bridge_port_id);
+        if (port_idx != m_entries_by_bridge_port.end())
+        {
+            port_idx->second.erase(entry);
+            if (port_idx->second.empty())
+            {
+                m_entries_by_bridge_port.erase(port_idx);
+            }
+        }
+    }
+
+    m_entries[entry] = fdbData;
+    m_entries_by_bridge_port[fdbData.bridge_port_id].insert(entry);
+    m_entries_by_bv_id[entry.bv_id].insert(entry);
+}
+
+void FdbOrch::eraseFdbEntry(const FdbEntry& entry)
+{
+    auto it = m_entries.find(entry);
+    if (it == m_entries.end())
+    {
+        return;
+    }
+
+    auto port_idx = m_entries_by_bridge_port.find(it->second.bridge_port_id);
+    if (port_idx != m_entries_by_bridge_port.end())
+    {
+        port_idx->second.erase(entry);
+        if (port_idx->second.empty())
+        {
+            m_entries_by_bridge_port.erase(port_idx);
+        }
+    }
+
+    auto vlan_idx = m_entries_by_bv_id.find(entry.bv_id);
+    if (vlan_idx != m_entries_by_bv_id.end())
+    {
+        vlan_idx->second.erase(entry);
+        if (vlan_idx->second.empty())
+        {
+            m_entries_by_bv_id.erase(vlan_idx);
+        }
+    }
+
+    m_entries.erase(it);
+}
+
+/*
+ * Keys of the entries on bridge_port_id and/or in bv_id; a SAI_NULL_OBJECT_ID
+ * matches any value and all keys are returned when both are null. The keys are
+ * copied so the caller may remove entries while walking them.
+ */
+vector<FdbEntry> FdbOrch::getFdbEntries(sai_object_id_t bridge_port_id, sai_object_id_t bv_id)
+{
+    vector<FdbEntry> keys;
+
+    if (bridge_port_id == SAI_NULL_OBJECT_ID && bv_id == SAI_NULL_OBJECT_ID)
+    {
+        for (const auto &it : m_entries)
+        {
+            keys.push_back(it.first);
+        }
+        return keys;
+    }
+
+    const set<FdbEntry> *candidates;
+    if (bridge_port_id != SAI_NULL_OBJECT_ID)
+    {
+        auto port_idx = m_entries_by_bridge_port.find(bridge_port_id);
+        if (port_idx == m_entries_by_bridge_port.end())
+        {
+            return keys;
+        }
+        candidates = &port_idx->second;
+    }
+    else
+    {
+        auto vlan_idx = m_entries_by_bv_id.find(bv_id);
+        if (vlan_idx == m_entries_by_bv_id.end())
+        {
+            return keys;
+        }
+        candidates = &vlan_idx->second;
+    }
+
+    for (const auto &candidate : *candidates)
+    {
+        if (bridge_port_id != SAI_NULL_OBJECT_ID && bv_id != SAI_NULL_OBJECT_ID && candidate.bv_id != bv_id)
+        {
+            continue;
+        }
+        keys.push_back(candidate);
+    }
+
+    return keys;
+}
+
 bool FdbOrch::isDestinationSame(FdbData &oldFdbData, FdbData &newFdbData) {
     FdbDest oldDestType = oldFdbData.dest_type;
     FdbDest newDestType = newFdbData.dest_type;
@@ -2010,7 +2145,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                         " old_type=%s local mac exists, its D -> (C+D) state\n",
                         entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str(),
                         fdbData.type.c_str(), fdbData.origin, oldOrigin, oldType.c_str());
-                    m_entries[entry].type = "dynamic_control_learn";
+                    it->second.type = "dynamic_control_learn";
                     return true;
                 }
                 macMoveLocalToRemote = true;
@@ -2201,7 +2336,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
             }
 
             // Remove the existing entry since its port_name is changed
-            (void)m_entries.erase(entry);
+            eraseFdbEntry(entry);
 
             notifyTunnelOrch(oldPort);
             SWSS_LOG_INFO("FdbOrch Removed old entry, mac=%s bv_id=0x%" PRIx64 " port:%s",
@@ -2255,7 +2390,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         removeFdbEntryFromPortCache(entry, oldPort);
     }
 
-    m_entries[entry] = storeFdbData;
+    setFdbEntry(entry, storeFdbData);
 
     m_entries_by_port[port.m_alias].push_back(entry);
 
@@ -2369,7 +2504,7 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
                     entry.mac.to_string().c_str(), origin, fdbData.origin);
             if (fdbData.type == "dynamic_control_learn") {
                 if (fdbData.dest_type == FdbDest::IFNAME) {
-                    m_entries[entry].type = "dynamic";
+                    it->second.type = "dynamic";
                     return true;
                 } else {
                     SWSS_LOG_ERROR("RemoveFDBEntry: EVPN_MH_UC: invalid dest_type=%s for MAC=%s, bv_id=0x%" PRIx64, destTypeToString[fdbData.dest_type].c_str(), entry.mac.to_string().c_str(), entry.bv_id);
@@ -2433,7 +2568,7 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
     vlan.m_fdb_count--;
     SWSS_LOG_DEBUG("after removing fdb, vlan %s, m_fdb_count %d", vlan.m_alias.c_str(), vlan.m_fdb_count);
     m_portsOrch->setPort(vlan.m_alias, vlan);
-    (void)m_entries.erase(entry);
+    eraseFdbEntry(entry);
     removeFdbEntryFromPortCache(entry, port);
 
     // Remove in StateDb
@@ -6,8 +6,17 @@
 #include "portsorch.h"
 #include "lib/fdb_defs.h"
 
+#include <chrono>
 #include <memory>
 
+/*
+ * A drained FDB notification batch of at least this many notifications puts
+ * FdbOrch in overload mode, where a LEARN of a MAC already learnt on the same
+ * bridge port within FDB_RELEARN_WINDOW_MS is dropped without processing.
+ */
+#define FDB_NOTIF_OVERLOAD_THRESHOLD 1000
+#define FDB_RELEARN_WINDOW_MS 1000
+
 class MacMoveGuard;
 
 enum FdbOrigin
@@ -91,6 +100,8 @@ struct FdbData
     sai_fdb_entry_type_t sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
     string discard;
     bool allow_mac_move = false;
+    /* Last LEARN notification seen for a locally learnt entry */
+    std::chrono::steady_clock::time_point last_learn;
 };
 
 struct SavedFdbEntry
@@ -153,14 +164,20 @@ private:
     PortsOrch *m_portsOrch;
     map<FdbEntry, FdbData> m_entries;
     fdb_entries_by_port_t m_entries_by_port;
+    /* Keys of m_entries by bridge port and by bv_id, kept by setFdbEntry()/eraseFdbEntry() */
+    map<sai_object_id_t, set<FdbEntry>> m_entries_by_bridge_port;
+    map<sai_object_id_t, set<FdbEntry>> m_entries_by_bv_id;
     saved_fdb_entries_by_port_t saved_fdb_entries;
     vector<Table*> m_appTables;
+    RedisPipeline m_stateDbPipeline;
     Table m_fdbStateTable;
     Table m_mclagFdbStateTable;
     NotificationConsumer* m_flushNotificationsConsumer;
     NotificationConsumer* m_fdbNotificationConsumer;
     shared_ptr<DBConnector> m_notificationsDb;
     std::unique_ptr<MacMoveGuard> m_macMoveGuard;
+    bool m_fdbOverload = false;
+    uint64_t m_droppedRelearns = 0;
 
     map<FdbDest, string> destTypeToString =
         { { FdbDest::UNKNOWN, "Unknown" },
@@ -172,6 +189,7 @@ private:
     void doTask(NotificationConsumer& consumer);
     void doTask(swss::SelectableTimer& timer) override;
     void handleNotification(NotificationConsumer& consumer, const KeyOpFieldsValuesTuple& entry);
+    bool isRedundantLearn(const sai_fdb_entry_t& entry, sai_object_id_t bridge_port_id);
 
     void updateVlanMember(const VlanMemberUpdate&);
     void updatePortOperState(const PortOperStateUpdate&);
@@ -180,6 +198,10 @@ private:
     void deleteFdbEntryFromSavedFDB(const MacAddress &mac, const unsigned short &vlanId, FdbOrigin origin, const string portName="");
     void removeFdbEntryFromPortCache(const FdbEntry& entry, const Port& port);
 
+    void setFdbEntry(const FdbEntry& entry, const FdbData& fdbData);
+    void eraseFdbEntry(const FdbEntry& entry);
+    vector<FdbEntry> getFdbEntries(sai_object_id_t bridge_port_id, sai_object_id_t bv_id);
+
     bool storeFdbEntryState(const FdbUpdate& update);
     void notifyTunnelOrch(Port& port);
 
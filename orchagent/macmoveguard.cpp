@@ -44,6 +44,9 @@ MacMoveGuard::MacMoveGuard(DBConnector *configDb, DBConnector *stateDb,
     // finished populating port OIDs from APP_DB before we try to drive SAI.
     m_stateTable.reset(new swss::Table(stateDb, STATE_MAC_MOVE_GUARD_TABLE_NAME));
     m_capabilityTable.reset(new swss::Table(stateDb, STATE_MMG_CAPABILITY_TABLE_NAME));
+    m_countersTable.reset(new swss::Table(stateDb, STATE_MMG_COUNTERS_TABLE_NAME));
+    m_macTrackingState.setMaxSize(m_maxTrackedMacs);
+    m_learntMac.setMaxSize(m_maxTrackedMacs);
 
     // Probe DLOMWA support and publish the action-capability row to STATE_DB.
     // Probing eagerly here (rather than lazily on first DLOMWA configure)
@@ -122,6 +125,7 @@ void MacMoveGuard::clearAllState()
     // Clear tracking state that is unrelated to the disabled-ports retry set.
     m_macTrackingState.clear();
     m_learntMac.clear();
+    m_countersTable->del(MMG_COUNTERS_KEY);
 
     // Persist whatever ports remain (may be empty, in which case the row is
     // deleted) so a restart will reattempt the failed re-enables.
@@ -205,6 +209,21 @@ void MacMoveGuard::doConfigTask(Consumer &consumer)
                             m_recoverySeconds = v;
                         }
                     }
+                    else if (field == "max_tracked_macs")
+                    {
+                        uint32_t v = static_cast<uint32_t>(stoul(value));
+                        if (v < 1)
+                        {
+                            SWSS_LOG_WARN("MAC_MOVE_GUARD: ignoring max_tracked_macs=%u (must be >= 1); "
+                                          "keeping current value %u", v, m_maxTrackedMacs);
+                        }
+                        else
+                        {
+                            m_maxTrackedMacs = v;
+                            m_macTrackingState.setMaxSize(m_maxTrackedMacs);
+                            m_learntMac.setMaxSize(m_maxTrackedMacs);
+                        }
+                    }
                     else if (field == "action")
                     {
                         if (value == "DISABLE_PORT")
@@ -236,10 +255,10 @@ void MacMoveGuard::doConfigTask(Consumer &consumer)
             else if (m_action == MacMoveGuardAction::DISABLE_LEARN_ON_MAC_WITH_ACL)
                 action_str = "DISABLE_LEARN_ON_MAC_WITH_ACL";
 
-            SWSS_LOG_NOTICE("MAC_MOVE_GUARD config: enabled=%s threshold=%u detect_interval=%us action_interval=%us action=%s",
+            SWSS_LOG_NOTICE("MAC_MOVE_GUARD config: enabled=%s threshold=%u detect_interval=%us action_interval=%us action=%s max_tracked_macs=%u",
                             m_enabled ? "true" : "false",
                             m_threshold, m_durationSeconds, m_recoverySeconds,
-                            action_str);
+                            action_str, m_maxTrackedMacs);
 
             if (!m_enabled)
             {
@@ -339,24 +358,24 @@ void MacMoveGuard::pruneWindow(MacMoveTrackingState &state)
 {
     auto cutoff = steady_clock::now() - seconds(m_durationSeconds);
 
-    // Remove old move timestamps outside the detection window
-    while (!state.move_timestamps.empty() && state.move_timestamps.front() < cutoff)
-    {
-        state.move_timestamps.pop_front();
-    }
+    // Drop move buckets and ports that fall outside the detection window
+    state.move_timestamps.prune(cutoff);
+    state.ports_seen.prune(cutoff);
+}
 
-    // Remove ports that haven't been seen within the detection window
-    for (auto it = state.ports_seen.begin(); it != state.ports_seen.end(); )
+uint16_t MacMoveGuard::portIndex(const string &alias)
+{
+    auto it = m_portIndex.find(alias);
+    if (it != m_portIndex.end())
     {
-        if (it->second < cutoff)
-        {
-            it = state.ports_seen.erase(it);
-        }
-        else
-        {
-            ++it;
-        }
+        return it->second;
     }
+
+    // Port aliases are a small, fixed set; they are never released
+    uint16_t index = static_cast<uint16_t>(m_portNames.size());
+    m_portNames.push_back(alias);
+    m_portIndex.emplace(alias, index);
+    return index;
 }
 
 void MacMoveGuard::handleMacLearn(const MacLearnNotification &notif)
@@ -375,15 +394,13 @@ void MacMoveGuard::handleMacLearn(const MacLearnNotification &notif)
     // erase on AGED — a previously-learned port stays cached until the next
     // LEARN overwrites it (the signal we use to detect a move) or until
     // checkRecovery() prunes it for being older than detect_interval.
-    auto it = m_learntMac.find(key);
-    std::string prev_port;
-    if (it != m_learntMac.end())
-    {
-        prev_port = it->second.port;
-    }
-    m_learntMac[key] = LearntMacEntry{ notif.port.m_alias, steady_clock::now() };
+    uint16_t port = portIndex(notif.port.m_alias);
+    LearntMacEntry &entry = m_learntMac[key];
+    uint16_t prev_port = entry.port;
+    entry.port = port;
+    entry.last_seen = steady_clock::now();
 
-    if (prev_port.empty() || prev_port == notif.port.m_alias)
+    if (prev_port == 0 || prev_port == port)
     {
         // First time we see this MAC, or same port — not a move.
         return;
@@ -401,7 +418,7 @@ void MacMoveGuard::handleMacLearn(const MacLearnNotification &notif)
     // It's a move: synthesize a MOVE notification and run it through the
     // same path used for native SAI_FDB_EVENT_MOVE.
     MacMoveNotification synth;
-    synth.port_old.m_alias = prev_port;
+    synth.port_old.m_alias = portAlias(prev_port);
     synth.port_new = notif.port;
     synth.mac = notif.mac;
     synth.bv_id = notif.bv_id;
@@ -424,22 +441,25 @@ void MacMoveGuard::handleMacMove(const MacMoveNotification &notif)
 
     // Keep the learnt-MAC cache in sync for native MOVE events. (For moves
     // synthesized from LEARN, handleMacLearn has already updated this.)
-    m_learntMac[key] = LearntMacEntry{ new_alias, now };
+    uint16_t port = portIndex(new_alias);
+    m_learntMac[key] = LearntMacEntry{ port, now };
 
     MacMoveTrackingState &state = m_macTrackingState[key];
 
-    // Track this move timestamp in the sliding window
-    state.move_timestamps.push_back(now);
+    // Count this move in the sliding window; each bucket covers
+    // 1/MMG_MOVE_BUCKETS of detect_interval
+    auto width = std::max(milliseconds(1), milliseconds(m_durationSeconds * 1000ULL / MMG_MOVE_BUCKETS));
+    state.move_timestamps.record(now, width);
 
     // Track this port and when MAC was last seen on it
-    state.ports_seen[new_alias] = now;
-    state.last_port = new_alias;
+    state.ports_seen.touch(port, now);
+    state.last_port = port;
 
     // Prune old entries outside the detection window
     pruneWindow(state);
 
     // Update move count based on entries still in the window
-    state.move_count = state.move_timestamps.size();
+    state.move_count = state.move_timestamps.count();
 
     SWSS_LOG_DEBUG("MAC_MOVE_GUARD: MAC %s on vlan_oid=0x%" PRIx64 " move count: %zu, seen on %zu ports (threshold %u)",
                    notif.mac.to_string().c_str(), notif.bv_id,
@@ -508,7 +528,7 @@ void MacMoveGuard::markBadMac(const MacKey &key, MacMoveTrackingState &state, co
 
                 for (const auto &port_entry : state.ports_seen)
                 {
-                    const string &port = port_entry.first;
+                    const string &port = portAlias(port_entry.first);
 
                     // Check if this port is already disabled by another bad MAC
                     if (m_disabledPorts.find(port) != m_disabledPorts.end())
@@ -551,7 +571,7 @@ void MacMoveGuard::markBadMac(const MacKey &key, MacMoveTrackingState &state, co
             // Disable all ports EXCEPT the pinned port
             for (const auto &port_entry : state.ports_seen)
             {
-                const string &port = port_entry.first;
+                const string &port = portAlias(port_entry.first);
 
                 if (port == state.pinned_port)
                 {
@@ -773,6 +793,21 @@ void MacMoveGuard::checkRecovery()
 
         ++it;
     }
+
+    publishCounters();
+}
+
+// Publish the tracking table sizes and the number of entries evicted so far
+// to keep them under max_tracked_macs.
+void MacMoveGuard::publishCounters()
+{
+    std::vector<FieldValueTuple> fvs = {
+        FieldValueTuple("tracked_macs", to_string(m_macTrackingState.size())),
+        FieldValueTuple("learnt_macs", to_string(m_learntMac.size())),
+        FieldValueTuple("max_tracked_macs", to_string(m_maxTrackedMacs)),
+        FieldValueTuple("evictions", to_string(m_macTrackingState.evictions() + m_learntMac.evictions())),
+    };
+    m_countersTable->set(MMG_COUNTERS_KEY, fvs);
 }
 
 void MacMoveGuard::reapplyActionIntervalToBadMacs(uint32_t prev_recovery_seconds)
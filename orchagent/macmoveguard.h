@@ -7,7 +7,8 @@
 #include "timer.h"
 
 #include <boost/functional/hash.hpp>
-#include <deque>
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <map>
 #include <memory>
@@ -15,6 +16,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 #include <cstdint>
 
 // Acronyms used throughout this header / implementation:
@@ -37,11 +39,26 @@
 #define MMG_ACTION_DISABLE_PORT             "DISABLE_PORT"
 #define MMG_ACTION_DISABLE_LEARN_ON_MAC_WITH_ACL  "DISABLE_LEARN_ON_MAC_WITH_ACL"
 
+// STATE_DB table where MacMoveGuard publishes the size of its tracking tables
+// and how many entries were evicted to stay under max_tracked_macs. Single
+// row "GLOBAL", refreshed on every recovery timer tick while enabled.
+#define STATE_MMG_COUNTERS_TABLE_NAME       "MMG_COUNTERS_TABLE"
+#define MMG_COUNTERS_KEY                    "GLOBAL"
+
 // Name under which MacMoveGuard registers its recovery SelectableTimer with the
 // owning FdbOrch's executor list. Exposed so FdbOrch can dispatch timer ticks
 // back to the guard without hard-coding the string in multiple places.
 #define MAC_MOVE_GUARD_RECOVERY_TIMER_NAME  "MAC_MOVE_GUARD_RECOVERY"
 
+// Per-MAC tracking is kept in fixed-size structures: at most
+// MMG_PORTS_PER_MAC ports are remembered per MAC, and moves are counted in
+// MMG_MOVE_BUCKETS buckets spanning detect_interval.
+#define MMG_PORTS_PER_MAC                   8
+#define MMG_MOVE_BUCKETS                    16
+
+// Default cap on the number of MACs in each tracking table (max_tracked_macs).
+#define MMG_DEFAULT_MAX_TRACKED_MACS        65536
+
 // Action types for MAC move guard
 enum class MacMoveGuardAction
 {
@@ -89,14 +106,382 @@ struct MacKeyHash
     }
 };
 
+// Open-addressing (linear probing) table keyed by MacKey, with an intrusive
+// LRU list threaded through its slots. erase() leaves a tombstone, so
+// iterators stay valid while erasing during iteration; only inserting a new
+// key may rehash and invalidate references. With a size cap set, inserting
+// into a full table first evicts the least recently used entry whose value
+// reports evictable().
+template <typename V>
+class MacTrackingTable
+{
+public:
+    typedef std::pair<MacKey, V> value_type;
+
+private:
+    enum SlotState : uint8_t { SLOT_EMPTY, SLOT_USED, SLOT_DELETED };
+
+    struct Slot
+    {
+        value_type kv;
+        SlotState state = SLOT_EMPTY;
+        int32_t lru_prev = -1;
+        int32_t lru_next = -1;
+    };
+
+public:
+    class iterator
+    {
+    public:
+        iterator(std::vector<Slot> *slots, size_t idx) : m_slots(slots), m_idx(idx) { skip(); }
+
+        value_type &operator*() const { return (*m_slots)[m_idx].kv; }
+        value_type *operator->() const { return &(*m_slots)[m_idx].kv; }
+        iterator &operator++() { ++m_idx; skip(); return *this; }
+        bool operator==(const iterator &o) const { return m_idx == o.m_idx; }
+        bool operator!=(const iterator &o) const { return m_idx != o.m_idx; }
+
+    private:
+        friend class MacTrackingTable;
+
+        void skip()
+        {
+            while (m_idx < m_slots->size() && (*m_slots)[m_idx].state != SLOT_USED)
+            {
+                ++m_idx;
+            }
+        }
+
+        std::vector<Slot> *m_slots;
+        size_t m_idx;
+    };
+
+    iterator begin() { return iterator(&m_slots, 0); }
+    iterator end() { return iterator(&m_slots, m_slots.size()); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    // 0 means unbounded. Lowering the cap evicts entries down to it, as far
+    // as they are evictable.
+    void setMaxSize(size_t max_size)
+    {
+        m_maxSize = max_size;
+        while (m_maxSize && m_size > m_maxSize && evictOne())
+        {
+        }
+    }
+    size_t maxSize() const { return m_maxSize; }
+    uint64_t evictions() const { return m_evictions; }
+
+    iterator find(const MacKey &key)
+    {
+        int32_t idx = lookup(key);
+        return idx < 0 ? end() : iterator(&m_slots, idx);
+    }
+
+    // Returns the value for key, inserting a default one if needed, and marks
+    // it most recently used.
+    V &operator[](const MacKey &key)
+    {
+        int32_t idx = lookup(key);
+        if (idx >= 0)
+        {
+            unlink(idx);
+            linkHead(idx);
+            return m_slots[idx].kv.second;
+        }
+
+        if (m_maxSize && m_size >= m_maxSize)
+        {
+            evictOne();
+        }
+
+        if ((m_occupied + 1) * 4 > m_slots.size() * 3)
+        {
+            rehash(m_size * 2 >= m_slots.size() / 2 ? std::max<size_t>(m_slots.size() * 2, 16) : m_slots.size());
+        }
+
+        idx = insertSlot(key);
+        return m_slots[idx].kv.second;
+    }
+
+    iterator erase(iterator it)
+    {
+        eraseSlot(static_cast<int32_t>(it.m_idx));
+        return ++it;
+    }
+
+    size_t erase(const MacKey &key)
+    {
+        int32_t idx = lookup(key);
+        if (idx < 0)
+        {
+            return 0;
+        }
+        eraseSlot(idx);
+        return 1;
+    }
+
+    void clear()
+    {
+        m_slots.clear();
+        m_size = 0;
+        m_occupied = 0;
+        m_head = m_tail = -1;
+    }
+
+private:
+    std::vector<Slot> m_slots;
+    size_t m_size = 0;          // used slots
+    size_t m_occupied = 0;      // used and deleted slots
+    size_t m_maxSize = 0;
+    uint64_t m_evictions = 0;
+    int32_t m_head = -1;        // most recently used
+    int32_t m_tail = -1;        // least recently used
+    MacKeyHash m_hash;
+
+    int32_t lookup(const MacKey &key) const
+    {
+        if (m_slots.empty())
+        {
+            return -1;
+        }
+
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = m_hash(key) & mask; ; i = (i + 1) & mask)
+        {
+            const Slot &slot = m_slots[i];
+            if (slot.state == SLOT_EMPTY)
+            {
+                return -1;
+            }
+            if (slot.state == SLOT_USED && slot.kv.first == key)
+            {
+                return static_cast<int32_t>(i);
+            }
+        }
+    }
+
+    // Inserts key, known to be absent, at the head of the LRU list
+    int32_t insertSlot(const MacKey &key)
+    {
+        size_t mask = m_slots.size() - 1;
+        size_t i = m_hash(key) & mask;
+        while (m_slots[i].state == SLOT_USED)
+        {
+            i = (i + 1) & mask;
+        }
+
+        Slot &slot = m_slots[i];
+        if (slot.state == SLOT_EMPTY)
+        {
+            m_occupied++;
+        }
+        slot.kv = value_type(key, V());
+        slot.state = SLOT_USED;
+        m_size++;
+        linkHead(static_cast<int32_t>(i));
+        return static_cast<int32_t>(i);
+    }
+
+    void eraseSlot(int32_t idx)
+    {
+        unlink(idx);
+        m_slots[idx].kv.second = V();
+        m_slots[idx].state = SLOT_DELETED;
+        m_size--;
+    }
+
+    // Returns false if no entry is evictable
+    bool evictOne()
+    {
+        for (int32_t idx = m_tail; idx >= 0; idx = m_slots[idx].lru_prev)
+        {
+            if (m_slots[idx].kv.second.evictable())
+            {
+                eraseSlot(idx);
+                m_evictions++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<Slot> old;
+        old.swap(m_slots);
+        int32_t idx = m_tail;
+
+        m_slots.resize(capacity);
+        m_size = 0;
+        m_occupied = 0;
+        m_head = m_tail = -1;
+
+        // Re-insert from least to most recently used to keep the LRU order
+        for (; idx >= 0; idx = old[idx].lru_prev)
+        {
+            int32_t n = insertSlot(old[idx].kv.first);
+            m_slots[n].kv.second = std::move(old[idx].kv.second);
+        }
+    }
+
+    void linkHead(int32_t idx)
+    {
+        m_slots[idx].lru_prev = -1;
+        m_slots[idx].lru_next = m_head;
+        if (m_head >= 0)
+        {
+            m_slots[m_head].lru_prev = idx;
+        }
+        m_head = idx;
+        if (m_tail < 0)
+        {
+            m_tail = idx;
+        }
+    }
+
+    void unlink(int32_t idx)
+    {
+        Slot &slot = m_slots[idx];
+        if (slot.lru_prev >= 0)
+        {
+            m_slots[slot.lru_prev].lru_next = slot.lru_next;
+        }
+        else
+        {
+            m_head = slot.lru_next;
+        }
+        if (slot.lru_next >= 0)
+        {
+            m_slots[slot.lru_next].lru_prev = slot.lru_prev;
+        }
+        else
+        {
+            m_tail = slot.lru_prev;
+        }
+        slot.lru_prev = slot.lru_next = -1;
+    }
+};
+
+// Ports a MAC was seen on, as (port index, last seen) pairs. At most
+// MMG_PORTS_PER_MAC are kept; a new port on a full ring replaces the port
+// seen least recently.
+class PortRing
+{
+public:
+    typedef std::pair<uint16_t, std::chrono::steady_clock::time_point> value_type;
+
+    void touch(uint16_t port, std::chrono::steady_clock::time_point now)
+    {
+        size_t oldest = 0;
+        for (size_t i = 0; i < m_size; ++i)
+        {
+            if (m_ports[i].first == port)
+            {
+                m_ports[i].second = now;
+                return;
+            }
+            if (m_ports[i].second < m_ports[oldest].second)
+            {
+                oldest = i;
+            }
+        }
+
+        if (m_size < m_ports.size())
+        {
+            m_ports[m_size++] = value_type(port, now);
+        }
+        else
+        {
+            m_ports[oldest] = value_type(port, now);
+        }
+    }
+
+    // Forget ports not seen since cutoff
+    void prune(std::chrono::steady_clock::time_point cutoff)
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_size; ++i)
+        {
+            if (m_ports[i].second >= cutoff)
+            {
+                m_ports[kept++] = m_ports[i];
+            }
+        }
+        m_size = static_cast<uint8_t>(kept);
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    value_type *begin() { return m_ports.data(); }
+    value_type *end() { return m_ports.data() + m_size; }
+    const value_type *begin() const { return m_ports.data(); }
+    const value_type *end() const { return m_ports.data() + m_size; }
+
+private:
+    std::array<value_type, MMG_PORTS_PER_MAC> m_ports;
+    uint8_t m_size = 0;
+};
+
+// Moves of a MAC counted in MMG_MOVE_BUCKETS time buckets. Iterating yields
+// the time of the latest move recorded in each bucket; a bucket is dropped by
+// prune() once that time falls out of the detection window.
+class MoveWindow
+{
+public:
+    void record(std::chrono::steady_clock::time_point now, std::chrono::milliseconds width)
+    {
+        uint64_t slot = static_cast<uint64_t>(now.time_since_epoch() / width);
+        size_t i = slot % MMG_MOVE_BUCKETS;
+        if (m_slot[i] != slot)
+        {
+            m_slot[i] = slot;
+            m_count[i] = 0;
+        }
+        m_count[i]++;
+        m_latest[i] = now;
+    }
+
+    void prune(std::chrono::steady_clock::time_point cutoff)
+    {
+        for (size_t i = 0; i < MMG_MOVE_BUCKETS; ++i)
+        {
+            if (m_count[i] && m_latest[i] < cutoff)
+            {
+                m_count[i] = 0;
+            }
+        }
+    }
+
+    size_t count() const
+    {
+        size_t total = 0;
+        for (auto c : m_count)
+        {
+            total += c;
+        }
+        return total;
+    }
+
+    std::chrono::steady_clock::time_point *begin() { return m_latest.data(); }
+    std::chrono::steady_clock::time_point *end() { return m_latest.data() + MMG_MOVE_BUCKETS; }
+
+private:
+    std::array<std::chrono::steady_clock::time_point, MMG_MOVE_BUCKETS> m_latest{};
+    std::array<uint64_t, MMG_MOVE_BUCKETS> m_slot{};
+    std::array<uint32_t, MMG_MOVE_BUCKETS> m_count{};
+};
+
 // Per-MAC tracking state: move history, bad MAC status, and action tracking.
 struct MacMoveTrackingState
 {
-    // Sliding window of move timestamps (for counting moves within detect_interval)
-    std::deque<std::chrono::steady_clock::time_point> move_timestamps;
+    // Moves within detect_interval
+    MoveWindow move_timestamps;
 
-    // Track each port and when MAC was last seen on it (for detect_interval window)
-    std::map<std::string, std::chrono::steady_clock::time_point> ports_seen;
+    // Ports the MAC was seen on within detect_interval (port indices, see MacMoveGuard::portIndex)
+    PortRing ports_seen;
 
     size_t move_count = 0;                                              // total MAC moves within detect_interval
     bool is_bad_mac = false;                                            // is this MAC identified as bad?
@@ -104,17 +489,22 @@ struct MacMoveTrackingState
     std::chrono::steady_clock::time_point action_expiry_time;           // when the action interval expires
     std::string pinned_port;                                            // the ONE port we keep active for this bad MAC (DISABLE_PORT action)
     std::set<std::string> disabled_ports;                               // all other ports we disabled for this bad MAC (DISABLE_PORT action)
-    std::string last_port;                                              // most recent port this MAC was seen on
+    uint16_t last_port = 0;                                             // index of the most recent port this MAC was seen on
     sai_object_id_t learn_disable_acl_entry_id = SAI_NULL_OBJECT_ID;    // ACL entry installed for this bad MAC (DISABLE_LEARN_ON_MAC_WITH_ACL action)
+
+    // Bad MACs hold hardware resources and are never evicted
+    bool evictable() const { return !is_bad_mac; }
 };
 
-// Cached learnt-MAC entry: which port the MAC was last seen on and when.
-// The timestamp lets us prune entries older than the detection window so
-// the cache does not grow unbounded for MACs that have gone quiet.
+// Cached learnt-MAC entry: index of the port the MAC was last seen on and
+// when. The timestamp lets us prune entries older than the detection window
+// so the cache does not grow unbounded for MACs that have gone quiet.
 struct LearntMacEntry
 {
-    std::string port;
+    uint16_t port = 0;
     std::chrono::steady_clock::time_point last_seen;
+
+    bool evictable() const { return true; }
 };
 
 class FdbOrch;
@@ -162,9 +552,10 @@ private:
     uint32_t m_durationSeconds = 5;                    // detect_interval: sliding window in seconds
     uint32_t m_recoverySeconds = 600;                  // action_interval: recovery period in seconds
     MacMoveGuardAction m_action = MacMoveGuardAction::DISABLE_PORT;  // action to take on bad MAC
+    uint32_t m_maxTrackedMacs = MMG_DEFAULT_MAX_TRACKED_MACS;          // max_tracked_macs: cap of each tracking table
 
     // Per-MAC move tracking state, keyed by (mac, bv_id).
-    std::map<MacKey, MacMoveTrackingState> m_macTrackingState;
+    MacTrackingTable<MacMoveTrackingState> m_macTrackingState;
 
     // For each port we have admin-disabled, the set of bad MACs currently
     // requiring it to be disabled. The port is re-enabled only when the set becomes empty.
@@ -174,7 +565,12 @@ private:
     // LEARNED. We never erase on AGED — a subsequent LEARN on a different
     // port is recognized as a move via port comparison. Entries older than
     // detect_interval are pruned by checkRecovery() to bound memory use.
-    std::unordered_map<MacKey, LearntMacEntry, MacKeyHash> m_learntMac;
+    MacTrackingTable<LearntMacEntry> m_learntMac;
+
+    // Port aliases interned to the indices stored in the tracking tables.
+    // Index 0 is reserved for "no port".
+    std::vector<std::string> m_portNames = { "" };
+    std::unordered_map<std::string, uint16_t> m_portIndex;
 
     // Recovery timer: fires periodically to check recovery conditions.
     // Owned by the executor registered on the parent FdbOrch.
@@ -195,6 +591,9 @@ private:
     // supports. Single row, written once from the constructor.
     std::unique_ptr<swss::Table> m_capabilityTable;
 
+    // STATE_DB table where we publish tracking table counters (see publishCounters()).
+    std::unique_ptr<swss::Table> m_countersTable;
+
     // Shared ACL resources for the DISABLE_LEARN_ON_MAC_WITH_ACL action. The table
     // lifecycle is tied to CONFIG_DB: it is created when the feature is configured
     // with this action and destroyed when the feature is disabled or the action
@@ -236,6 +635,9 @@ private:
     void clearAllState();
     void checkRecovery();
     void reapplyActionIntervalToBadMacs(uint32_t prev_recovery_seconds);
+    uint16_t portIndex(const std::string &alias);
+    const std::string &portAlias(uint16_t index) const { return m_portNames[index]; }
+    void publishCounters();
 
     // STATE_DB persistence helpers (cleanup-on-restart model — only port
     // admin-disable bookkeeping survives a restart, and only so we can revert
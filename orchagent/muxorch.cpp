@@ -547,6 +547,27 @@ bool MuxCable::stateStandby()
 }
 
 void MuxCable::setState(string new_state)
+{
+    if (!beginStateChange(new_state))
+    {
+        return;
+    }
+
+    if (!(this->*(state_machine_handlers_[st_chg_]))())
+    {
+        endStateChange(false);
+        throw std::runtime_error("Failed to handle state transition");
+    }
+
+    endStateChange(true);
+    return;
+}
+
+/**
+ * @brief starts a state transition; returns false if there is nothing to program
+ * @param new_state requested mux state
+ */
+bool MuxCable::beginStateChange(string new_state)
 {
     SWSS_LOG_NOTICE("[%s] Set MUX state from %s to %s", mux_name_.c_str(),
                      muxStateValToString.at(state_).c_str(), new_state.c_str());
@@ -570,25 +591,32 @@ void MuxCable::setState(string new_state)
             SWSS_LOG_ERROR("State transition from %s to %s is not-handled ",
                             muxStateValToString.at(state_).c_str(), new_state.c_str());
         }
-        return;
+        return false;
     }
 
     mux_cb_orch_->updateMuxMetricState(mux_name_, new_state, true);
 
     prev_state_ = state_;
     state_ = ns;
+    st_chg_ = it->second;
 
     st_chg_in_progress_ = true;
+    return true;
+}
 
-    if (!(this->*(state_machine_handlers_[it->second]))())
+void MuxCable::endStateChange(bool success)
+{
+    if (!success)
     {
         //Reset back to original state
         state_ = prev_state_;
         st_chg_in_progress_ = false;
         st_chg_failed_ = true;
-        throw std::runtime_error("Failed to handle state transition");
+        return;
     }
 
+    string new_state = muxStateValToString.at(state_);
+
     mux_cb_orch_->updateMuxMetricState(mux_name_, new_state, false);
 
     st_chg_in_progress_ = false;
@@ -596,7 +624,93 @@ void MuxCable::setState(string new_state)
     SWSS_LOG_INFO("Changed state to %s", new_state.c_str());
 
     mux_cb_orch_->updateMuxState(mux_name_, new_state);
-    return;
+}
+
+/**
+ * @brief first phase of a multi-cable transition, runs before the shared neighbor/route flush
+ * @param neigh_ctx_list neighbors to enable/disable in the shared neighbor bulk
+ * @param route_ctx_list tunnel routes to add in the shared route bulk (standby only)
+ */
+bool MuxCable::prepareBulkStateChange(std::list<NeighborContext>& neigh_ctx_list,
+                                      std::list<MuxRouteBulkContext>& route_ctx_list)
+{
+    SWSS_LOG_NOTICE("Processing neighbors for mux %s, enable %d, state %d",
+                     mux_name_.c_str(), isActive(), state_);
+
+    if (st_chg_ == MuxStateChange::MUX_STATE_INIT_ACTIVE)
+    {
+        nbr_handler_->getNeighborContexts(neigh_ctx_list);
+        return true;
+    }
+
+    Port port;
+    if (!gPortsOrch->getPort(mux_name_, port))
+    {
+        SWSS_LOG_NOTICE("Port %s not found in port table", mux_name_.c_str());
+        return false;
+    }
+
+    if (isActive())
+    {
+        if (!aclHandler(port.m_port_id, mux_name_, false))
+        {
+            SWSS_LOG_INFO("Remove ACL drop rule failed for %s", mux_name_.c_str());
+            return false;
+        }
+
+        nbr_handler_->getNeighborContexts(neigh_ctx_list);
+        return true;
+    }
+
+    sai_object_id_t tnh = mux_orch_->createNextHopTunnel(MUX_TUNNEL, peer_ip4_);
+    if (tnh == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_INFO("Null NH object id, retry for %s", peer_ip4_.to_string().c_str());
+        return false;
+    }
+    // Loop through all routes with nexthops through this mux cable when changing state
+    updateRoutes();
+
+    return nbr_handler_->disableNextHops(tnh, route_ctx_list, neigh_ctx_list);
+}
+
+/**
+ * @brief repoints routes and nexthop groups to the neighbors enabled by the shared neighbor bulk
+ * @param route_ctx_list tunnel routes to remove in the shared route bulk
+ */
+bool MuxCable::updateBulkNextHops(std::list<MuxRouteBulkContext>& route_ctx_list)
+{
+    bool update_rt = (st_chg_ != MuxStateChange::MUX_STATE_INIT_ACTIVE);
+
+    return nbr_handler_->enableNextHops(update_rt, route_ctx_list);
+}
+
+bool MuxCable::finishBulkStateChange()
+{
+    if (isActive())
+    {
+        // Loop through all routes with nexthops through this mux cable when changing state
+        updateRoutes();
+        refreshSliceRoute();
+        return true;
+    }
+
+    refreshSliceRoute();
+
+    Port port;
+    if (!gPortsOrch->getPort(mux_name_, port))
+    {
+        SWSS_LOG_NOTICE("Port %s not found in port table", mux_name_.c_str());
+        return false;
+    }
+
+    if (!aclHandler(port.m_port_id, mux_name_))
+    {
+        SWSS_LOG_INFO("Add ACL drop rule failed for %s", mux_name_.c_str());
+        return false;
+    }
+
+    return true;
 }
 
 void MuxCable::rollbackStateChange()
@@ -885,11 +999,9 @@ void MuxNbrHandler::update(NextHopKey nh, sai_object_id_t tunnelId, bool add, Mu
     }
 }
 
-bool MuxNbrHandler::enable(bool update_rt)
+void MuxNbrHandler::getNeighborContexts(std::list<NeighborContext>& neigh_ctx_list)
 {
     NeighborEntry neigh;
-    std::list<NeighborContext> neigh_ctx_list;
-    std::list<MuxRouteBulkContext> route_ctx_list;
 
     auto it = neighbors_.begin();
     while (it != neighbors_.end())
@@ -901,13 +1013,38 @@ bool MuxNbrHandler::enable(bool update_rt)
         neigh_ctx_list.push_back(NeighborContext(neigh, true));
         it++;
     }
+}
+
+bool MuxNbrHandler::enable(bool update_rt)
+{
+    std::list<NeighborContext> neigh_ctx_list;
+    std::list<MuxRouteBulkContext> route_ctx_list;
+
+    getNeighborContexts(neigh_ctx_list);
 
     if (!gNeighOrch->enableNeighbors(neigh_ctx_list))
     {
         return false;
     }
 
-    it = neighbors_.begin();
+    if (!enableNextHops(update_rt, route_ctx_list))
+    {
+        return false;
+    }
+
+    if (update_rt && !removeRoutes(route_ctx_list))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool MuxNbrHandler::enableNextHops(bool update_rt, std::list<MuxRouteBulkContext>& route_ctx_list)
+{
+    NeighborEntry neigh;
+
+    auto it = neighbors_.begin();
     while (it != neighbors_.end())
     {
         /* Update NH to point to learned neighbor */
@@ -956,7 +1093,25 @@ bool MuxNbrHandler::enable(bool update_rt)
         it++;
     }
 
-    if (update_rt && !removeRoutes(route_ctx_list))
+    return true;
+}
+
+bool MuxNbrHandler::disable(sai_object_id_t tnh)
+{
+    std::list<NeighborContext> neigh_ctx_list;
+    std::list<MuxRouteBulkContext> route_ctx_list;
+
+    if (!disableNextHops(tnh, route_ctx_list, neigh_ctx_list))
+    {
+        return false;
+    }
+
+    if (!addRoutes(route_ctx_list))
+    {
+        return false;
+    }
+
+    if (!gNeighOrch->disableNeighbors(neigh_ctx_list))
     {
         return false;
     }
@@ -964,11 +1119,10 @@ bool MuxNbrHandler::enable(bool update_rt)
     return true;
 }
 
-bool MuxNbrHandler::disable(sai_object_id_t tnh)
+bool MuxNbrHandler::disableNextHops(sai_object_id_t tnh, std::list<MuxRouteBulkContext>& route_ctx_list,
+                                    std::list<NeighborContext>& neigh_ctx_list)
 {
     NeighborEntry neigh;
-    std::list<NeighborContext> neigh_ctx_list;
-    std::list<MuxRouteBulkContext> route_ctx_list;
 
     auto it = neighbors_.begin();
     while (it != neighbors_.end())
@@ -1019,16 +1173,6 @@ bool MuxNbrHandler::disable(sai_object_id_t tnh)
         it++;
     }
 
-    if (!addRoutes(route_ctx_list))
-    {
-        return false;
-    }
-
-    if (!gNeighOrch->disableNeighbors(neigh_ctx_list))
-    {
-        return false;
-    }
-
     return true;
 }
 
@@ -1043,7 +1187,7 @@ sai_object_id_t MuxNbrHandler::getNextHopId(const NextHopKey nhKey)
     return SAI_NULL_OBJECT_ID;
 }
 
-bool MuxNbrHandler::addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
+bool MuxNbrHandler::addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list, EntityBulker<sai_route_api_t>& bulker)
 {
     sai_status_t status;
     bool ret = true;
@@ -1071,10 +1215,10 @@ bool MuxNbrHandler::addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
         attr.value.oid = ctx->nh;
         attrs.push_back(attr);
 
-        status = gRouteBulker.create_entry(&object_statuses.back(), &route_entry, (uint32_t)attrs.size(), attrs.data());
+        status = bulker.create_entry(&object_statuses.back(), &route_entry, (uint32_t)attrs.size(), attrs.data());
     }
 
-    gRouteBulker.flush();
+    bulker.flush();
 
     for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
     {
@@ -1112,11 +1256,11 @@ bool MuxNbrHandler::addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
         SWSS_LOG_NOTICE("Created tunnel route to %s ", ctx->pfx.to_string().c_str());
     }
 
-    gRouteBulker.clear();
+    bulker.clear();
     return ret;
 }
 
-bool MuxNbrHandler::removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
+bool MuxNbrHandler::removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list, EntityBulker<sai_route_api_t>& bulker)
 {
     sai_status_t status;
     bool ret = true;
@@ -1133,10 +1277,10 @@ bool MuxNbrHandler::removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
         SWSS_LOG_INFO("Removing route entry %s, nh %" PRIx64 "", ctx->pfx.getIp().to_string().c_str(), ctx->nh);
 
         object_statuses.emplace_back();
-        status = gRouteBulker.remove_entry(&object_statuses.back(), &route_entry);
+        status = bulker.remove_entry(&object_statuses.back(), &route_entry);
     }
 
-    gRouteBulker.flush();
+    bulker.flush();
 
     for (auto ctx = bulk_ctx_list.begin(); ctx != bulk_ctx_list.end(); ctx++)
     {
@@ -1174,7 +1318,7 @@ bool MuxNbrHandler::removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list)
         SWSS_LOG_NOTICE("Removed tunnel route to %s ", ctx->pfx.to_string().c_str());
     }
 
-    gRouteBulker.clear();
+    bulker.clear();
     return ret;
 }
 
@@ -1753,33 +1897,74 @@ void MuxOrch::updateRoute(const IpPrefix &pfx)
     }
 }
 
-MuxCable* MuxOrch::findMuxCableInSubnet(IpAddress ip)
+void MuxSubnetIndex::add(const IpPrefix& pfx, const std::string& port_name, MuxCable* cable)
+{
+    auto& subnets = pfx.isV4() ? v4_subnets_ : v6_subnets_;
+    subnets[pfx.getMaskLength()][pfx.getSubnet()][port_name] = cable;
+}
+
+void MuxSubnetIndex::remove(const IpPrefix& pfx, const std::string& port_name)
 {
-    for (auto it = mux_cable_tb_.begin(); it != mux_cable_tb_.end(); it++)
+    auto& subnets = pfx.isV4() ? v4_subnets_ : v6_subnets_;
+
+    auto len_it = subnets.find(pfx.getMaskLength());
+    if (len_it == subnets.end())
     {
-       MuxCable* ptr = it->second.get();
-       if (ptr->isIpInSubnet(ip))
-       {
-           return ptr;
-       }
+        return;
     }
 
-    return nullptr;
+    auto subnet_it = len_it->second.find(pfx.getSubnet());
+    if (subnet_it == len_it->second.end())
+    {
+        return;
+    }
+
+    subnet_it->second.erase(port_name);
+    if (subnet_it->second.empty())
+    {
+        len_it->second.erase(subnet_it);
+    }
+    if (len_it->second.empty())
+    {
+        subnets.erase(len_it);
+    }
 }
 
-MuxCable* MuxOrch::findMuxCableBySlice(IpAddress ip)
+/**
+ * @brief longest prefix match of ip against the indexed subnets, one lookup per
+ *        configured prefix length
+ */
+MuxCable* MuxSubnetIndex::find(const IpAddress& ip) const
 {
-    for (auto it = mux_cable_tb_.begin(); it != mux_cable_tb_.end(); it++)
+    const auto& subnets = ip.isV4() ? v4_subnets_ : v6_subnets_;
+
+    for (const auto& len : subnets)
     {
-        MuxCable* ptr = it->second.get();
-        if (ptr->isIpInSlice(ip))
+        auto it = len.second.find(IpPrefix(ip.getIp(), len.first).getSubnet());
+        if (it != len.second.end())
         {
-            return ptr;
+            return it->second.begin()->second;
         }
     }
+
     return nullptr;
 }
 
+MuxCable* MuxOrch::findMuxCableInSubnet(IpAddress ip)
+{
+    return mux_subnet_idx_.find(ip);
+}
+
+MuxCable* MuxOrch::findMuxCableBySlice(IpAddress ip)
+{
+    if (ip.isV4())
+    {
+        return nullptr;
+    }
+
+    return mux_slice_idx_.find(ip);
+}
+
 bool MuxOrch::isSuppressedNeighbor(const IpAddress& ip, const std::string& port_name, MuxCable** out_cable)
 {
     if (out_cable) *out_cable = nullptr;
@@ -2289,14 +2474,11 @@ void MuxOrch::updateNeighbor(const NeighborUpdate& update)
     }
 
     // Check if neighbor is in MUX subnet
-    for (auto it = mux_cable_tb_.begin(); it != mux_cable_tb_.end(); it++)
+    MuxCable* ptr = findMuxCableInSubnet(update.entry.ip_address);
+    if (ptr)
     {
-        MuxCable* ptr = it->second.get();
-        if (ptr->isIpInSubnet(update.entry.ip_address))
-        {
-            ptr->updateNeighbor(update.entry, update.add);
-            return;
-        }
+        ptr->updateNeighbor(update.entry, update.add);
+        return;
     }
 
     // Handle MUX port-based neighbors
@@ -2330,7 +2512,6 @@ void MuxOrch::updateNeighbor(const NeighborUpdate& update)
         }
     }
 
-    MuxCable* ptr;
     if (!old_port.empty() && old_port != port && isMuxExists(old_port))
     {
         ptr = getMuxCable(old_port);
@@ -2613,6 +2794,14 @@ bool MuxOrch::handleMuxCfg(const Request& request)
                                    (MuxCable(port_name, srv_ip, srv_ip6, mux_peer_switch_, cable_type, nbr_handler_type, slice_ip6));
         addSkipNeighbors(skip_neighbors, port_name);
 
+        MuxCable* mux_cable = getMuxCable(port_name);
+        mux_subnet_idx_.add(srv_ip, port_name, mux_cable);
+        mux_subnet_idx_.add(srv_ip6, port_name, mux_cable);
+        if (mux_cable->hasSlicePrefix())
+        {
+            mux_slice_idx_.add(slice_ip6, port_name, mux_cable);
+        }
+
         if (slice_ip6_present)
         {
             ++sliced_cable_count_;
@@ -2669,8 +2858,12 @@ bool MuxOrch::handleMuxCfg(const Request& request)
         removeSkipNeighbors(skip_neighbors);
 
         auto it = mux_cable_tb_.find(port_name);
-        if (it != mux_cable_tb_.end() && it->second->hasSlicePrefix())
+        mux_subnet_idx_.remove(it->second->getServerIp4(), port_name);
+        mux_subnet_idx_.remove(it->second->getServerIp6(), port_name);
+
+        if (it->second->hasSlicePrefix())
         {
+            mux_slice_idx_.remove(it->second->getSlicePrefix(), port_name);
             if (sliced_cable_count_ > 0)
             {
                 --sliced_cable_count_;
@@ -2867,7 +3060,8 @@ void MuxOrch::updateCachedNeighbors()
 MuxCableOrch::MuxCableOrch(DBConnector *db, DBConnector *sdb, const std::string& tableName):
               Orch2(db, tableName, request_),
               app_tunnel_route_table_(db, APP_TUNNEL_ROUTE_TABLE_NAME),
-              mux_metric_table_(sdb, STATE_MUX_METRICS_TABLE_NAME)
+              mux_metric_table_(sdb, STATE_MUX_METRICS_TABLE_NAME),
+              route_bulker_(sai_route_api, gMaxBulkSize)
 {
     mux_table_ = unique_ptr<Table>(new Table(db, APP_HW_MUX_CABLE_TABLE_NAME));
 }
@@ -2937,6 +3131,15 @@ void MuxCableOrch::removeTunnelRoute(const NextHopKey &nhKey)
     app_tunnel_route_table_.del(key);
 }
 
+void MuxCableOrch::doTask(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    Orch2::doTask(consumer);
+
+    flushPendingStates();
+}
+
 bool MuxCableOrch::addOperation(const Request& request)
 {
     SWSS_LOG_ENTER();
@@ -2951,8 +3154,28 @@ bool MuxCableOrch::addOperation(const Request& request)
     }
 
     auto state = request.getAttrString("state");
-    auto mux_obj = mux_orch->getMuxCable(port_name);
 
+    /*
+     * Defer the switchover to the end of the drain so that all cables
+     * flipping together (e.g. peer ToR failover) share one bulk transaction.
+     * A second update for the same port applies the earlier ones first.
+     */
+    for (const auto &pending : pending_states_)
+    {
+        if (pending.first == port_name)
+        {
+            flushPendingStates();
+            break;
+        }
+    }
+
+    pending_states_.emplace_back(port_name, state);
+
+    return true;
+}
+
+void MuxCableOrch::setMuxState(MuxCable* mux_obj, const string& port_name, const string& state)
+{
     try
     {
         mux_obj->setState(state);
@@ -2962,24 +3185,197 @@ bool MuxCableOrch::addOperation(const Request& request)
         SWSS_LOG_ERROR("Mux Error setting state %s for port %s. Error: %s",
                         state.c_str(), port_name.c_str(), e.what());
         mux_obj->rollbackStateChange();
-        return true;
+        return;
     }
     catch (const std::logic_error& e)
     {
         SWSS_LOG_ERROR("Logic error while setting state %s for port %s. Error: %s",
                         state.c_str(), port_name.c_str(), e.what());
         mux_obj->rollbackStateChange();
-        return true;
+        return;
     }
     catch (const std::exception& e)
     {
         SWSS_LOG_ERROR("Exception caught while setting state %s for port %s. Error: %s",
                         state.c_str(), port_name.c_str(), e.what());
         mux_obj->rollbackStateChange();
-        return true;
+        return;
     }
 
     SWSS_LOG_NOTICE("Mux State set to %s for port %s", state.c_str(), port_name.c_str());
+}
+
+void MuxCableOrch::flushPendingStates()
+{
+    SWSS_LOG_ENTER();
+
+    if (pending_states_.empty())
+    {
+        return;
+    }
+
+    auto pending = std::move(pending_states_);
+    pending_states_.clear();
+
+    MuxOrch* mux_orch = gDirectory.get<MuxOrch*>();
+    vector<pair<string, string>> enabling, disabling;
+
+    for (const auto &change : pending)
+    {
+        const auto &port_name = change.first;
+        const auto &state = change.second;
+
+        if (!mux_orch->isMuxExists(port_name))
+        {
+            SWSS_LOG_INFO("Mux entry for port '%s' doesn't exist", port_name.c_str());
+            continue;
+        }
+
+        auto mux_obj = mux_orch->getMuxCable(port_name);
+
+        /* Single cable, prefix-based neighbors and unknown states take the per-cable path */
+        if (pending.size() == 1 || !mux_obj->isBulkStateChangeSupported() ||
+            muxStateStringToVal.find(state) == muxStateStringToVal.end())
+        {
+            setMuxState(mux_obj, port_name, state);
+            continue;
+        }
+
+        if (!mux_obj->beginStateChange(state))
+        {
+            continue;
+        }
+
+        if (mux_obj->isActive())
+        {
+            enabling.emplace_back(port_name, state);
+        }
+        else
+        {
+            disabling.emplace_back(port_name, state);
+        }
+    }
+
+    bulkSetMuxState(enabling);
+    bulkSetMuxState(disabling);
+}
+
+/**
+ * @brief programs a set of started transitions towards the same state as one bulk
+ *        transaction; on failure every cable is rolled back and retried on its own
+ *        so that each port still gets its own result in the state db
+ * @param changes list of (port, state) already started with beginStateChange
+ */
+void MuxCableOrch::bulkSetMuxState(const vector<pair<string, string>>& changes)
+{
+    SWSS_LOG_ENTER();
+
+    if (changes.empty())
+    {
+        return;
+    }
+
+    MuxOrch* mux_orch = gDirectory.get<MuxOrch*>();
+    vector<MuxCable*> cables;
+    for (const auto &change : changes)
+    {
+        cables.push_back(mux_orch->getMuxCable(change.first));
+    }
+
+    size_t prepared = 0;
+    bool success = false;
+    try
+    {
+        success = bulkStateTransition(cables, prepared);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("Exception caught during bulk mux state change of %zu ports. Error: %s",
+                        cables.size(), e.what());
+    }
+
+    if (success)
+    {
+        for (size_t i = 0; i < cables.size(); i++)
+        {
+            cables[i]->endStateChange(true);
+            SWSS_LOG_NOTICE("Mux State set to %s for port %s",
+                             changes[i].second.c_str(), changes[i].first.c_str());
+        }
+        return;
+    }
+
+    SWSS_LOG_WARN("Bulk mux state change of %zu ports failed, retrying per port", cables.size());
+
+    route_bulker_.clear();
+    gNeighOrch->clearBulkers();
+
+    for (size_t i = 0; i < cables.size(); i++)
+    {
+        cables[i]->endStateChange(false);
+        if (i < prepared)
+        {
+            cables[i]->rollbackStateChange();
+        }
+        setMuxState(cables[i], changes[i].first, changes[i].second);
+    }
+}
+
+bool MuxCableOrch::bulkStateTransition(const vector<MuxCable*>& cables, size_t& prepared)
+{
+    std::list<NeighborContext> neigh_ctx_list;
+    std::list<MuxRouteBulkContext> route_ctx_list;
+    bool active = cables.front()->isActive();
+
+    for (auto cable : cables)
+    {
+        prepared++;
+        if (!cable->prepareBulkStateChange(neigh_ctx_list, route_ctx_list))
+        {
+            return false;
+        }
+    }
+
+    if (active)
+    {
+        if (!gNeighOrch->enableNeighbors(neigh_ctx_list))
+        {
+            return false;
+        }
+
+        for (auto cable : cables)
+        {
+            if (!cable->updateBulkNextHops(route_ctx_list))
+            {
+                return false;
+            }
+        }
+
+        if (!route_ctx_list.empty() && !MuxNbrHandler::removeRoutes(route_ctx_list, route_bulker_))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if (!MuxNbrHandler::addRoutes(route_ctx_list, route_bulker_))
+        {
+            return false;
+        }
+
+        if (!gNeighOrch->disableNeighbors(neigh_ctx_list))
+        {
+            return false;
+        }
+    }
+
+    for (auto cable : cables)
+    {
+        if (!cable->finishBulkStateChange())
+        {
+            return false;
+        }
+    }
 
     return true;
 }
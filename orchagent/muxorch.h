@@ -103,9 +103,19 @@ public:
     string getAlias() const { return alias_; };
     void clearBulkers() { gRouteBulker.clear(); };
 
+    // Phases of enable()/disable() around the neighbor and route bulk flushes,
+    // so that several cables can share one flush (see MuxCableOrch::flushPendingStates)
+    void getNeighborContexts(std::list<NeighborContext>& neigh_ctx_list);
+    bool enableNextHops(bool update_rt, std::list<MuxRouteBulkContext>& route_ctx_list);
+    bool disableNextHops(sai_object_id_t, std::list<MuxRouteBulkContext>& route_ctx_list,
+                         std::list<NeighborContext>& neigh_ctx_list);
+
+    static bool removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list, EntityBulker<sai_route_api_t>& bulker);
+    static bool addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list, EntityBulker<sai_route_api_t>& bulker);
+
 protected:
-    bool removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list);
-    bool addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list);
+    bool removeRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list) { return removeRoutes(bulk_ctx_list, gRouteBulker); }
+    bool addRoutes(std::list<MuxRouteBulkContext>& bulk_ctx_list) { return addRoutes(bulk_ctx_list, gRouteBulker); }
     bool setBulkRouteNH(std::list<MuxRouteBulkContext>& bulk_ctx_list);
 
     inline void updateTunnelRoute(NextHopKey, bool = true);
@@ -148,11 +158,24 @@ public:
     bool isStateChangeInProgress() { return st_chg_in_progress_; }
     bool isStateChangeFailed() { return st_chg_failed_; }
 
+    // Multi-cable switchover, driven by MuxCableOrch::flushPendingStates
+    bool isBulkStateChangeSupported() const
+    {
+        return (nbr_handler_type_ == MuxNbrHandlerType::NBR_HANDLER_HOST_ROUTE);
+    }
+    bool beginStateChange(string new_state);
+    void endStateChange(bool success);
+    bool prepareBulkStateChange(std::list<NeighborContext>& neigh_ctx_list,
+                                std::list<MuxRouteBulkContext>& route_ctx_list);
+    bool updateBulkNextHops(std::list<MuxRouteBulkContext>& route_ctx_list);
+    bool finishBulkStateChange();
+
     bool isIpInSubnet(IpAddress ip);
 
     // Per-cable IPv6 slice prefix. "::/0" means no slice configured.
     bool hasSlicePrefix() const { return !slice_ip6_.getIp().isZero(); }
     const IpPrefix& getSlicePrefix() const { return slice_ip6_; }
+    const IpPrefix& getServerIp4() const { return srv_ip4_; }
     const IpPrefix& getServerIp6() const { return srv_ip6_; }
     const std::string& getMuxName() const { return mux_name_; }
     bool isIpInSlice(const IpAddress& ip) const
@@ -189,6 +212,7 @@ private:
 
     MuxState state_ = MuxState::MUX_STATE_INIT;
     MuxState prev_state_;
+    MuxStateChange st_chg_ = MuxStateChange::MUX_STATE_UNKNOWN_STATE;
     bool st_chg_in_progress_ = false;
     bool st_chg_failed_ = false;
 
@@ -235,6 +259,27 @@ struct NHTunnel
 
 typedef std::unique_ptr<MuxCable> MuxCable_T;
 typedef std::map<std::string, MuxCable_T> MuxCableTb;
+
+/*
+ * Longest prefix match index of mux cable subnets (IP -> cable).
+ * Nested subnets resolve to the cable with the longest prefix, not to the
+ * first cable by port name.
+ */
+class MuxSubnetIndex
+{
+public:
+    void add(const IpPrefix& pfx, const std::string& port_name, MuxCable* cable);
+    void remove(const IpPrefix& pfx, const std::string& port_name);
+    MuxCable* find(const IpAddress& ip) const;
+
+private:
+    // Subnet -> cables by port name; the first port by name wins when the same subnet is on several cables
+    typedef std::map<IpPrefix, std::map<std::string, MuxCable*>> MuxSubnetTb;
+
+    // Prefix length (longest first) -> subnets of that length
+    std::map<int, MuxSubnetTb, std::greater<int>> v4_subnets_;
+    std::map<int, MuxSubnetTb, std::greater<int>> v6_subnets_;
+};
 typedef std::map<IpAddress, NHTunnel> MuxTunnelNHs;
 typedef std::map<NextHopKey, std::string> NextHopTb;
 typedef std::map<IpPrefix, NextHopKey> MuxRouteTb;
@@ -365,6 +410,8 @@ private:
     sai_object_id_t mux_tunnel_id_ = SAI_NULL_OBJECT_ID;
 
     MuxCableTb mux_cable_tb_;
+    MuxSubnetIndex mux_subnet_idx_;
+    MuxSubnetIndex mux_slice_idx_;
     MuxTunnelNHs mux_tunnel_nh_;
     NextHopTb mux_nexthop_tb_;
 
@@ -413,14 +460,26 @@ public:
     void addTunnelRoute(const NextHopKey &nhKey);
     void removeTunnelRoute(const NextHopKey &nhKey);
 
+    using Orch::doTask;
+
 private:
+    void doTask(Consumer &consumer) override;
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
 
+    void setMuxState(MuxCable* mux_obj, const string& port_name, const string& state);
+    void flushPendingStates();
+    void bulkSetMuxState(const vector<pair<string, string>>& changes);
+    bool bulkStateTransition(const vector<MuxCable*>& cables, size_t& prepared);
+
     unique_ptr<Table> mux_table_;
     MuxCableRequest request_;
     swss::Table mux_metric_table_;
     ProducerStateTable app_tunnel_route_table_;
+
+    // State changes received in the current drain, in arrival order (port, state)
+    vector<pair<string, string>> pending_states_;
+    EntityBulker<sai_route_api_t> route_bulker_;
 };
 
 const request_description_t mux_state_request_description = {
@@ -168,13 +168,9 @@ void NeighOrch::processFDBAdd(const FdbEntry &entry)
     // If the FDB entry MAC matches with neighbor/ARP entry MAC,
     // and ARP entry incoming interface matches with VLAN name,
     // re-enable neighbor/arp entry.
-    for (const auto &neighborEntry : m_syncdNeighbors)
+    for (const auto &neighborEntry : getNeighborsOnAlias(vlan.m_alias, { entry.mac }))
     {
-        if (neighborEntry.first.alias == vlan.m_alias &&
-            neighborEntry.second.mac == entry.mac)
-        {
-            enableNeighbor(neighborEntry.first);
-        }
+        enableNeighbor(neighborEntry);
     }
 }
 
@@ -205,13 +201,9 @@ void NeighOrch::processFDBDelete(const FdbEntry &entry)
     // If the FDB entry MAC matches with neighbor/ARP entry MAC,
     // and ARP entry incoming interface matches with VLAN name,
     // del neighbor/arp entry.
-    for (const auto &neighborEntry : m_syncdNeighbors)
+    for (const auto &neighborEntry : getNeighborsOnAlias(vlan.m_alias, { entry.mac }))
     {
-        if (neighborEntry.first.alias == vlan.m_alias &&
-            neighborEntry.second.mac == entry.mac)
-        {
-            disableNeighbor(neighborEntry.first);
-        }
+        disableNeighbor(neighborEntry);
     }
 }
 
@@ -241,13 +233,9 @@ void NeighOrch::processFDBResolve(const FdbEntry &entry)
     // If the FDB entry MAC matches with neighbor/ARP entry MAC,
     // and ARP entry incoming interface matches with VLAN name,
     // flush neighbor/arp entry.
-    for (const auto &neighborEntry : m_syncdNeighbors)
+    for (const auto &neighborEntry : getNeighborsOnAlias(vlan.m_alias, { entry.mac }))
     {
-        if (neighborEntry.first.alias == vlan.m_alias &&
-            neighborEntry.second.mac == entry.mac)
-        {
-            resolveNeighborEntry(neighborEntry.first, neighborEntry.second.mac);
-        }
+        resolveNeighborEntry(neighborEntry, entry.mac);
     }
     return;
 }
@@ -268,6 +256,8 @@ void NeighOrch::processFDBFlushUpdate(const FdbFlushUpdate& update)
     SWSS_LOG_INFO("processFDBFlushUpdate port: %s",
                     update.port.m_alias.c_str());
 
+    /* Group the flushed MACs by VLAN so each VLAN's neighbors are walked once */
+    map<string, std::set<MacAddress>> vlanMacs;
     for (auto entry : update.entries)
     {
         // Get Vlan object
@@ -278,19 +268,20 @@ void NeighOrch::processFDBFlushUpdate(const FdbFlushUpdate& update)
                              from bv_id 0x%" PRIx64 ".", entry.bv_id);
             continue;
         }
-        SWSS_LOG_INFO("Flushing ARP for port: %s, VLAN: %s",
-                      vlan.m_alias.c_str(), update.port.m_alias.c_str());
+        vlanMacs[vlan.m_alias].insert(entry.mac);
+    }
+
+    for (const auto &vlanMac : vlanMacs)
+    {
+        SWSS_LOG_INFO("Flushing ARP for port: %s, VLAN: %s, %zu MACs",
+                      update.port.m_alias.c_str(), vlanMac.first.c_str(), vlanMac.second.size());
 
         // If the FDB entry MAC matches with neighbor/ARP entry MAC,
         // and ARP entry incoming interface matches with VLAN name,
         // flush neighbor/arp entry.
-        for (const auto &neighborEntry : m_syncdNeighbors)
+        for (const auto &neighborEntry : getNeighborsOnAlias(vlanMac.first, vlanMac.second))
         {
-            if (neighborEntry.first.alias == vlan.m_alias &&
-                neighborEntry.second.mac == entry.mac)
-            {
-                resolveNeighborEntry(neighborEntry.first, neighborEntry.second.mac);
-            }
+            resolveNeighborEntry(neighborEntry, m_syncdNeighbors.at(neighborEntry).mac);
         }
     }
     return;
@@ -456,6 +447,7 @@ bool NeighOrch::addNextHop(NeighborContext& ctx)
     next_hop_entry.ref_count = 0;
     next_hop_entry.nh_flags = 0;
     m_syncdNextHops[nexthop] = next_hop_entry;
+    addNextHopIndex(nexthop);
 
     m_intfsOrch->increaseRouterIntfsRefCount(nh.alias);
 
@@ -548,6 +540,7 @@ bool NeighOrch::processBulkAddNextHop(NeighborContext& ctx)
     next_hop_entry.ref_count = 0;
     next_hop_entry.nh_flags = 0;
     m_syncdNextHops[nexthop] = next_hop_entry;
+    addNextHopIndex(nexthop);
 
     m_intfsOrch->increaseRouterIntfsRefCount(nh.alias);
 
@@ -670,37 +663,141 @@ bool NeighOrch::isNextHopFlagSet(const NextHopKey &nexthop, const uint32_t nh_fl
 bool NeighOrch::ifChangeInformNextHop(const string &alias, bool if_up)
 {
     SWSS_LOG_ENTER();
-    bool rc = true;
 
-    for (auto nhop = m_syncdNextHops.begin(); nhop != m_syncdNextHops.end(); ++nhop)
+    auto index = m_syncdNextHopsByAlias.find(alias);
+    if (index == m_syncdNextHopsByAlias.end())
+    {
+        return true;
+    }
+
+    vector<NextHopKey> nexthops(index->second.begin(), index->second.end());
+
+    return setNextHopsIfDownFlag(nexthops, !if_up);
+}
+
+/*
+ * Set or clear NHFLAGS_IFDOWN on a batch of next hops. The next hop group
+ * members of all of them are removed or re-added in one bulk call.
+ */
+bool NeighOrch::setNextHopsIfDownFlag(const vector<NextHopKey> &nexthops, bool if_down)
+{
+    SWSS_LOG_ENTER();
+
+    vector<NextHopKey> changed;
+    for (const auto &nexthop : nexthops)
     {
-        if (nhop->first.alias != alias)
+        auto nhop = m_syncdNextHops.find(nexthop);
+        if (nhop == m_syncdNextHops.end())
         {
             continue;
         }
 
-        if (if_up)
+        if (!!(nhop->second.nh_flags & NHFLAGS_IFDOWN) == if_down)
         {
-            rc = clearNextHopFlag(nhop->first, NHFLAGS_IFDOWN);
-        }
-        else
-        {
-            rc = setNextHopFlag(nhop->first, NHFLAGS_IFDOWN);
+            continue;
         }
 
-        if (rc == true)
+        SWSS_LOG_INFO("%s NHFLAGS_IFDOWN on %s seen on port %s", if_down ? "Set" : "Clear",
+                      nexthop.ip_address.to_string().c_str(), nexthop.alias.c_str());
+
+        if (if_down)
         {
-            continue;
+            nhop->second.nh_flags |= NHFLAGS_IFDOWN;
         }
         else
         {
-            break;
+            nhop->second.nh_flags &= ~NHFLAGS_IFDOWN;
         }
+        changed.push_back(nexthop);
+    }
+
+    if (changed.empty())
+    {
+        return true;
+    }
+
+    bool rc;
+    uint32_t count;
+    if (if_down)
+    {
+        rc = gRouteOrch->invalidnexthopsinNextHopGroup(changed, count);
+    }
+    else
+    {
+        rc = gRouteOrch->validnexthopsinNextHopGroup(changed, count);
+    }
+
+    for (const auto &nexthop : changed)
+    {
+        rc &= if_down ? gNhgOrch->invalidateNextHop(nexthop) : gNhgOrch->validateNextHop(nexthop);
     }
 
     return rc;
 }
 
+void NeighOrch::addNeighborIndex(const NeighborEntry &entry)
+{
+    m_syncdNeighborsByAlias[entry.alias].insert(entry);
+}
+
+void NeighOrch::removeNeighborIndex(const NeighborEntry &entry)
+{
+    auto index = m_syncdNeighborsByAlias.find(entry.alias);
+    if (index == m_syncdNeighborsByAlias.end())
+    {
+        return;
+    }
+
+    index->second.erase(entry);
+    if (index->second.empty())
+    {
+        m_syncdNeighborsByAlias.erase(index);
+    }
+}
+
+void NeighOrch::addNextHopIndex(const NextHopKey &nexthop)
+{
+    m_syncdNextHopsByAlias[nexthop.alias].insert(nexthop);
+}
+
+void NeighOrch::removeNextHopIndex(const NextHopKey &nexthop)
+{
+    auto index = m_syncdNextHopsByAlias.find(nexthop.alias);
+    if (index == m_syncdNextHopsByAlias.end())
+    {
+        return;
+    }
+
+    index->second.erase(nexthop);
+    if (index->second.empty())
+    {
+        m_syncdNextHopsByAlias.erase(index);
+    }
+}
+
+/* Synced neighbors learnt on the interface whose MAC is one of macs */
+vector<NeighborEntry> NeighOrch::getNeighborsOnAlias(const string &alias, const std::set<MacAddress> &macs)
+{
+    vector<NeighborEntry> neighbors;
+
+    auto index = m_syncdNeighborsByAlias.find(alias);
+    if (index == m_syncdNeighborsByAlias.end())
+    {
+        return neighbors;
+    }
+
+    for (const auto &entry : index->second)
+    {
+        auto neighbor = m_syncdNeighbors.find(entry);
+        if (neighbor != m_syncdNeighbors.end() && macs.count(neighbor->second.mac))
+        {
+            neighbors.push_back(entry);
+        }
+    }
+
+    return neighbors;
+}
+
 void NeighOrch::updateNextHop(const BfdUpdate& update)
 {
     SWSS_LOG_ENTER();
@@ -784,6 +881,7 @@ bool NeighOrch::removeNextHop(const IpAddress &ipAddress, const string &alias)
     }
 
     m_syncdNextHops.erase(nexthop);
+    removeNextHopIndex(nexthop);
     m_intfsOrch->decreaseRouterIntfsRefCount(alias);
     return true;
 }
@@ -852,6 +950,7 @@ bool NeighOrch::removeMplsNextHop(const NextHopKey& nh)
     }
 
     m_syncdNextHops.erase(nexthop);
+    removeNextHopIndex(nexthop);
     m_intfsOrch->decreaseRouterIntfsRefCount(nexthop.alias);
     return true;
 }
@@ -870,6 +969,7 @@ bool NeighOrch::removeOverlayNextHop(const NextHopKey &nexthop)
     }
 
     m_syncdNextHops.erase(nexthop);
+    removeNextHopIndex(nexthop);
     return true;
 }
 
@@ -1473,6 +1573,7 @@ bool NeighOrch::addNeighbor(NeighborContext& ctx)
             /* The fdb is still in vxlan port, just save neighbor info */
             SWSS_LOG_NOTICE("Mac %s is still in vxlan port, skip hw programming!", macAddress.to_string().c_str());
             m_syncdNeighbors[neighborEntry] = { macAddress, hw_config, 0, prefix_route };
+            addNeighborIndex(neighborEntry);
             return true;
         }
     }
@@ -1585,6 +1686,7 @@ bool NeighOrch::addNeighbor(NeighborContext& ctx)
     }
 
     m_syncdNeighbors[neighborEntry] = { macAddress, hw_config, 0, prefix_route };
+    addNeighborIndex(neighborEntry);
 
     NeighborUpdate update = { neighborEntry, macAddress, true };
     notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
@@ -1764,6 +1866,7 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
     }
 
     m_syncdNeighbors.erase(neighborEntry);
+    removeNeighborIndex(neighborEntry);
 
     NeighborUpdate update = { neighborEntry, MacAddress(), false };
     notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
@@ -1878,6 +1981,7 @@ bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx)
     }
 
     m_syncdNeighbors[neighborEntry] = { macAddress, true };
+    addNeighborIndex(neighborEntry);
 
     NeighborUpdate update = { neighborEntry, macAddress, true };
     notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
@@ -2180,6 +2284,7 @@ sai_object_id_t NeighOrch::addTunnelNextHop(const NextHopKey& nh)
     next_hop_entry.ref_count = 0;
     next_hop_entry.nh_flags = 0;
     m_syncdNextHops[nh] = next_hop_entry;
+    addNextHopIndex(nh);
 
     return nh_id;
 }
@@ -2905,6 +3010,7 @@ void NeighOrch::updateSrv6Nexthop(const NextHopKey &nh, const sai_object_id_t &n
         next_hop_entry.ref_count = 0;
         next_hop_entry.nh_flags = 0;
         m_syncdNextHops[nh] = next_hop_entry;
+        addNextHopIndex(nh);
         gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SRV6_NEXTHOP);
     }
     else
@@ -2912,6 +3018,7 @@ void NeighOrch::updateSrv6Nexthop(const NextHopKey &nh, const sai_object_id_t &n
         assert(m_syncdNextHops[nh].ref_count == 0);
         gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SRV6_NEXTHOP);
         m_syncdNextHops.erase(nh);
+        removeNextHopIndex(nh);
     }
 }
 
@@ -2924,6 +3031,7 @@ bool NeighOrch::addZeroMacTunnelRoute(const NeighborEntry& entry, const MacAddre
     if (mux_orch->isStandaloneTunnelRouteInstalled(entry.ip_address))
     {
         m_syncdNeighbors[entry] = { mac, false };
+        addNeighborIndex(entry);
         return true;
     }
 
@@ -2933,28 +3041,23 @@ bool NeighOrch::addZeroMacTunnelRoute(const NeighborEntry& entry, const MacAddre
 bool NeighOrch::ifChangeInformRemoteNextHop(const string &alias, bool if_up)
 {
     SWSS_LOG_ENTER();
-    bool rc = true;
     Port inbp;
     gPortsOrch->getInbandPort(inbp);
-    for (auto nbr = m_syncdNeighbors.begin(); nbr != m_syncdNeighbors.end(); ++nbr)
+
+    auto index = m_syncdNeighborsByAlias.find(alias);
+    if (index == m_syncdNeighborsByAlias.end())
     {
-        if (nbr->first.alias != alias)
-        {
-            continue;
-        }
-        SWSS_LOG_INFO("Found remote Neighbor %s on %s", nbr->first.ip_address.to_string().c_str(), alias.c_str());
-        NextHopKey nhop = { nbr->first.ip_address, inbp.m_alias };
+        return true;
+    }
 
-        if (if_up)
-        {
-            rc = clearNextHopFlag(nhop, NHFLAGS_IFDOWN);
-        }
-        else
-        {
-            rc = setNextHopFlag(nhop, NHFLAGS_IFDOWN);
-        }
+    vector<NextHopKey> nexthops;
+    for (const auto &nbr : index->second)
+    {
+        SWSS_LOG_INFO("Found remote Neighbor %s on %s", nbr.ip_address.to_string().c_str(), alias.c_str());
+        nexthops.push_back({ nbr.ip_address, inbp.m_alias });
     }
-    return rc;
+
+    return setNextHopsIfDownFlag(nexthops, !if_up);
 }
 
 void NeighOrch::clearBulkers()
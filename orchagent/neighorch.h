@@ -135,6 +135,10 @@ private:
     NeighborTable m_syncdNeighbors;
     NextHopTable m_syncdNextHops;
 
+    /* Keys of m_syncdNeighbors and m_syncdNextHops by interface alias */
+    map<string, std::set<NeighborEntry>> m_syncdNeighborsByAlias;
+    map<string, std::set<NextHopKey>> m_syncdNextHopsByAlias;
+
     std::set<NextHopKey> m_neighborToResolve;
 
     EntityBulker<sai_neighbor_api_t> gNeighBulker;
@@ -150,6 +154,13 @@ private:
 
     bool setNextHopFlag(const NextHopKey &, const uint32_t);
     bool clearNextHopFlag(const NextHopKey &, const uint32_t);
+    bool setNextHopsIfDownFlag(const vector<NextHopKey> &, bool);
+
+    void addNeighborIndex(const NeighborEntry &);
+    void removeNeighborIndex(const NeighborEntry &);
+    void addNextHopIndex(const NextHopKey &);
+    void removeNextHopIndex(const NextHopKey &);
+    vector<NeighborEntry> getNeighborsOnAlias(const string &, const std::set<MacAddress> &);
 
     bool addPrefixRouteForNeighbor(const IpAddress& ip_address, string& alias,
                                     sai_object_id_t next_hop_id, bool is_active);
@@ -10,8 +10,13 @@
 #include "consumerstatetable.h"
 #include "zmqserver.h"
 #include "zmqconsumerstatetable.h"
+#include "rediscommand.h"
+#include "redisreply.h"
 #include "sai_serialize.h"
 
+/* Number of HGETALL commands sent before reading their replies on warm restore */
+#define WARM_RESTORE_PIPELINE_SIZE 1024
+
 using namespace swss;
 
 int gBatchSize = 0;
@@ -428,6 +433,14 @@ size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries
 // TODO: Table should be const
 size_t ConsumerBase::refillToSync(Table* table)
 {
+    auto prefetched = m_prefetchedTables.find(table);
+    if (prefetched != m_prefetchedTables.end())
+    {
+        size_t refilled = addToSync(prefetched->second);
+        m_prefetchedTables.erase(prefetched);
+        return refilled;
+    }
+
     std::deque<KeyOpFieldsValuesTuple> entries;
     vector<string> keys;
     table->getKeys(keys);
@@ -450,6 +463,14 @@ size_t ConsumerBase::refillToSync(Table* table)
 
 size_t ConsumerBase::refillToSync()
 {
+    if (m_hasPrefetchedData)
+    {
+        size_t refilled = addToSync(m_prefetchedData);
+        m_hasPrefetchedData = false;
+        std::deque<KeyOpFieldsValuesTuple>().swap(m_prefetchedData);
+        return refilled;
+    }
+
     auto subTable = dynamic_cast<SubscriberStateTable *>(getSelectable());
     if (subTable != NULL)
     {
@@ -483,6 +504,110 @@ size_t ConsumerBase::refillToSync()
     return 0;
 }
 
+const DBConnector *ConsumerBase::getRefillDbConnector() const
+{
+    auto consumerTable = dynamic_cast<ConsumerTableBase *>(getSelectable());
+    if (consumerTable != NULL)
+    {
+        return consumerTable->getDbConnector();
+    }
+
+    auto zmqTable = dynamic_cast<ZmqConsumerStateTable *>(getSelectable());
+    if (zmqTable != NULL)
+    {
+        return zmqTable->getDbConnector();
+    }
+
+    // SubscriberStateTable consumers refill from their own channel
+    return nullptr;
+}
+
+// Read the content of a table with KEYS and pipelined HGETALL
+static void readTable(DBConnector *db, const string &tableName, std::deque<KeyOpFieldsValuesTuple> &entries)
+{
+    Table table(db, tableName);
+    vector<string> keys;
+    table.getKeys(keys);
+
+    redisContext *ctx = db->getContext();
+
+    for (size_t start = 0; start < keys.size(); start += WARM_RESTORE_PIPELINE_SIZE)
+    {
+        size_t end = std::min(keys.size(), start + WARM_RESTORE_PIPELINE_SIZE);
+
+        for (size_t i = start; i < end; i++)
+        {
+            RedisCommand hgetall;
+            hgetall.format("HGETALL %s", table.getKeyName(keys[i]).c_str());
+            if (redisAppendFormattedCommand(ctx, hgetall.c_str(), hgetall.length()) != REDIS_OK)
+            {
+                throw std::runtime_error("Failed to queue HGETALL for " + tableName);
+            }
+        }
+
+        for (size_t i = start; i < end; i++)
+        {
+            redisReply *rawReply = nullptr;
+            if (redisGetReply(ctx, reinterpret_cast<void **>(&rawReply)) != REDIS_OK || rawReply == nullptr)
+            {
+                throw std::runtime_error("Failed to read HGETALL reply for " + tableName);
+            }
+
+            RedisReply reply(rawReply);
+            auto ctxReply = reply.getContext();
+
+            // The key may have been removed since KEYS was issued
+            if (ctxReply->type != REDIS_REPLY_ARRAY || ctxReply->elements == 0)
+            {
+                continue;
+            }
+
+            KeyOpFieldsValuesTuple kco;
+            kfvKey(kco) = keys[i];
+            kfvOp(kco) = SET_COMMAND;
+
+            for (size_t j = 0; j + 1 < ctxReply->elements; j += 2)
+            {
+                kfvFieldsValues(kco).emplace_back(ctxReply->element[j]->str, ctxReply->element[j + 1]->str);
+            }
+
+            entries.push_back(std::move(kco));
+        }
+    }
+}
+
+size_t ConsumerBase::prefetchExistingData(DBConnector *db)
+{
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    readTable(db, getTableName(), entries);
+
+    m_prefetchedData.swap(entries);
+    m_hasPrefetchedData = true;
+
+    return m_prefetchedData.size();
+}
+
+size_t ConsumerBase::prefetchExistingData(Table *table, DBConnector *db)
+{
+    auto &entries = m_prefetchedTables[table];
+    entries.clear();
+    readTable(db, table->getTableName(), entries);
+
+    return entries.size();
+}
+
+void ConsumerBase::addRefillTable(Table *table, const DBConnector *db)
+{
+    m_refillTables.emplace_back(table, db);
+}
+
+void ConsumerBase::clearPrefetchedData()
+{
+    m_hasPrefetchedData = false;
+    std::deque<KeyOpFieldsValuesTuple>().swap(m_prefetchedData);
+    m_prefetchedTables.clear();
+}
+
 string ConsumerBase::dumpTuple(const KeyOpFieldsValuesTuple &tuple)
 {
     string s = getTableName() + getConsumerTable()->getTableNameSeparator() + kfvKey(tuple)
@@ -683,6 +808,19 @@ size_t Orch::addExistingData(Table *table)
     return consumer->refillToSync(table);
 }
 
+void Orch::getConsumers(vector<ConsumerBase *> &consumers)
+{
+    for (auto &it : m_consumerMap)
+    {
+        auto consumer = dynamic_cast<ConsumerBase *>(it.second.get());
+        if (consumer != NULL &&
+            (consumer->getRefillDbConnector() != nullptr || !consumer->getRefillTables().empty()))
+        {
+            consumers.push_back(consumer);
+        }
+    }
+}
+
 bool Orch::bake()
 {
     SWSS_LOG_ENTER();
@@ -218,6 +218,27 @@ public:
     size_t refillToSync();
     size_t refillToSync(swss::Table* table);
 
+    /*
+     * Warm restore read-ahead: the table content is read through the given
+     * connection (possibly from another thread) before bake() runs, and
+     * the next refillToSync() hands it to m_toSync instead of reading Redis.
+     */
+    const swss::DBConnector *getRefillDbConnector() const;
+    size_t prefetchExistingData(swss::DBConnector *db);
+    void clearPrefetchedData();
+
+    /*
+     * Other tables the orch bake() refills this consumer from with
+     * refillToSync(table); they are read ahead along with the consumer
+     * table, through a connection to the given database.
+     */
+    void addRefillTable(swss::Table *table, const swss::DBConnector *db);
+    const std::vector<std::pair<swss::Table *, const swss::DBConnector *>> &getRefillTables() const
+    {
+        return m_refillTables;
+    }
+    size_t prefetchExistingData(swss::Table *table, swss::DBConnector *db);
+
     // Set the m_orderedQueue flag.
     // This will change the ConsumerBase to use m_toSync or m_toSyncQueue.
     void setOrderedQueue(bool orderedQueue)
@@ -228,6 +249,12 @@ public:
 private:
     void addToSyncInternal(const swss::KeyOpFieldsValuesTuple &entry, bool onRetry, bool recordTask);
     bool m_recordable = true;
+
+    bool m_hasPrefetchedData = false;
+    std::deque<swss::KeyOpFieldsValuesTuple> m_prefetchedData;
+
+    std::vector<std::pair<swss::Table *, const swss::DBConnector *>> m_refillTables;
+    std::map<swss::Table *, std::deque<swss::KeyOpFieldsValuesTuple>> m_prefetchedTables;
 };
 
 class RingBuffer
@@ -359,7 +386,10 @@ public:
     virtual void onWarmBootEnd() { }
 
     void dumpPendingTasks(std::vector<std::string> &ts);
-    
+
+    // Append the consumers of this orch backed by tables or with refill tables, used for warm restore read-ahead
+    void getConsumers(std::vector<ConsumerBase *> &consumers);
+
     void createRetryCache(const std::string &executorName);
     RetryCache* getRetryCache(const std::string &executorName);
     ConsumerBase* getConsumerBase(const std::string &executorName);
@@ -4,6 +4,10 @@
 #include <limits.h>
 #include <errno.h>
 #include <signal.h>
+#include <cxxabi.h>
+#include <inttypes.h>
+#include <atomic>
+#include <thread>
 #include "orchdaemon.h"
 #include "logger.h"
 #include <sairedis.h>
@@ -26,6 +30,10 @@ using namespace swss;
 #define SELECT_TIMEOUT 1000
 #define PFC_WD_POLL_MSECS 100
 
+/* Upper bound of threads reading tables ahead of bake() on warm restore */
+#define WARM_RESTORE_PREFETCH_THREADS_MAX 8
+#define STATE_WARM_RESTORE_BAKE_TABLE_NAME      "WARM_RESTORE_BAKE_TABLE"
+
 #define APP_FABRIC_MONITOR_PORT_TABLE_NAME      "FABRIC_PORT_TABLE"
 #define APP_FABRIC_MONITOR_DATA_TABLE_NAME      "FABRIC_MONITOR_TABLE"
 
@@ -1000,16 +1008,15 @@ void OrchDaemon::handleTaskStatsQuery()
 
     if (op == "show")
     {
-        reply_values.reserve(m_taskStats.size());
+        reply_values.reserve(m_taskStats.size() + getOrchOpStats().size());
         // Helper: round a P^2 double estimate to a non-negative uint64.
         auto round_p2 = [](double v) -> uint64_t
         {
             return static_cast<uint64_t>(v < 0.0 ? 0.0 : v + 0.5);
         };
 
-        for (auto &kv : m_taskStats)
+        auto serialize = [&](const std::string &name, const ExecutorStat &s)
         {
-            auto &s = kv.second;
             // Pipe-separated, 14 fields:
             //   count | total_run_ns
             //   | median_run_ns | q1_run_ns | q3_run_ns | max_run_ns
@@ -1039,7 +1046,17 @@ void OrchDaemon::handleTaskStatsQuery()
                           + std::to_string(q1_sched) + "|"
                           + std::to_string(q3_sched) + "|"
                           + std::to_string(s.sched_max_ns);
-            reply_values.emplace_back(kv.first, v);
+            reply_values.emplace_back(name, v);
+        };
+
+        for (auto &kv : m_taskStats)
+        {
+            serialize(kv.first, kv.second);
+        }
+        // Operations timed inside an Orch (see taskstats.h)
+        for (auto &kv : getOrchOpStats())
+        {
+            serialize(kv.first, kv.second);
         }
         m_taskStatsReply->send("ok", "", reply_values);
     }
@@ -1049,6 +1066,10 @@ void OrchDaemon::handleTaskStatsQuery()
         {
             kv.second.reset();
         }
+        for (auto &kv : getOrchOpStats())
+        {
+            kv.second.reset();
+        }
         m_taskStatsReply->send("ok", "", reply_values);
     }
     else
@@ -1259,6 +1280,112 @@ void exit_if_graceful_shutdown_requested(void (*exit_fn)(int))
     exit_fn(0);
 }
 
+string OrchDaemon::getOrchName(Orch *o)
+{
+    int status = 0;
+    const char *mangled = typeid(*o).name();
+    char *demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    string name = (status == 0 && demangled != nullptr) ? demangled : mangled;
+    free(demangled);
+    return name;
+}
+
+/*
+ * Read the content of every table backed consumer ahead of bake(). Tables are
+ * spread over a few threads, each with its own Redis connections, and every
+ * table is read with pipelined HGETALL. Consumers which fail to prefetch fall
+ * back to the regular serial read in refillToSync().
+ */
+void OrchDaemon::prefetchWarmRestoreData()
+{
+    SWSS_LOG_ENTER();
+
+    vector<ConsumerBase *> consumers;
+    for (Orch *o : m_orchList)
+    {
+        o->getConsumers(consumers);
+    }
+
+    if (consumers.empty())
+    {
+        return;
+    }
+
+    size_t threadCount = min<size_t>(WARM_RESTORE_PREFETCH_THREADS_MAX, max(1u, thread::hardware_concurrency()));
+    threadCount = min(threadCount, consumers.size());
+
+    atomic<size_t> next(0);
+    atomic<size_t> totalEntries(0);
+    auto start = chrono::steady_clock::now();
+
+    auto worker = [&]()
+    {
+        // Connections are per thread, hiredis contexts must not be shared
+        map<const DBConnector *, unique_ptr<DBConnector>> connectors;
+
+        auto connect = [&](const DBConnector *db)
+        {
+            auto &conn = connectors[db];
+            if (!conn)
+            {
+                conn.reset(db->newConnector(0));
+            }
+            return conn.get();
+        };
+
+        for (size_t i = next++; i < consumers.size(); i = next++)
+        {
+            auto consumer = consumers[i];
+            auto db = consumer->getRefillDbConnector();
+
+            try
+            {
+                if (db != nullptr)
+                {
+                    totalEntries += consumer->prefetchExistingData(connect(db));
+                }
+
+                // The other tables the orch bake() refills the consumer from
+                for (const auto &refill : consumer->getRefillTables())
+                {
+                    totalEntries += consumer->prefetchExistingData(refill.first, connect(refill.second));
+                }
+            }
+            catch (const exception &e)
+            {
+                SWSS_LOG_WARN("Warm restore: failed to prefetch %s, fall back to serial read: %s",
+                              consumer->getName().c_str(), e.what());
+                consumer->clearPrefetchedData();
+                // The failed connection may be left with unread replies
+                connectors.clear();
+            }
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back(worker);
+    }
+
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+    SWSS_LOG_NOTICE("Warm restore: prefetched %zu entries of %zu tables with %zu threads in %" PRId64 " ms",
+                    totalEntries.load(), consumers.size(), threadCount, static_cast<int64_t>(elapsed.count()));
+
+    Table bakeTable(m_stateDb, STATE_WARM_RESTORE_BAKE_TABLE_NAME);
+    bakeTable.set("PREFETCH", {
+        { "tables", to_string(consumers.size()) },
+        { "entries", to_string(totalEntries.load()) },
+        { "threads", to_string(threadCount) },
+        { "time_ms", to_string(elapsed.count()) }
+    });
+}
+
 /*
  * Try to perform orchagent state restore and dynamic states sync up if
  * warm start request is detected.
@@ -1272,9 +1399,30 @@ bool OrchDaemon::warmRestoreAndSyncUp()
     // Configure response publisher before warm-boot starts.
     configureResponsePublisherForWarmBoot(/*warm_boot_start=*/true);
 
+    prefetchWarmRestoreData();
+
+    // Tables were read ahead in parallel, bake them in the orch dependency order
+    Table bakeTable(m_stateDb, STATE_WARM_RESTORE_BAKE_TABLE_NAME);
     for (Orch *o : m_orchList)
     {
+        auto start = chrono::steady_clock::now();
         o->bake();
+        auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+
+        string orchName = getOrchName(o);
+        SWSS_LOG_NOTICE("Warm restore: %s bake took %" PRId64 " ms", orchName.c_str(), static_cast<int64_t>(elapsed.count()));
+        bakeTable.hset(orchName, "bake_time_ms", to_string(elapsed.count()));
+    }
+
+    // Read-ahead data not consumed by bake() (e.g. an orch fell back to cold start) must not leak into later refills
+    for (Orch *o : m_orchList)
+    {
+        vector<ConsumerBase *> consumers;
+        o->getConsumers(consumers);
+        for (auto consumer : consumers)
+        {
+            consumer->clearPrefetchedData();
+        }
     }
 
     // let's cache the neighbor updates in mux orch and
@@ -414,6 +414,9 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
             m_applDb.get(), APP_PFC_WD_TABLE_NAME, TableConsumable::DEFAULT_POP_BATCH_SIZE, default_orch_pri);
     auto ssConsumer = new Consumer(ssTable, this, APP_PFC_WD_TABLE_NAME);
     Orch::addExecutor(ssConsumer);
+
+    // bake() refills the consumer from the storm table
+    ssConsumer->addRefillTable(m_applTable.get(), m_applDb.get());
 }
 
 template <typename DropHandler, typename ForwardHandler>
@@ -23,6 +23,7 @@
 #include <tuple>
 #include <sstream>
 #include <unordered_set>
+#include <functional>
 
 #include <netinet/if_ether.h>
 #include "net/if.h"
@@ -76,6 +77,7 @@ extern EvpnMhOrch *gEvpnMhOrch;
 extern event_handle_t g_events_handle;
 extern bool isChassisDbInUse();
 extern bool gMultiAsicVoq;
+extern size_t gMaxBulkSize;
 
 // defines ------------------------------------------------------------------------------------------------------------
 
@@ -146,6 +148,37 @@ struct PortBulker
         sai_port_api->get_ports_attribute(count, oids.data(), attrCount.data(),
             attrs.data(), errorMode, statuses.data());
     }
+
+    /*
+     * Each object id must appear only once per call. When the vendor does not
+     * implement bulk set, fall back to one set_port_attribute per object and
+     * remember that in bulkSupported so later calls skip the bulk attempt.
+     */
+    void executeSet(bool &bulkSupported, sai_bulk_op_error_mode_t errorMode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (bulkSupported && sai_port_api->set_ports_attribute)
+        {
+            sai_status_t status = sai_port_api->set_ports_attribute(count, oids.data(),
+                attrList.data(), errorMode, statuses.data());
+            if (status != SAI_STATUS_NOT_IMPLEMENTED && status != SAI_STATUS_NOT_SUPPORTED)
+            {
+                return;
+            }
+
+            SWSS_LOG_NOTICE("Bulk port set is not supported, falling back to per-port set");
+            bulkSupported = false;
+        }
+
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            statuses[idx] = sai_port_api->set_port_attribute(oids[idx], &attrList[idx]);
+        }
+    }
 };
 
 // constants ----------------------------------------------------------------------------------------------------------
@@ -780,6 +813,7 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
                 ref(wred_port_stat_manager),
                 ref(wred_queue_stat_manager)
             }),
+        m_lagMemberBulker(sai_lag_api, gSwitchId, gMaxBulkSize),
         m_port_state_poller(new SelectableTimer(timespec { .tv_sec = PORT_STATE_POLLING_SEC, .tv_nsec = 0 })),
         m_isWarmRestoreStage(WarmStart::isWarmStart())
 {
@@ -2305,6 +2339,15 @@ bool PortsOrch::setPortAdminStatus(Port &port, bool state)
     attr.id = SAI_PORT_ATTR_ADMIN_STATE;
     attr.value.booldata = state;
 
+    preSetPortAdminStatus(port, state);
+
+    sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
+
+    return postSetPortAdminStatus(port, state, status);
+}
+
+void PortsOrch::preSetPortAdminStatus(const Port &port, bool state)
+{
     // if sync between cmis module configuration and asic is supported,
     // do not change host_tx_ready value in STATE DB when admin status is changed.
 
@@ -2315,8 +2358,10 @@ bool PortsOrch::setPortAdminStatus(Port &port, bool state)
         SWSS_LOG_NOTICE("Set admin status DOWN host_tx_ready to false for port %s",
                 port.m_alias.c_str());
     }
+}
 
-    sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
+bool PortsOrch::postSetPortAdminStatus(const Port &port, bool state, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to set admin status %s for port %s."
@@ -2397,17 +2442,27 @@ bool PortsOrch::setPortMtu(const Port& port, sai_uint32_t mtu)
     SWSS_LOG_ENTER();
 
     sai_attribute_t attr;
+    getPortMtuAttr(port, mtu, attr);
+
+    sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
+
+    return postSetPortMtu(port, mtu, attr, status);
+}
+
+void PortsOrch::getPortMtuAttr(const Port& port, sai_uint32_t mtu, sai_attribute_t &attr) const
+{
     attr.id = SAI_PORT_ATTR_MTU;
     /* mtu + 14 + 4 + 4 = 22 bytes */
-    mtu += (uint32_t)(sizeof(struct ether_header) + FCS_LEN + VLAN_TAG_LEN);
-    attr.value.u32 = mtu;
+    attr.value.u32 = mtu + (uint32_t)(sizeof(struct ether_header) + FCS_LEN + VLAN_TAG_LEN);
 
     if (isMACsecPort(port.m_port_id))
     {
         attr.value.u32 += MAX_MACSEC_SECTAG_SIZE;
     }
+}
 
-    sai_status_t status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
+bool PortsOrch::postSetPortMtu(const Port& port, sai_uint32_t mtu, const sai_attribute_t &attr, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to set MTU %u to port pid:%" PRIx64 ", rv:%d",
@@ -2421,6 +2476,7 @@ bool PortsOrch::setPortMtu(const Port& port, sai_uint32_t mtu)
 
     if (m_gearboxEnabled)
     {
+        mtu += (uint32_t)(sizeof(struct ether_header) + FCS_LEN + VLAN_TAG_LEN);
         setGearboxPortsAttr(port, SAI_PORT_ATTR_MTU, &mtu);
     }
     SWSS_LOG_INFO("Set MTU %u to port pid:%" PRIx64, attr.value.u32, port.m_port_id);
@@ -2437,6 +2493,12 @@ bool PortsOrch::setPortTpid(Port &port, sai_uint16_t tpid)
     attr.value.u16 = tpid;
 
     auto status = sai_port_api->set_port_attribute(port.m_port_id, &attr);
+
+    return postSetPortTpid(port, attr, status);
+}
+
+bool PortsOrch::postSetPortTpid(const Port &port, const sai_attribute_t &attr, sai_status_t status)
+{
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to set TPID 0x%x to port %s, rv:%d",
@@ -4504,7 +4566,8 @@ bool PortsOrch::bake()
         m_pendingPortSet.emplace(alias);
     }
 
-    addExistingData(m_portTable.get());
+    // Same table as m_portTable, refilled from the warm restore read-ahead
+    addExistingData(APP_PORT_TABLE_NAME);
     addExistingData(APP_LAG_TABLE_NAME);
     addExistingData(APP_LAG_MEMBER_TABLE_NAME);
     addExistingData(APP_VLAN_TABLE_NAME);
@@ -4727,6 +4790,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
 
             SWSS_LOG_INFO("Got PortConfigDone notification from portsyncd");
 
+            flushPendingPortAttrs(consumer);
             it = taskMap.begin();
             continue;
         }
@@ -4754,6 +4818,12 @@ void PortsOrch::doPortTask(Consumer &consumer)
             continue;
         }
 
+        /* Apply what an earlier update of this port left pending before handling the next one */
+        if (m_pendingPortAttrs.find(key) != m_pendingPortAttrs.end())
+        {
+            flushPendingPortAttrs(consumer);
+        }
+
         PortConfig pCfg(key, op);
 
         if (op == SET_COMMAND)
@@ -5394,34 +5464,10 @@ void PortsOrch::doPortTask(Consumer &consumer)
                 {
                     if (p.m_mtu != pCfg.mtu.value)
                     {
-                        if (!setPortMtu(p, pCfg.mtu.value))
-                        {
-                            SWSS_LOG_ERROR(
-                                "Failed to set port %s MTU to %u",
-                                p.m_alias.c_str(), pCfg.mtu.value
-                            );
-                            it++;
-                            continue;
-                        }
-
-                        p.m_mtu = pCfg.mtu.value;
-                        m_portList[p.m_alias] = p;
-
-                        if (p.m_rif_id)
-                        {
-                            gIntfsOrch->setRouterIntfsMtu(p);
-                        }
-                        if (gP4Orch)
-                        {
-                            gP4Orch->setRouterIntfsMtu(p.m_alias, p.m_mtu);
-                        }
-                        // Sub interfaces inherit parent physical port mtu
-                        updateChildPortsMtu(p, pCfg.mtu.value);
-
-                        SWSS_LOG_NOTICE(
-                            "Set port %s MTU to %u",
-                            p.m_alias.c_str(), pCfg.mtu.value
-                        );
+                        /* Applied in bulk by flushPendingPortAttrs() */
+                        auto &pending = m_pendingPortAttrs[p.m_alias];
+                        pending.mtuSet = true;
+                        pending.mtu = pCfg.mtu.value;
                     }
                 }
 
@@ -5429,23 +5475,10 @@ void PortsOrch::doPortTask(Consumer &consumer)
                 {
                     if (p.m_tpid != pCfg.tpid.value)
                     {
-                        if (!setPortTpid(p, pCfg.tpid.value))
-                        {
-                            SWSS_LOG_ERROR(
-                                "Failed to set port %s TPID to 0x%x",
-                                p.m_alias.c_str(), pCfg.tpid.value
-                            );
-                            it++;
-                            continue;
-                        }
-
-                        p.m_tpid = pCfg.tpid.value;
-                        m_portList[p.m_alias] = p;
-
-                        SWSS_LOG_NOTICE(
-                            "Set port %s TPID to 0x%x",
-                            p.m_alias.c_str(), pCfg.tpid.value
-                        );
+                        /* Applied in bulk by flushPendingPortAttrs() */
+                        auto &pending = m_pendingPortAttrs[p.m_alias];
+                        pending.tpidSet = true;
+                        pending.tpid = pCfg.tpid.value;
                     }
                 }
 
@@ -5643,28 +5676,17 @@ void PortsOrch::doPortTask(Consumer &consumer)
                     pCfg.admin_status.value = admin_status;
                 }
 
-                /* Last step set port admin status */
+                /*
+                 * Last step set port admin status. It is applied by flushPendingPortAttrs()
+                 * after the pending MTU and TPID of the port.
+                 */
                 if (pCfg.admin_status.is_set)
                 {
                     if (p.m_admin_state_up != pCfg.admin_status.value)
                     {
-                        if (!setPortAdminStatus(p, pCfg.admin_status.value))
-                        {
-                            SWSS_LOG_ERROR(
-                                "Failed to set port %s admin status to %s",
-                                p.m_alias.c_str(), m_portHlpr.getAdminStatusStr(pCfg).c_str()
-                            );
-                            it++;
-                            continue;
-                        }
-
-                        p.m_admin_state_up = pCfg.admin_status.value;
-                        m_portList[p.m_alias] = p;
-
-                        SWSS_LOG_NOTICE(
-                            "Set port %s admin status to %s",
-                            p.m_alias.c_str(), m_portHlpr.getAdminStatusStr(pCfg).c_str()
-                        );
+                        auto &pending = m_pendingPortAttrs[p.m_alias];
+                        pending.adminSet = true;
+                        pending.adminUp = pCfg.admin_status.value;
                     }
                 }
 
@@ -5865,8 +5887,159 @@ void PortsOrch::doPortTask(Consumer &consumer)
             SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
         }
 
+        /* The task is erased by flushPendingPortAttrs() once its pending attributes are applied */
+        auto pending = m_pendingPortAttrs.find(key);
+        if (pending != m_pendingPortAttrs.end())
+        {
+            pending->second.eraseTask = true;
+            pending->second.task = it;
+            it++;
+            continue;
+        }
+
         it = consumer.m_toSync.erase(it);
     }
+
+    flushPendingPortAttrs(consumer);
+}
+
+void PortsOrch::flushPendingPortAttrs(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pendingPortAttrs.empty())
+    {
+        return;
+    }
+
+    auto pendingPortAttrs = std::move(m_pendingPortAttrs);
+    m_pendingPortAttrs.clear();
+
+    /*
+     * One bulk call per attribute keeps every port at most once per call and
+     * preserves the per-port order MTU, TPID, admin status. A port whose
+     * write has to be retried is skipped for the following attributes, like
+     * the per-port path that stops at the first failure.
+     */
+    auto bulkSet = [&](const std::function<bool(const PendingPortAttrs &)> &isSet,
+                       const std::function<void(const Port &, const PendingPortAttrs &, sai_attribute_t &)> &getAttr,
+                       const std::function<bool(const Port &, const PendingPortAttrs &, const sai_attribute_t &, sai_status_t)> &postSet)
+    {
+        PortBulker bulker(static_cast<uint32_t>(pendingPortAttrs.size()));
+        vector<map<string, PendingPortAttrs>::iterator> entries;
+
+        for (auto pit = pendingPortAttrs.begin(); pit != pendingPortAttrs.end(); pit++)
+        {
+            Port p;
+            if (pit->second.failed || !isSet(pit->second) || !getPort(pit->first, p))
+            {
+                continue;
+            }
+
+            sai_attribute_t attr;
+            getAttr(p, pit->second, attr);
+            bulker.add(p.m_port_id, attr);
+            entries.push_back(pit);
+        }
+
+        bulker.executeSet(m_portBulkSetSupported);
+
+        for (size_t idx = 0; idx < entries.size(); idx++)
+        {
+            Port p;
+            getPort(entries[idx]->first, p);
+            if (!postSet(p, entries[idx]->second, bulker.attrList[idx], bulker.statuses[idx]))
+            {
+                entries[idx]->second.failed = true;
+            }
+        }
+    };
+
+    bulkSet(
+        [](const PendingPortAttrs &pending) { return pending.mtuSet; },
+        [this](const Port &p, const PendingPortAttrs &pending, sai_attribute_t &attr)
+        {
+            getPortMtuAttr(p, pending.mtu, attr);
+        },
+        [this](const Port &port, const PendingPortAttrs &pending, const sai_attribute_t &attr, sai_status_t status)
+        {
+            if (!postSetPortMtu(port, pending.mtu, attr, status))
+            {
+                SWSS_LOG_ERROR("Failed to set port %s MTU to %u", port.m_alias.c_str(), pending.mtu);
+                return false;
+            }
+
+            Port p = port;
+            p.m_mtu = pending.mtu;
+            m_portList[p.m_alias] = p;
+
+            if (p.m_rif_id)
+            {
+                gIntfsOrch->setRouterIntfsMtu(p);
+            }
+            if (gP4Orch)
+            {
+                gP4Orch->setRouterIntfsMtu(p.m_alias, p.m_mtu);
+            }
+            // Sub interfaces inherit parent physical port mtu
+            updateChildPortsMtu(p, pending.mtu);
+
+            SWSS_LOG_NOTICE("Set port %s MTU to %u", p.m_alias.c_str(), pending.mtu);
+            return true;
+        });
+
+    bulkSet(
+        [](const PendingPortAttrs &pending) { return pending.tpidSet; },
+        [](const Port &, const PendingPortAttrs &pending, sai_attribute_t &attr)
+        {
+            attr.id = SAI_PORT_ATTR_TPID;
+            attr.value.u16 = pending.tpid;
+        },
+        [this](const Port &port, const PendingPortAttrs &pending, const sai_attribute_t &attr, sai_status_t status)
+        {
+            if (!postSetPortTpid(port, attr, status))
+            {
+                SWSS_LOG_ERROR("Failed to set port %s TPID to 0x%x", port.m_alias.c_str(), pending.tpid);
+                return false;
+            }
+
+            m_portList[port.m_alias].m_tpid = pending.tpid;
+
+            SWSS_LOG_NOTICE("Set port %s TPID to 0x%x", port.m_alias.c_str(), pending.tpid);
+            return true;
+        });
+
+    bulkSet(
+        [](const PendingPortAttrs &pending) { return pending.adminSet; },
+        [this](const Port &p, const PendingPortAttrs &pending, sai_attribute_t &attr)
+        {
+            preSetPortAdminStatus(p, pending.adminUp);
+            attr.id = SAI_PORT_ATTR_ADMIN_STATE;
+            attr.value.booldata = pending.adminUp;
+        },
+        [this](const Port &port, const PendingPortAttrs &pending, const sai_attribute_t &, sai_status_t status)
+        {
+            if (!postSetPortAdminStatus(port, pending.adminUp, status))
+            {
+                SWSS_LOG_ERROR("Failed to set port %s admin status to %s",
+                               port.m_alias.c_str(), pending.adminUp ? "up" : "down");
+                return false;
+            }
+
+            m_portList[port.m_alias].m_admin_state_up = pending.adminUp;
+
+            SWSS_LOG_NOTICE("Set port %s admin status to %s",
+                            port.m_alias.c_str(), pending.adminUp ? "up" : "down");
+            return true;
+        });
+
+    for (auto &pit : pendingPortAttrs)
+    {
+        if (pit.second.eraseTask && !pit.second.failed)
+        {
+            consumer.m_toSync.erase(pit.second.task);
+        }
+    }
 }
 
 void PortsOrch::doVlanTask(Consumer &consumer)
@@ -6402,6 +6575,11 @@ void PortsOrch::doLagMemberTask(Consumer &consumer)
 
     string table_name = consumer.getTableName();
 
+    if (table_name == APP_LAG_MEMBER_TABLE_NAME)
+    {
+        bulkAddLagMembers(consumer);
+    }
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -6410,11 +6588,13 @@ void PortsOrch::doLagMemberTask(Consumer &consumer)
         /* Retrieve LAG alias and LAG member alias from key */
         string key = kfvKey(t);
         size_t found = key.find(':');
-        /* Return if the format of key is wrong */
+        /* Erase the entry if the format of key is wrong, the unused members
+         * created in bulk are still removed below */
         if (found == string::npos)
         {
             SWSS_LOG_ERROR("Failed to parse %s", key.c_str());
-            return;
+            it = consumer.m_toSync.erase(it);
+            continue;
         }
         string lag_alias = key.substr(0, found);
         string port_alias = key.substr(found+1);
@@ -6486,6 +6666,7 @@ void PortsOrch::doLagMemberTask(Consumer &consumer)
                     status = fvValue(i);
             }
 
+            bool created = false;
             if (lag.m_members.find(port_alias) == lag.m_members.end())
             {
                 if (port.m_lag_member_id != SAI_NULL_OBJECT_ID)
@@ -6508,6 +6689,7 @@ void PortsOrch::doLagMemberTask(Consumer &consumer)
                     it++;
                     continue;
                 }
+                created = true;
             }
 
             if (isChassisDbInUse() && (port.m_type != Port::SYSTEM))
@@ -6516,8 +6698,13 @@ void PortsOrch::doLagMemberTask(Consumer &consumer)
                voqSyncAddLagMember(lag, port, status);
             }
 
+            /* A member is created with its collection and distribution state */
+            if (created && (status == "enabled" || port.m_type != Port::SYSTEM))
+            {
+                it = consumer.m_toSync.erase(it);
+            }
             /* Sync an enabled member */
-            if (status == "enabled")
+            else if (status == "enabled")
             {
                 /* enable collection first, distribution-only mode
                  * is not supported on Mellanox platform
@@ -6580,6 +6767,94 @@ void PortsOrch::doLagMemberTask(Consumer &consumer)
             it = consumer.m_toSync.erase(it);
         }
     }
+
+    /* Members created in bulk which the loop above didn't take over */
+    for (const auto &bulk : m_bulkLagMembers)
+    {
+        sai_object_id_t lag_member_id = bulk.second.second;
+        if (lag_member_id == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        SWSS_LOG_WARN("Remove unused member %s of LAG %s lmid:%" PRIx64,
+                bulk.first.c_str(), bulk.second.first.c_str(), lag_member_id);
+        sai_status_t status = sai_lag_api->remove_lag_member(lag_member_id);
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove unused member %s of LAG %s lmid:%" PRIx64,
+                    bulk.first.c_str(), bulk.second.first.c_str(), lag_member_id);
+            handleSaiRemoveStatus(SAI_API_LAG, status);
+        }
+    }
+    m_bulkLagMembers.clear();
+}
+
+/*
+ * Create the members added by the task with one bulk call, ahead of
+ * doLagMemberTask(). The entries are checked the same way doLagMemberTask()
+ * does before it calls addLagMember(), which takes the created member over.
+ * Members whose creation failed are left to addLagMember() to create on
+ * their own, with the usual SAI status handling. The PVID of a member port
+ * is set by addLagMember() too, so that a member removed as unused by
+ * doLagMemberTask() leaves its port untouched.
+ */
+void PortsOrch::bulkAddLagMembers(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &entry : consumer.m_toSync)
+    {
+        const auto &t = entry.second;
+        if (kfvOp(t) != SET_COMMAND)
+        {
+            continue;
+        }
+
+        string key = kfvKey(t);
+        size_t found = key.find(':');
+        if (found == string::npos)
+        {
+            break;
+        }
+        string lag_alias = key.substr(0, found);
+        string port_alias = key.substr(found+1);
+
+        Port lag, port;
+        if (!getPort(lag_alias, lag) || !getPort(port_alias, port) ||
+            !isValidPortTypeForLagMember(port))
+        {
+            continue;
+        }
+
+        if (lag.m_members.find(port_alias) != lag.m_members.end() ||
+            port.m_lag_member_id != SAI_NULL_OBJECT_ID ||
+            m_portVlanMember[port.m_alias].size() > 0 ||
+            m_bulkLagMembers.find(port_alias) != m_bulkLagMembers.end())
+        {
+            continue;
+        }
+
+        string status;
+        for (auto i : kfvFieldsValues(t))
+        {
+            if (fvField(i) == "status")
+                status = fvValue(i);
+        }
+
+        auto attrs = getLagMemberAttrs(lag, port, status);
+        auto &bulk = m_bulkLagMembers[port_alias];
+        bulk.first = lag_alias;
+        m_lagMemberBulker.create_entry(&bulk.second, (uint32_t)attrs.size(), attrs.data());
+    }
+
+    if (m_lagMemberBulker.creating_entries_count() == 0)
+    {
+        return;
+    }
+
+    SWSS_LOG_INFO("Create %zu LAG members in bulk", m_lagMemberBulker.creating_entries_count());
+    m_lagMemberBulker.flush();
 }
 
 void PortsOrch::onWarmBootEnd()
@@ -8327,17 +8602,10 @@ void PortsOrch::getLagMember(Port &lag, vector<Port> &portv)
     }
 }
 
-bool PortsOrch::addLagMember(Port &lag, Port &port, string member_status)
+vector<sai_attribute_t> PortsOrch::getLagMemberAttrs(const Port &lag, const Port &port, const string &member_status)
 {
-    SWSS_LOG_ENTER();
     bool enableForwarding = (member_status == "enabled");
 
-    sai_uint32_t pvid;
-    if (getPortPvid(lag, pvid))
-    {
-        setPortPvid (port, pvid);
-    }
-
     sai_attribute_t attr;
     vector<sai_attribute_t> attrs;
 
@@ -8360,17 +8628,43 @@ bool PortsOrch::addLagMember(Port &lag, Port &port, string member_status)
         attrs.push_back(attr);
     }
 
-    sai_object_id_t lag_member_id;
-    sai_status_t status = sai_lag_api->create_lag_member(&lag_member_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
+    return attrs;
+}
 
-    if (status != SAI_STATUS_SUCCESS)
+bool PortsOrch::addLagMember(Port &lag, Port &port, string member_status)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_id_t lag_member_id = SAI_NULL_OBJECT_ID;
+
+    /* Take over the member created by bulkAddLagMembers() */
+    auto bulk = m_bulkLagMembers.find(port.m_alias);
+    if (bulk != m_bulkLagMembers.end() && bulk->second.first == lag.m_alias)
     {
-        SWSS_LOG_ERROR("Failed to add member %s to LAG %s lid:%" PRIx64 " pid:%" PRIx64,
-                port.m_alias.c_str(), lag.m_alias.c_str(), lag.m_lag_id, port.m_port_id);
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_LAG, status);
-        if (handle_status != task_success)
+        lag_member_id = bulk->second.second;
+        m_bulkLagMembers.erase(bulk);
+    }
+
+    sai_uint32_t pvid;
+    if (getPortPvid(lag, pvid))
+    {
+        setPortPvid (port, pvid);
+    }
+
+    if (lag_member_id == SAI_NULL_OBJECT_ID)
+    {
+        auto attrs = getLagMemberAttrs(lag, port, member_status);
+        sai_status_t status = sai_lag_api->create_lag_member(&lag_member_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
+
+        if (status != SAI_STATUS_SUCCESS)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_ERROR("Failed to add member %s to LAG %s lid:%" PRIx64 " pid:%" PRIx64,
+                    port.m_alias.c_str(), lag.m_alias.c_str(), lag.m_lag_id, port.m_port_id);
+            task_process_status handle_status = handleSaiCreateStatus(SAI_API_LAG, status);
+            if (handle_status != task_success)
+            {
+                return parseHandleSaiStatusFailure(handle_status);
+            }
         }
     }
 
@@ -16,6 +16,7 @@
 #include "lagid.h"
 #include "flexcounterorch.h"
 #include "events.h"
+#include "bulker.h"
 
 #include "port/port_capabilities.h"
 #include "port/porthlpr.h"
@@ -395,6 +396,10 @@ private:
     map<string, Port> m_portList;
     map<string, Port> m_pluggedModulesPort;
     map<string, vlan_members_t> m_portVlanMember;
+
+    ObjectBulker<sai_lag_api_t> m_lagMemberBulker;
+    /* LAG members created by bulkAddLagMembers(): port alias -> (LAG alias, member id) */
+    map<string, pair<string, sai_object_id_t>> m_bulkLagMembers;
     map<string, std::vector<sai_object_id_t>> m_port_voq_ids;
     /* mapping from SAI object ID to Name for faster
      * retrieval of Port/VLAN from object ID for events
@@ -404,6 +409,27 @@ private:
     unordered_map<sai_object_id_t, uint16_t> m_portOidToIndex;
     map<string, uint32_t> m_port_ref_count;
     unordered_set<string> m_pendingPortSet;
+
+    /*
+     * MTU, TPID and admin status writes collected while draining PORT_TABLE.
+     * They are pushed with one bulk set per attribute at the end of the drain,
+     * admin status last, so that a config reload does not pay a sairedis
+     * round-trip per port and attribute.
+     */
+    struct PendingPortAttrs
+    {
+        bool mtuSet = false;
+        sai_uint32_t mtu = 0;
+        bool tpidSet = false;
+        sai_uint16_t tpid = 0;
+        bool adminSet = false;
+        bool adminUp = false;
+        bool failed = false;
+        bool eraseTask = false;
+        SyncMap::iterator task;
+    };
+    map<string, PendingPortAttrs> m_pendingPortAttrs;
+    bool m_portBulkSetSupported = true;
     const uint32_t max_flood_control_types = 4;
     set<sai_vlan_flood_control_type_t> uuc_sup_flood_control_type;
     set<sai_vlan_flood_control_type_t> bc_sup_flood_control_type;
@@ -427,6 +453,7 @@ private:
     void onWarmBootEnd() override;
     void doTask(Consumer &consumer);
     void doPortTask(Consumer &consumer);
+    void flushPendingPortAttrs(Consumer &consumer);
     void doSendToIngressPortTask(Consumer &consumer);
     void doVlanTask(Consumer &consumer);
     void doVlanMemberTask(Consumer &consumer);
@@ -464,6 +491,8 @@ private:
     bool addLag(string lag, uint32_t spa_id, int32_t switch_id);
     bool removeLag(Port lag);
     bool setLagTpid(sai_object_id_t id, sai_uint16_t tpid);
+    vector<sai_attribute_t> getLagMemberAttrs(const Port &lag, const Port &port, const string &status);
+    void bulkAddLagMembers(Consumer &consumer);
     bool addLagMember(Port &lag, Port &port, string status);
     bool removeLagMember(Port &lag, Port &port);
     bool setCollectionOnLagMember(Port &lagMember, bool enableCollection);
@@ -482,11 +511,16 @@ private:
     void postPortInit(Port &p);
 
     bool setPortAdminStatus(Port &port, bool up);
+    void preSetPortAdminStatus(const Port &port, bool up);
+    bool postSetPortAdminStatus(const Port &port, bool up, sai_status_t status);
     bool getPortAdminStatus(sai_object_id_t id, bool& up);
     bool getPortMtu(const Port& port, sai_uint32_t &mtu);
     bool getPortHostTxReady(const Port& port, bool &hostTxReadyVal);
     bool setPortMtu(const Port& port, sai_uint32_t mtu);
+    void getPortMtuAttr(const Port& port, sai_uint32_t mtu, sai_attribute_t &attr) const;
+    bool postSetPortMtu(const Port& port, sai_uint32_t mtu, const sai_attribute_t &attr, sai_status_t status);
     bool setPortTpid(Port &port, sai_uint16_t tpid);
+    bool postSetPortTpid(const Port &port, const sai_attribute_t &attr, sai_status_t status);
     bool setPortPvid (Port &port, sai_uint32_t pvid);
     bool getPortPvid(Port &port, sai_uint32_t &pvid);
     bool setPortFec(Port &port, sai_port_fec_mode_t fec_mode, bool override_fec);
@@ -14,6 +14,7 @@
 #include "swssnet.h"
 #include "crmorch.h"
 #include "directory.h"
+#include "taskstats.h"
 
 extern sai_object_id_t gVirtualRouterId;
 extern sai_object_id_t gSwitchId;
@@ -301,7 +302,7 @@ bool RouteOrch::hasNextHopGroup(const NextHopGroupKey& nexthops) const
 sai_object_id_t RouteOrch::getNextHopGroupId(const NextHopGroupKey& nexthops)
 {
     assert(hasNextHopGroup(nexthops));
-    return m_syncdNextHopGroups[nexthops].next_hop_group_id;
+    return m_syncdNextHopGroups.at(nexthops).next_hop_group_id;
 }
 
 void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_id_t vrf_id)
@@ -451,29 +452,58 @@ bool RouteOrch::addDefaultRouteNexthopsInNextHopGroup(NextHopGroupEntry& origina
 }
 
 bool RouteOrch::validnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t& count)
+{
+    return validnexthopsinNextHopGroup({ nexthop }, count);
+}
+
+bool RouteOrch::invalidnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t& count)
+{
+    return invalidnexthopsinNextHopGroup({ nexthop }, count);
+}
+
+/*
+ * Add the given next hops back to every next hop group using them,
+ * with the members of all groups created in one bulk call.
+ */
+bool RouteOrch::validnexthopsinNextHopGroup(const vector<NextHopKey> &nexthops, uint32_t& count)
 {
     SWSS_LOG_ENTER();
 
-    sai_object_id_t nexthop_id;
-    sai_status_t status;
+    auto start = std::chrono::steady_clock::now();
+    bool rc = true;
     count = 0;
 
-    for (auto nhopgroup = m_syncdNextHopGroups.begin();
-         nhopgroup != m_syncdNextHopGroups.end(); ++nhopgroup)
+    vector<NextHopGroupTable::value_type *> nhopgroups;
+    vector<const NextHopKey *> members;
+    vector<sai_object_id_t> next_hop_ids;
+    for (const auto &nexthop : nexthops)
     {
-
-        if (!(nhopgroup->first.contains(nexthop)))
+        auto index = m_nextHopGroupIndex.find(nexthop);
+        if (index == m_nextHopGroupIndex.end())
         {
             continue;
         }
 
-       // Route NHOP Group is swapped by default route nh memeber . do not add Nexthop again.
-       // Wait for Nexthop Group Cleanup
-        if (nhopgroup->second.is_default_route_nh_swap)
+        sai_object_id_t next_hop_id = m_neighOrch->getNextHopId(nexthop);
+        for (auto nhopgroup : index->second)
         {
-           continue;
+            // Route NHOP Group is swapped by default route nh memeber . do not add Nexthop again.
+            // Wait for Nexthop Group Cleanup
+            if (nhopgroup->second.is_default_route_nh_swap)
+            {
+                continue;
+            }
+            nhopgroups.push_back(nhopgroup);
+            members.push_back(&nexthop);
+            next_hop_ids.push_back(next_hop_id);
         }
-        
+    }
+
+    vector<sai_object_id_t> nhgm_ids(nhopgroups.size());
+    for (size_t i = 0; i < nhopgroups.size(); i++)
+    {
+        auto nhopgroup = nhopgroups[i];
+        const auto &nexthop = *members[i];
         vector<sai_attribute_t> nhgm_attrs;
         sai_attribute_t nhgm_attr;
 
@@ -485,7 +515,7 @@ bool RouteOrch::validnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t&
         nhgm_attrs.push_back(nhgm_attr);
 
         nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
-        nhgm_attr.value.oid = m_neighOrch->getNextHopId(nexthop);
+        nhgm_attr.value.oid = next_hop_ids[i];
         nhgm_attrs.push_back(nhgm_attr);
 
         if (nhkey->weight)
@@ -502,73 +532,122 @@ bool RouteOrch::validnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t&
             nhgm_attrs.push_back(nhgm_attr);
         }
 
-        status = sai_next_hop_group_api->create_next_hop_group_member(&nexthop_id, gSwitchId,
-                                                                      (uint32_t)nhgm_attrs.size(),
-                                                                      nhgm_attrs.data());
+        gNextHopGroupMemberBulker.create_entry(&nhgm_ids[i],
+                                               (uint32_t)nhgm_attrs.size(),
+                                               nhgm_attrs.data());
+    }
 
-        if (status != SAI_STATUS_SUCCESS)
+    gNextHopGroupMemberBulker.flush();
+
+    for (size_t i = 0; i < nhopgroups.size(); i++)
+    {
+        auto nhopgroup = nhopgroups[i];
+        const auto &nexthop = *members[i];
+        if (nhgm_ids[i] == SAI_NULL_OBJECT_ID)
         {
-            SWSS_LOG_ERROR("Failed to add next hop member to group %" PRIx64 ": %d\n",
-                           nhopgroup->second.next_hop_group_id, status);
+            sai_status_t status = gNextHopGroupMemberBulker.create_status(nhgm_ids[i]);
+            SWSS_LOG_ERROR("Failed to add next hop member %s to group %" PRIx64 ": %d",
+                           nexthop.to_string().c_str(), nhopgroup->second.next_hop_group_id, status);
             task_process_status handle_status = handleSaiCreateStatus(SAI_API_NEXT_HOP_GROUP, status);
-            if (handle_status != task_success)
+            if (handle_status != task_success && !parseHandleSaiStatusFailure(handle_status))
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                rc = false;
             }
+            continue;
         }
 
         ++count;
         gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
-        nhopgroup->second.nhopgroup_members[nexthop].next_hop_id = nexthop_id;
+        nhopgroup->second.nhopgroup_members[nexthop].next_hop_id = nhgm_ids[i];
         /* Keep the count of number of nexthop members are present in Nexthop Group
          * when the links became active again*/
         nhopgroup->second.nh_member_install_count++;
     }
 
-    if (!m_fgNhgOrch->validNextHopInNextHopGroup(nexthop))
+    for (const auto &nexthop : nexthops)
     {
-        return false;
+        if (!m_fgNhgOrch->validNextHopInNextHopGroup(nexthop))
+        {
+            rc = false;
+        }
     }
 
-    return true;
+    recordOrchOpStat("RouteOrch:nhg_expand", start);
+
+    return rc;
 }
 
-bool RouteOrch::invalidnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t& count)
+/*
+ * Remove the given next hops from every next hop group using them,
+ * with the members of all groups removed in one bulk call.
+ */
+bool RouteOrch::invalidnexthopsinNextHopGroup(const vector<NextHopKey> &nexthops, uint32_t& count)
 {
     SWSS_LOG_ENTER();
 
-    sai_object_id_t nexthop_id;
-    sai_status_t status;
+    auto start = std::chrono::steady_clock::now();
+    bool rc = true;
     count = 0;
 
-    for (auto nhopgroup = m_syncdNextHopGroups.begin();
-         nhopgroup != m_syncdNextHopGroups.end(); ++nhopgroup)
+    vector<NextHopGroupTable::value_type *> nhopgroups;
+    vector<const NextHopKey *> members;
+    vector<sai_object_id_t> nhgm_ids;
+    for (const auto &nexthop : nexthops)
     {
-
-        if (!(nhopgroup->first.contains(nexthop)))
+        auto index = m_nextHopGroupIndex.find(nexthop);
+        if (index == m_nextHopGroupIndex.end())
         {
             continue;
         }
 
-        // Route NHOP Group is already swapped by default route nh memeber . do not delete actual nexthop again.
-   
-        if (nhopgroup->second.is_default_route_nh_swap)
+        for (auto nhopgroup : index->second)
         {
-           continue;
+            // Route NHOP Group is already swapped by default route nh memeber . do not delete actual nexthop again.
+            if (nhopgroup->second.is_default_route_nh_swap)
+            {
+                continue;
+            }
+
+            sai_object_id_t nhgm_id = nhopgroup->second.nhopgroup_members[nexthop].next_hop_id;
+            if (nhgm_id == SAI_NULL_OBJECT_ID)
+            {
+                SWSS_LOG_WARN("No next hop member %s in group %" PRIx64 " to remove",
+                              nexthop.to_string().c_str(), nhopgroup->second.next_hop_group_id);
+                continue;
+            }
+            nhopgroups.push_back(nhopgroup);
+            members.push_back(&nexthop);
+            nhgm_ids.push_back(nhgm_id);
         }
- 
+    }
 
-        nexthop_id = nhopgroup->second.nhopgroup_members[nexthop].next_hop_id;
-        status = sai_next_hop_group_api->remove_next_hop_group_member(nexthop_id);
+    vector<sai_status_t> statuses(nhopgroups.size());
+    for (size_t i = 0; i < nhopgroups.size(); i++)
+    {
+        gNextHopGroupMemberBulker.remove_entry(&statuses[i], nhgm_ids[i]);
+    }
 
-        if (status != SAI_STATUS_SUCCESS)
+    gNextHopGroupMemberBulker.flush();
+
+    for (size_t i = 0; i < nhopgroups.size(); i++)
+    {
+        auto nhopgroup = nhopgroups[i];
+        const auto &nexthop = *members[i];
+        if (statuses[i] != SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_ERROR("Failed to remove next hop member %" PRIx64 " from group %" PRIx64 ": %d\n",
-                           nexthop_id, nhopgroup->second.next_hop_group_id, status);
-            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEXT_HOP_GROUP, status);
-            if (handle_status != task_success)
+                           nhgm_ids[i], nhopgroup->second.next_hop_group_id, statuses[i]);
+            /* Bulk remove stops on the first error, the rest are left in place */
+            if (statuses[i] == SAI_STATUS_NOT_EXECUTED)
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                rc = false;
+                continue;
+            }
+            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEXT_HOP_GROUP, statuses[i]);
+            if (handle_status != task_success && !parseHandleSaiStatusFailure(handle_status))
+            {
+                rc = false;
+                continue;
             }
         }
         // Reduce the member install count when links down
@@ -581,7 +660,7 @@ bool RouteOrch::invalidnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t
         if (nhopgroup->second.nh_member_install_count == 0 && nhopgroup->second.eligible_for_default_route_nh_swap && !nhopgroup->second.is_default_route_nh_swap)
         {
             if(nexthop.ip_address.isV4())
-            { 
+            {
                 addDefaultRouteNexthopsInNextHopGroup(nhopgroup->second, v4_active_default_route_nhops);
             }
             else
@@ -593,12 +672,43 @@ bool RouteOrch::invalidnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t
         gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
     }
 
-    if (!m_fgNhgOrch->invalidNextHopInNextHopGroup(nexthop))
+    for (const auto &nexthop : nexthops)
     {
-        return false;
+        if (!m_fgNhgOrch->invalidNextHopInNextHopGroup(nexthop))
+        {
+            rc = false;
+        }
     }
 
-    return true;
+    recordOrchOpStat("RouteOrch:nhg_shrink", start);
+
+    return rc;
+}
+
+void RouteOrch::addNextHopGroupIndex(NextHopGroupTable::value_type &nhg)
+{
+    for (const auto &nh : nhg.first.getNextHops())
+    {
+        m_nextHopGroupIndex[nh].insert(&nhg);
+    }
+}
+
+void RouteOrch::removeNextHopGroupIndex(NextHopGroupTable::value_type &nhg)
+{
+    for (const auto &nh : nhg.first.getNextHops())
+    {
+        auto index = m_nextHopGroupIndex.find(nh);
+        if (index == m_nextHopGroupIndex.end())
+        {
+            continue;
+        }
+
+        index->second.erase(&nhg);
+        if (index->second.empty())
+        {
+            m_nextHopGroupIndex.erase(index);
+        }
+    }
 }
 
 void RouteOrch::doTask(ConsumerBase& consumer)
@@ -1671,6 +1781,7 @@ bool RouteOrch::addNextHopGroup(const NextHopGroupKey &nexthops)
      */
     next_hop_group_entry.ref_count = 0;
     m_syncdNextHopGroups[nexthops] = next_hop_group_entry;
+    addNextHopGroupIndex(*m_syncdNextHopGroups.find(nexthops));
 
     return true;
 }
@@ -1816,7 +1927,8 @@ bool RouteOrch::removeNextHopGroup(const NextHopGroupKey &nexthops, const bool i
         }
     }
  
-    m_syncdNextHopGroups.erase(nexthops);
+    removeNextHopGroupIndex(*next_hop_group_entry);
+    m_syncdNextHopGroups.erase(next_hop_group_entry);
 
     return true;
 }
@@ -1879,53 +1991,64 @@ bool RouteOrch::updateNextHopRoutes(const NextHopKey& nextHop, uint32_t& numRout
         return true;
     }
 
-    sai_route_entry_t route_entry;
+    sai_object_id_t next_hop_id = m_neighOrch->getNextHopId(nextHop);
+
     sai_attribute_t route_attr;
-    sai_object_id_t next_hop_id;
+    route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    route_attr.value.oid = next_hop_id;
 
-    auto rt = it->second.begin();
-    while(rt != it->second.end())
+    vector<const RouteKey *> routes;
+    vector<sai_status_t> statuses(it->second.size());
+
+    for (const auto &rt : it->second)
     {
         /* Check if route points to nexthop group and skip */
-        NextHopGroupKey nhg_key = gRouteOrch->getSyncdRouteNhgKey(gVirtualRouterId, (*rt).prefix);
-        if (nhg_key.getSize() > 1)
+        auto route_table = m_syncdRoutes.find(rt.vrf_id);
+        if (route_table != m_syncdRoutes.end())
         {
-            /* multiple mux nexthop case:
-             * skip for now, muxOrch::updateRoute() will handle route
-             */
-            SWSS_LOG_INFO("Route %s is mux multi nexthop route, skipping.",
-                        (*rt).prefix.to_string().c_str());
-
-            ++rt;
-            continue;
+            auto route = route_table->second.find(rt.prefix);
+            if (route != route_table->second.end() && route->second.nhg_key.getSize() > 1)
+            {
+                /* multiple mux nexthop case:
+                 * skip for now, muxOrch::updateRoute() will handle route
+                 */
+                SWSS_LOG_INFO("Route %s is mux multi nexthop route, skipping.",
+                            rt.prefix.to_string().c_str());
+                continue;
+            }
         }
 
-        next_hop_id = m_neighOrch->getNextHopId(nextHop);
-        SWSS_LOG_INFO("Updating route %s with nexthop %" PRIu64, (*rt).prefix.to_string().c_str(), (uint64_t)next_hop_id);
+        SWSS_LOG_INFO("Updating route %s with nexthop %" PRIu64, rt.prefix.to_string().c_str(), (uint64_t)next_hop_id);
 
-        route_entry.vr_id = (*rt).vrf_id;
+        sai_route_entry_t route_entry;
+        route_entry.vr_id = rt.vrf_id;
         route_entry.switch_id = gSwitchId;
-        copy(route_entry.destination, (*rt).prefix);
+        copy(route_entry.destination, rt.prefix);
+
+        gRouteBulker.set_entry_attribute(&statuses[routes.size()], &route_entry, &route_attr);
+        routes.push_back(&rt);
+    }
 
-        route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
-        route_attr.value.oid = next_hop_id;
+    gRouteBulker.flush();
 
-        sai_status_t status = sai_route_api->set_route_entry_attribute(&route_entry, &route_attr);
-        if (status != SAI_STATUS_SUCCESS)
+    bool rc = true;
+    for (size_t i = 0; i < routes.size(); i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
         {
-            SWSS_LOG_ERROR("Failed to update route %s, rv:%d", (*rt).prefix.to_string().c_str(), status);
-            task_process_status handle_status = handleSaiSetStatus(SAI_API_ROUTE, status);
-            if (handle_status != task_success)
+            SWSS_LOG_ERROR("Failed to update route %s, rv:%d", routes[i]->prefix.to_string().c_str(), statuses[i]);
+            task_process_status handle_status = handleSaiSetStatus(SAI_API_ROUTE, statuses[i]);
+            if (handle_status != task_success && !parseHandleSaiStatusFailure(handle_status))
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                rc = false;
+                continue;
             }
         }
 
         ++numRoutes;
-        ++rt;
     }
 
-    return true;
+    return rc;
 }
 
 /**
@@ -2264,12 +2387,19 @@ bool RouteOrch::addRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextHops)
             {
                 /* Nexthop Creation Successful. So the save the state if eligible to fallback to default route
                  * based on APP_DB value for the route. Also initialize the present to False as swap did not happen */
-                m_syncdNextHopGroups[nextHops].eligible_for_default_route_nh_swap = ctx.fallback_to_default_route;
-                m_syncdNextHopGroups[nextHops].is_default_route_nh_swap = false;
+                auto &nhg_entry = m_syncdNextHopGroups.at(nextHops);
+                nhg_entry.eligible_for_default_route_nh_swap = ctx.fallback_to_default_route;
+                nhg_entry.is_default_route_nh_swap = false;
             }
         }
 
-        next_hop_id = m_syncdNextHopGroups[nextHops].next_hop_group_id;
+        auto nhg = m_syncdNextHopGroups.find(nextHops);
+        if (nhg == m_syncdNextHopGroups.end())
+        {
+            SWSS_LOG_ERROR("Next hop group %s is not synced", nextHops.to_string().c_str());
+            return false;
+        }
+        next_hop_id = nhg->second.next_hop_group_id;
     }
 
     /* Sync the route entry */
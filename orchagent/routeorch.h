@@ -19,6 +19,7 @@
 #include "zmqorch.h"
 #include "zmqserver.h"
 #include <unordered_map>
+#include <set>
 
 extern bool gRouteStateAsyncPublish;
 
@@ -256,6 +257,8 @@ public:
 
     bool validnexthopinNextHopGroup(const NextHopKey&, uint32_t&);
     bool invalidnexthopinNextHopGroup(const NextHopKey&, uint32_t&);
+    bool validnexthopsinNextHopGroup(const vector<NextHopKey>&, uint32_t&);
+    bool invalidnexthopsinNextHopGroup(const vector<NextHopKey>&, uint32_t&);
 
     bool createRemoteVtep(sai_object_id_t, const NextHopKey&);
     bool deleteRemoteVtep(sai_object_id_t, const NextHopKey&);
@@ -305,6 +308,13 @@ private:
     NextHopGroupTable m_syncdNextHopGroups;
     NextHopRouteTable m_nextHops;
 
+    /*
+     * Reverse index of m_syncdNextHopGroups: next hop -> groups that contain
+     * it, so that a next hop going down or up only visits its own groups.
+     * Entries point into m_syncdNextHopGroups, whose elements do not move.
+     */
+    std::map<NextHopKey, std::set<NextHopGroupTable::value_type *>> m_nextHopGroupIndex;
+
     std::set<std::pair<NextHopGroupKey, sai_object_id_t>> m_bulkNhgReducedRefCnt;
     /* m_bulkNhgReducedRefCnt: nexthop, vrf_id */
 
@@ -342,6 +352,9 @@ private:
     bool isVipRoute(const IpPrefix &ipPrefix, const NextHopGroupKey &nextHops);
     void createVipRouteSubnetDecapTerm(const IpPrefix &ipPrefix);
     void removeVipRouteSubnetDecapTerm(const IpPrefix &ipPrefix);
+    void addNextHopGroupIndex(NextHopGroupTable::value_type &nhg);
+    void removeNextHopGroupIndex(NextHopGroupTable::value_type &nhg);
+
     bool addDefaultRouteNexthopsInNextHopGroup(NextHopGroupEntry& original_next_hop_group, std::set<NextHopKey>& default_route_next_hop_set);
     void updateDefaultRouteSwapSet(const NextHopGroupKey default_nhg_key, std::set<NextHopKey>& active_default_route_nhops);
     void incNhgRefCount(const std::string& nhg_index, const std::string &context_index = "");
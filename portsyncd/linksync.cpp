@@ -16,6 +16,7 @@
 #include "warm_restart.h"
 #include "shellcmd.h"
 
+#include <algorithm>
 #include <iostream>
 #include <set>
 #include <sstream>
@@ -37,7 +38,8 @@ extern string g_switchType;
 LinkSync::LinkSync(DBConnector *appl_db, DBConnector *state_db) :
     m_portTableProducer(appl_db, APP_PORT_TABLE_NAME),
     m_portTable(appl_db, APP_PORT_TABLE_NAME),
-    m_statePortTable(state_db, STATE_PORT_TABLE_NAME)
+    m_statePipeline(state_db),
+    m_statePortTable(&m_statePipeline, STATE_PORT_TABLE_NAME, true)
 {
     std::shared_ptr<struct if_nameindex> if_ni(if_nameindex(), if_freenameindex);
     struct if_nameindex *idx_p;
@@ -52,6 +54,7 @@ LinkSync::LinkSync(DBConnector *appl_db, DBConnector *state_db) :
             bool portFound = false;
             if (m_portTable.get(port, temp))
             {
+                m_appPorts.insert(port);
                 for (auto it : temp)
                 {
                     if (fvField(it) == "admin_status")
@@ -159,6 +162,9 @@ void LinkSync::onMsg(int nlmsg_type, struct nl_object *obj)
      * the case where port was part of VLAN bridge or LAG */
     if (master && nlmsg_type == RTM_DELLINK)
     {
+        /* The port may still be removed while enslaved, so its state is
+         * written again on the next RTM_NEWLINK */
+        m_statePorts.erase(key);
         return;
     }
 
@@ -176,21 +182,29 @@ void LinkSync::onMsg(int nlmsg_type, struct nl_object *obj)
         return;
     }
 
+    /* A new netdev, e.g. the port was removed and created again: the port
+     * may have left PORT_TABLE and STATE_DB meanwhile */
+    if (m_ifindexNameMap.find(ifindex) == m_ifindexNameMap.end())
+    {
+        m_appPorts.erase(key);
+        m_statePorts.erase(key);
+    }
+
     /* Insert or update the ifindex to key map */
     m_ifindexNameMap[ifindex] = key;
 
     if (nlmsg_type == RTM_DELLINK)
     {
-        m_statePortTable.del(key);
-        SWSS_LOG_NOTICE("Delete %s(ok) from state db", key.c_str());
+        /* The port may be removed from PORT_TABLE along with its netdev */
+        m_appPorts.erase(key);
+        addPendingLink(key, true, {});
         return;
     }
 
     /* front panel interfaces: Check if the port is in the PORT_TABLE
      * non-front panel interfaces such as eth0, lo which are not in the
      * PORT_TABLE are ignored. */
-    vector<FieldValueTuple> temp;
-    if (m_portTable.get(key, temp))
+    if (isAppPort(key))
     {
         g_portSet.erase(key);
         FieldValueTuple tuple("state", "ok");
@@ -202,11 +216,121 @@ void LinkSync::onMsg(int nlmsg_type, struct nl_object *obj)
         vector.push_back(op);
         vector.push_back(admin_status);
         vector.push_back(port_mtu);
-        m_statePortTable.set(key, vector);
-        SWSS_LOG_NOTICE("Publish %s(ok:%s) to state db", key.c_str(), oper ? "up" : "down");
+        addPendingLink(key, false, vector);
     }
     else
     {
         SWSS_LOG_NOTICE("Cannot find %s in port table", key.c_str());
     }
 }
+
+/*
+ * Ports only leave PORT_TABLE along with their netdev, so APPL_DB is read once
+ * per port instead of on every link message.
+ */
+bool LinkSync::isAppPort(const string &key)
+{
+    if (m_appPorts.find(key) != m_appPorts.end())
+    {
+        return true;
+    }
+
+    vector<FieldValueTuple> temp;
+    if (!m_portTable.get(key, temp))
+    {
+        return false;
+    }
+
+    m_appPorts.insert(key);
+    return true;
+}
+
+/*
+ * Only the latest link state of a port matters, so an update replaces the
+ * fields still pending for the same port. A pending removal is kept so that
+ * fields of the old netdev don't survive in STATE_DB.
+ */
+void LinkSync::addPendingLink(const string &key, bool del, const vector<FieldValueTuple> &fvs)
+{
+    if (m_pendingLinks.empty())
+    {
+        m_pendingSince = chrono::steady_clock::now();
+    }
+
+    auto it = m_pendingLinks.find(key);
+    if (it == m_pendingLinks.end())
+    {
+        m_pendingLinks.emplace(key, LinkUpdate{ del, fvs });
+    }
+    else
+    {
+        SWSS_LOG_INFO("Coalesce link update of %s", key.c_str());
+        it->second.del = it->second.del || del;
+        it->second.fvs = fvs;
+    }
+
+    if (m_pendingLinks.size() >= LINKSYNC_MAX_PENDING)
+    {
+        flushPendingLinks();
+    }
+}
+
+int LinkSync::getFlushTimeout() const
+{
+    if (m_pendingLinks.empty())
+    {
+        return -1;
+    }
+
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - m_pendingSince);
+    return max(0, LINKSYNC_FLUSH_INTERVAL_MS - static_cast<int>(elapsed.count()));
+}
+
+void LinkSync::flushPendingLinks()
+{
+    if (m_pendingLinks.empty())
+    {
+        return;
+    }
+
+    for (const auto &link : m_pendingLinks)
+    {
+        const auto &key = link.first;
+        const auto &update = link.second;
+
+        if (update.del)
+        {
+            m_statePortTable.del(key);
+            m_statePorts.erase(key);
+            SWSS_LOG_NOTICE("Delete %s(ok) from state db", key.c_str());
+        }
+
+        if (update.fvs.empty())
+        {
+            continue;
+        }
+
+        /* The kernel repeats RTM_NEWLINK for changes which aren't published */
+        auto it = m_statePorts.find(key);
+        if (it != m_statePorts.end() && it->second == update.fvs)
+        {
+            continue;
+        }
+
+        m_statePortTable.set(key, update.fvs);
+        m_statePorts[key] = update.fvs;
+
+        string oper;
+        for (const auto &fv : update.fvs)
+        {
+            if (fvField(fv) == "netdev_oper_status")
+            {
+                oper = fvValue(fv);
+            }
+        }
+        SWSS_LOG_NOTICE("Publish %s(ok:%s) to state db", key.c_str(), oper.c_str());
+    }
+    m_pendingLinks.clear();
+
+    m_statePortTable.flush();
+}
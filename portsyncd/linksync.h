@@ -5,7 +5,17 @@
 #include "producerstatetable.h"
 #include "netmsg.h"
 
+#include <chrono>
 #include <map>
+#include <set>
+#include <vector>
+
+/*
+ * Link state updates are coalesced per port and written to STATE_DB at most
+ * this often (in milliseconds), or as soon as this many ports are pending.
+ */
+#define LINKSYNC_FLUSH_INTERVAL_MS 50
+#define LINKSYNC_MAX_PENDING 256
 
 namespace swss {
 
@@ -18,12 +28,38 @@ public:
 
     virtual void onMsg(int nlmsg_type, struct nl_object *obj);
 
+    /* Write the pending link state updates to STATE_DB */
+    void flushPendingLinks();
+
+    /* Milliseconds until the pending updates are due, -1 if there are none */
+    int getFlushTimeout() const;
+
 private:
+    struct LinkUpdate
+    {
+        /* The entry is removed before the fields, if any, are written */
+        bool del;
+        std::vector<FieldValueTuple> fvs;
+    };
+
     ProducerStateTable m_portTableProducer;
-    Table m_portTable, m_statePortTable;
+    Table m_portTable;
+    RedisPipeline m_statePipeline;
+    Table m_statePortTable;
 
     std::map<unsigned int, std::string> m_ifindexNameMap;
     std::map<unsigned int, std::string> m_ifindexOldNameMap;
+
+    /* Ports known to be in APPL_DB PORT_TABLE */
+    std::set<std::string> m_appPorts;
+    /* Fields last written to STATE_DB PORT_TABLE for every port */
+    std::map<std::string, std::vector<FieldValueTuple>> m_statePorts;
+
+    std::map<std::string, LinkUpdate> m_pendingLinks;
+    std::chrono::steady_clock::time_point m_pendingSince;
+
+    bool isAppPort(const std::string &key);
+    void addPendingLink(const std::string &key, bool del, const std::vector<FieldValueTuple> &fvs);
 };
 
 }
@@ -100,7 +100,9 @@ int main(int argc, char **argv)
         {
             Selectable *temps;
             int ret;
-            ret = s.select(&temps, DEFAULT_SELECT_TIMEOUT);
+            /* Wake up when the coalesced link updates are due */
+            int timeout = sync.getFlushTimeout();
+            ret = s.select(&temps, timeout >= 0 ? timeout : DEFAULT_SELECT_TIMEOUT);
 
             if (ret == Select::ERROR)
             {
@@ -109,6 +111,7 @@ int main(int argc, char **argv)
             }
             else if (ret == Select::TIMEOUT)
             {
+                sync.flushPendingLinks();
                 continue;
             }
             else if (ret != Select::OBJECT)
@@ -119,9 +122,17 @@ int main(int argc, char **argv)
 
             if (temps == static_cast<Selectable*>(&netlink))
             {
+                if (sync.getFlushTimeout() == 0)
+                {
+                    sync.flushPendingLinks();
+                }
+
                 /* on netlink message, check if PortInitDone should be sent out */
                 if (!g_init && g_portSet.empty())
                 {
+                    /* Host interfaces are in STATE_DB before the signal */
+                    sync.flushPendingLinks();
+
                     /*
                      * After finishing reading port configuration file and
                      * creating all host interfaces, this daemon shall send
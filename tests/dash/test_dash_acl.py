@@ -237,6 +237,9 @@ class DashAcl(object):
 
         self.app_dash_acl_rule_table[str(group_id) + ":" + str(rule_id)] = {"pb": pb.SerializeToString()}
 
+    def remove_acl_rule(self, group_id, rule_id):
+        del self.app_dash_acl_rule_table[str(group_id) + ":" + str(rule_id)]
+
     def create_acl_group(self, group_id, ip_version):
         pb = AclGroup()
         pb.ip_version = IpVersion.IP_VERSION_IPV4
@@ -440,24 +443,35 @@ class TestAcl(object):
 
         self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, acl_group_key)
 
-        # The new rule should not be created since the group is bound
+        # The group is bound, so it is rebuilt with both rules and the ENI is moved to the new group
         ctx.create_acl_rule(ACL_GROUP_1, ACL_RULE_2,
                             priority=2, action=Action.ACTION_PERMIT, terminating=False,
                             src_addr=["192.168.0.1/32", "192.168.1.2/30"], dst_addr=["192.168.0.1/32", "192.168.1.2/30"],
                             src_port=[PortRange(0,1)], dst_port=[PortRange(0,1)])
-        time.sleep(3)
+        ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=2)
+        new_acl_group_key = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
+        assert new_acl_group_key != acl_group_key
+        self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_acl_group_key)
+
+        # Removing a rule rebuilds the group again
+        ctx.remove_acl_rule(ACL_GROUP_1, ACL_RULE_2)
         ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)
+        acl_group_key = new_acl_group_key
+        new_acl_group_key = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
+        assert new_acl_group_key != acl_group_key
+        self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_acl_group_key)
 
         # Unbinding the group
         ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
         ctx.asic_eni_table.wait_for_field_match(key=eni_key, expected_fields={sai_stage: SAI_NULL_OID})
 
-        # Now the rule can be created since the group is no longer bound
+        # Rules of an unbound group are changed in place
         ctx.create_acl_rule(ACL_GROUP_1, ACL_RULE_2,
                             priority=2, action=Action.ACTION_PERMIT, terminating=False,
                             src_addr=["192.168.0.1/32", "192.168.1.2/30"], dst_addr=["192.168.0.1/32", "192.168.1.2/30"],
                             src_port=[PortRange(0,1)], dst_port=[PortRange(0,1)])
         ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=2)
+        assert ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0] == new_acl_group_key
 
     def test_acl_group_binding(self, ctx):
         eni_key = ctx.asic_eni_table.get_keys()[0]
@@ -506,8 +520,8 @@ class TestAcl(object):
         ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)
 
 
-    # @pytest.mark.parametrize("bind_group", [True, False])
-    def test_prefix_single_tag(self, ctx):
+    @pytest.mark.parametrize("bind_group", [True, False])
+    def test_prefix_single_tag(self, ctx, bind_group):
         tag1_prefixes = {"1.1.1.0/24", "2.2.0.0/16"}
         ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
         tag2_prefixes = {"192.168.1.0/30", "192.168.2.0/30", "192.168.3.0/30"}
@@ -527,40 +541,39 @@ class TestAcl(object):
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
         assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
 
-        # Updating tags will not be supported until full tag support is implemented in SAI
-        # if bind_group:
-            # self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
+        if bind_group:
+            self.bind_acl_group(ctx, ACL_STAGE_1, ACL_GROUP_1, group1_id)
 
-        # tag1_prefixes = {"1.1.2.0/24", "2.3.0.0/16"}
-        # ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
+        tag1_prefixes = {"1.1.2.0/24", "2.3.0.0/16"}
+        ctx.create_prefix_tag(TAG_1, IpVersion.IP_VERSION_IPV4, tag1_prefixes)
 
-        # time.sleep(3)
+        time.sleep(3)
 
-        # rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
-        # rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
+        rule1_id= ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
 
-        # if bind_group:
-        #     new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
-        #     assert new_group1_id != group1_id
-        #     self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
+        if bind_group:
+            new_group1_id = ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)[0]
+            assert new_group1_id != group1_id
+            self.verify_group_is_bound_to_eni(ctx, ACL_STAGE_1, new_group1_id)
 
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
 
-        # tag2_prefixes = {"192.168.2.0/30", "192.168.3.0/30"}
-        # ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
+        tag2_prefixes = {"192.168.2.0/30", "192.168.3.0/30"}
+        ctx.create_prefix_tag(TAG_2, IpVersion.IP_VERSION_IPV4, tag2_prefixes)
 
-        # time.sleep(3)
+        time.sleep(3)
 
-        # ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)
-        # rule1_id = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
-        # rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
+        ctx.asic_dash_acl_group_table.wait_for_n_keys(num_keys=1)
+        rule1_id = ctx.asic_dash_acl_rule_table.wait_for_n_keys(num_keys=1)[0]
+        rule1_attr = ctx.asic_dash_acl_rule_table[rule1_id]
 
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
-        # assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_SIP"]) == tag1_prefixes
+        assert prefix_list_to_set(rule1_attr["SAI_DASH_ACL_RULE_ATTR_DIP"]) == tag2_prefixes
 
-        # if bind_group:
-        #     ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
+        if bind_group:
+            ctx.unbind_acl_in(self.eni_name, ACL_STAGE_1)
 
     # @pytest.mark.parametrize("bind_group", [True, False])
     def test_multiple_tags(self, ctx):
@@ -0,0 +1,230 @@
+#include "ut_helper.h"
+#include "mock_table.h"
+#include "schema.h"
+#define private public
+#include "buffercalculator.h"
+#undef private
+
+namespace buffercalculator_test
+{
+    using namespace std;
+    using namespace swss;
+
+    struct BufferCalculatorTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_state_db;
+        shared_ptr<swss::DBConnector> m_app_db;
+
+        void SetUp() override
+        {
+            testing_db::reset();
+
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
+            m_app_db = make_shared<swss::DBConnector>("APPL_DB", 0);
+
+            Table asicTable(m_state_db.get(), "ASIC_TABLE");
+            asicTable.set("MELLANOX-SPECTRUM-3",
+                          {
+                              {"cell_size", "144"},
+                              {"pipeline_latency", "19"},
+                              {"mac_phy_delay", "0.8"},
+                              {"peer_response_time", "3.8"}
+                          });
+
+            Table trafficPatternTable(m_config_db.get(), "LOSSLESS_TRAFFIC_PATTERN");
+            trafficPatternTable.set("AZURE",
+                                    {
+                                        {"mtu", "1024"},
+                                        {"small_packet_percentage", "100"}
+                                    });
+        }
+
+        void TearDown() override
+        {
+            testing_db::reset();
+        }
+
+        buffer_headroom_input_t headroomInput(const string &speed, const string &cable)
+        {
+            buffer_headroom_input_t input;
+            input.speed = speed;
+            input.cable_length = cable;
+            input.port_mtu = "9100";
+            input.gearbox_delay = "";
+            input.lane_count = 4;
+            input.shp_enabled = false;
+            return input;
+        }
+
+        void populateLedger(BufferApplDbLedger &ledger, const string &losslessSize)
+        {
+            ledger.set(BUFFER_LEDGER_PROFILE, "ingress_lossy_profile", {{"pool", "ingress_lossless_pool"}, {"size", "0"}, {"dynamic_th", "3"}});
+            ledger.set(BUFFER_LEDGER_PROFILE, "pg_lossless_100000_5m_profile",
+                       {{"xon", "19456"}, {"xoff", "108544"}, {"size", losslessSize}, {"pool", "ingress_lossless_pool"}, {"dynamic_th", "0"}});
+            ledger.set(BUFFER_LEDGER_PROFILE, "egress_lossless_profile", {{"pool", "egress_lossless_pool"}, {"size", "0"}, {"static_th", "0"}});
+            ledger.set(BUFFER_LEDGER_PROFILE, "egress_lossy_profile", {{"pool", "egress_lossy_pool"}, {"size", "9216"}, {"dynamic_th", "7"}});
+
+            ledger.set(BUFFER_LEDGER_PG, "Ethernet0:0", {{"profile", "ingress_lossy_profile"}});
+            ledger.set(BUFFER_LEDGER_PG, "Ethernet0:3-4", {{"profile", "pg_lossless_100000_5m_profile"}});
+            ledger.set(BUFFER_LEDGER_PG, "Ethernet4:0", {{"profile", "ingress_lossy_profile"}});
+            ledger.set(BUFFER_LEDGER_QUEUE, "Ethernet0:0-2", {{"profile", "egress_lossy_profile"}});
+            ledger.set(BUFFER_LEDGER_QUEUE, "Ethernet0:3-4", {{"profile", "egress_lossless_profile"}});
+            ledger.set(BUFFER_LEDGER_INGRESS_PROFILE_LIST, "Ethernet0", {{"profile_list", "ingress_lossy_profile"}});
+            ledger.set(BUFFER_LEDGER_EGRESS_PROFILE_LIST, "Ethernet0", {{"profile_list", "egress_lossless_profile,egress_lossy_profile"}});
+        }
+
+        buffer_pool_calc_input_t poolInput()
+        {
+            buffer_pool_calc_input_t input;
+            input.pools.push_back({"egress_lossless_pool", false, false, "13945824", ""});
+            input.pools.push_back({"egress_lossy_pool", false, true, "", ""});
+            input.pools.push_back({"ingress_lossless_pool", true, true, "", ""});
+            input.ports["Ethernet0"] = {4, true};
+            input.ports["Ethernet4"] = {8, true};
+            input.mmu_size = "13945824";
+            input.platform = "x86_64-mlnx_msn2700-r0";
+            input.updates_pending = false;
+            return input;
+        }
+    };
+
+    TEST_F(BufferCalculatorTest, LedgerTracksReferences)
+    {
+        BufferApplDbLedger ledger;
+        string port;
+
+        ASSERT_EQ(BufferApplDbLedger::getObjectCount("Ethernet0:3-4", port), 2);
+        ASSERT_EQ(port, "Ethernet0");
+        ASSERT_EQ(BufferApplDbLedger::getObjectCount("Ethernet8:0", port), 1);
+        ASSERT_EQ(BufferApplDbLedger::getObjectCount("PortChannel0001:0", port), 0);
+
+        populateLedger(ledger, "128000");
+        ASSERT_EQ(ledger.getObjectRefs().at("ingress_lossy_profile"), 2);
+        ASSERT_EQ(ledger.getObjectRefs().at("pg_lossless_100000_5m_profile"), 2);
+        ASSERT_EQ(ledger.getObjectRefs().at("egress_lossy_profile"), 3);
+        ASSERT_EQ(ledger.getPortPgRefs().size(), 2);
+
+        // Moving a PG to another profile moves its references
+        ledger.set(BUFFER_LEDGER_PG, "Ethernet0:3-4", {{"profile", "ingress_lossy_profile"}});
+        ASSERT_EQ(ledger.getObjectRefs().at("ingress_lossy_profile"), 4);
+        ASSERT_EQ(ledger.getObjectRefs().count("pg_lossless_100000_5m_profile"), 0);
+
+        // Removing all objects of a port drops the port
+        ledger.del(BUFFER_LEDGER_PG, "Ethernet4:0");
+        ASSERT_EQ(ledger.getPortPgRefs().count("Ethernet4"), 0);
+        ASSERT_EQ(ledger.getObjectRefs().at("ingress_lossy_profile"), 3);
+
+        // Profile fields are merged like HSET
+        ledger.set(BUFFER_LEDGER_PROFILE, "egress_lossy_profile", {{"size", "0"}});
+        ASSERT_EQ(ledger.getProfiles().at("egress_lossy_profile").at("pool"), "egress_lossy_pool");
+        ASSERT_EQ(ledger.getProfiles().at("egress_lossy_profile").at("size"), "0");
+    }
+
+    TEST_F(BufferCalculatorTest, FallbackForUnknownVendor)
+    {
+        auto calculator = BufferCalculator::create("mock_test", m_config_db.get(), m_state_db.get(), m_app_db.get());
+        BufferApplDbLedger ledger;
+        buffer_headroom_t headroom;
+        vector<string> result;
+
+        ASSERT_FALSE(calculator->isNative());
+        ASSERT_FALSE(calculator->calculateHeadroom(headroomInput("100000", "5m"), headroom));
+        ASSERT_FALSE(calculator->calculatePoolSizes(poolInput(), ledger, result));
+    }
+
+    TEST_F(BufferCalculatorTest, MellanoxHeadroom)
+    {
+        auto calculator = BufferCalculator::create("mellanox", m_config_db.get(), m_state_db.get(), m_app_db.get());
+        buffer_headroom_t headroom;
+
+        ASSERT_TRUE(calculator->calculateHeadroom(headroomInput("100000", "5m"), headroom));
+        ASSERT_EQ(headroom.xon, "19456");
+        ASSERT_EQ(headroom.xoff, "108544");
+        ASSERT_EQ(headroom.size, "128000");
+        ASSERT_EQ(calculator->m_headroomMemo.size(), 1);
+
+        // Served from the memo
+        ASSERT_TRUE(calculator->calculateHeadroom(headroomInput("100000", "5m"), headroom));
+        ASSERT_EQ(calculator->m_headroomMemo.size(), 1);
+
+        // The memo is dropped once the traffic pattern changes
+        Table trafficPatternTable(m_config_db.get(), "LOSSLESS_TRAFFIC_PATTERN");
+        trafficPatternTable.set("AZURE", {{"small_packet_percentage", "50"}});
+        calculator->invalidateParameters();
+        ASSERT_TRUE(calculator->calculateHeadroom(headroomInput("100000", "5m"), headroom));
+        ASSERT_EQ(calculator->m_headroomMemo.size(), 1);
+        ASSERT_EQ(headroom.xoff, "48128");
+        ASSERT_EQ(headroom.size, "67584");
+    }
+
+    TEST_F(BufferCalculatorTest, MellanoxPoolSizes)
+    {
+        auto calculator = BufferCalculator::create("mellanox", m_config_db.get(), m_state_db.get(), m_app_db.get());
+        BufferApplDbLedger ledger;
+        vector<string> result;
+        auto input = poolInput();
+
+        // A referenced profile which hasn't been written yet keeps the pool sizes in APPL_DB
+        ledger.set(BUFFER_LEDGER_PG, "Ethernet0:3-4", {{"profile", "pg_lossless_100000_5m_profile"}});
+        ASSERT_TRUE(calculator->calculatePoolSizes(input, ledger, result));
+        ASSERT_EQ(result, vector<string>({"egress_lossy_pool:0", "ingress_lossless_pool:0"}));
+
+        populateLedger(ledger, "128000");
+        ASSERT_TRUE(calculator->calculatePoolSizes(input, ledger, result));
+        ASSERT_EQ(result[0], "ingress_lossless_pool:13255648");
+        ASSERT_EQ(result[1], "egress_lossy_pool:13255648");
+
+        // Shared headroom pool enabled by over subscribe ratio
+        populateLedger(ledger, "19456");
+        input.over_subscribe_ratio = "2";
+        ASSERT_TRUE(calculator->calculatePoolSizes(input, ledger, result));
+        ASSERT_EQ(result[0], "ingress_lossless_pool:13359072:103424");
+        ASSERT_EQ(result[1], "egress_lossy_pool:13359072");
+    }
+
+    TEST_F(BufferCalculatorTest, MellanoxPoolSizesPendingUpdates)
+    {
+        auto calculator = BufferCalculator::create("mellanox", m_config_db.get(), m_state_db.get(), m_app_db.get());
+        BufferApplDbLedger ledger;
+        vector<string> result;
+        auto input = poolInput();
+
+        Table applBufferPoolTable(m_app_db.get(), APP_BUFFER_POOL_TABLE_NAME);
+        applBufferPoolTable.set("egress_lossy_pool", {{"size", "13000000"}});
+        applBufferPoolTable.set("ingress_lossless_pool", {{"size", "12000000"}, {"xoff", "100000"}});
+
+        // The pool sizes in APPL_DB are kept until orchagent has consumed the buffer objects
+        populateLedger(ledger, "128000");
+        input.updates_pending = true;
+        ASSERT_TRUE(calculator->calculatePoolSizes(input, ledger, result));
+        ASSERT_EQ(result, vector<string>({"egress_lossy_pool:13000000", "ingress_lossless_pool:12000000:100000"}));
+
+        input.updates_pending = false;
+        ASSERT_TRUE(calculator->calculatePoolSizes(input, ledger, result));
+        ASSERT_EQ(result[0], "ingress_lossless_pool:13255648");
+        ASSERT_EQ(result[1], "egress_lossy_pool:13255648");
+    }
+
+    TEST_F(BufferCalculatorTest, MellanoxPoolSizesSharedHeadroomPoolPlaceholder)
+    {
+        auto calculator = BufferCalculator::create("mellanox", m_config_db.get(), m_state_db.get(), m_app_db.get());
+        BufferApplDbLedger ledger;
+        vector<string> result;
+        auto input = poolInput();
+
+        // Pools haven't been sized yet while the profiles already use the shared headroom pool
+        populateLedger(ledger, "19456");
+        input.over_subscribe_ratio = "2";
+        input.updates_pending = true;
+        ASSERT_TRUE(calculator->calculatePoolSizes(input, ledger, result));
+        ASSERT_EQ(result, vector<string>({"egress_lossy_pool:0", "ingress_lossless_pool:2048:1024"}));
+
+        // The placeholder is not used once the pool has been sized
+        Table applBufferPoolTable(m_app_db.get(), APP_BUFFER_POOL_TABLE_NAME);
+        applBufferPoolTable.set("ingress_lossless_pool", {{"size", "12000000"}});
+        ASSERT_TRUE(calculator->calculatePoolSizes(input, ledger, result));
+        ASSERT_EQ(result, vector<string>({"egress_lossy_pool:0", "ingress_lossless_pool:12000000"}));
+    }
+}
@@ -2725,4 +2725,88 @@ namespace buffermgrdyn_test
             << "The bad dump's pool xoff=655360 is produced only when the profile has already fallen back to size=xon";
     }
 
+    /*
+     * Shared buffer pool updates requested while a drain is handled are coalesced
+     * into one calculation at the end of the drain
+     */
+    TEST_F(BufferMgrDynTest, TestSharedBufferPoolUpdateCoalesced)
+    {
+        InitDefaultLosslessParameter();
+        InitMmuSize();
+        StartBufferManager();
+
+        InitPort();
+        SetPortInitDone();
+        m_dynamicBuffer->doTask(m_selectableTable);
+        InitBufferPool();
+
+        m_dynamicBuffer->m_bufferpoolSha = "mock_buffer_pool";
+        m_dynamicBuffer->m_mmuSize = "200000000";
+        m_dynamicBuffer->m_mmuSizeNumber = 200000000;
+        SetRedisScriptReply({"ingress_lossless_pool:100081664:655360"});
+
+        vector<FieldValueTuple> fieldValues;
+        ASSERT_TRUE(appBufferPoolTable.get(INGRESS_LOSSLESS_PG_POOL_NAME, fieldValues));
+        map<string, string> pool(fieldValues.begin(), fieldValues.end());
+        ASSERT_NE(pool["size"], "100081664");
+
+        // The pools are not updated before the end of the drain
+        m_dynamicBuffer->scheduleSharedBufferPoolUpdate();
+        m_dynamicBuffer->scheduleSharedBufferPoolUpdate();
+        m_dynamicBuffer->scheduleSharedBufferPoolUpdate();
+        m_dynamicBuffer->m_applBufferPoolTable.flush();
+        ASSERT_TRUE(appBufferPoolTable.get(INGRESS_LOSSLESS_PG_POOL_NAME, fieldValues));
+        pool = map<string, string>(fieldValues.begin(), fieldValues.end());
+        ASSERT_NE(pool["size"], "100081664");
+
+        m_dynamicBuffer->flushSharedBufferPoolUpdate();
+        m_dynamicBuffer->m_applBufferPoolTable.flush();
+        ASSERT_TRUE(appBufferPoolTable.get(INGRESS_LOSSLESS_PG_POOL_NAME, fieldValues));
+        pool = map<string, string>(fieldValues.begin(), fieldValues.end());
+        EXPECT_EQ(pool["size"], "100081664");
+        EXPECT_EQ(pool["xoff"], "655360");
+        ASSERT_FALSE(m_dynamicBuffer->m_sharedBufferPoolDirty);
+    }
+
+    /*
+     * A shared buffer pool update that can't be applied before the buffer is completely
+     * initialized on warm start is flushed by the timer which completes the initialization
+     */
+    TEST_F(BufferMgrDynTest, TestSharedBufferPoolUpdateFlushedByTimer)
+    {
+        InitDefaultLosslessParameter();
+        InitMmuSize();
+        StartBufferManager();
+
+        InitPort();
+        SetPortInitDone();
+        m_dynamicBuffer->doTask(m_selectableTable);
+        InitBufferPool();
+        ASSERT_TRUE(m_dynamicBuffer->m_bufferPoolReady);
+
+        WarmStart::getInstance().m_enabled = true;
+        m_dynamicBuffer->m_bufferCompletelyInitialized = false;
+        m_dynamicBuffer->m_bufferObjectsPending = false;
+        m_dynamicBuffer->m_bufferpoolSha = "mock_buffer_pool";
+        m_dynamicBuffer->m_mmuSize = "200000000";
+        m_dynamicBuffer->m_mmuSizeNumber = 200000000;
+        SetRedisScriptReply({"ingress_lossless_pool:100081664:655360"});
+
+        // The pools are not updated while the buffer is being initialized
+        m_dynamicBuffer->scheduleSharedBufferPoolUpdate();
+        m_dynamicBuffer->flushSharedBufferPoolUpdate();
+        ASSERT_TRUE(m_dynamicBuffer->m_sharedBufferPoolDirty);
+
+        // The timer applies the pending objects and then the pool sizes
+        m_dynamicBuffer->doTask(m_selectableTable);
+        ASSERT_TRUE(m_dynamicBuffer->m_bufferCompletelyInitialized);
+        ASSERT_FALSE(m_dynamicBuffer->m_sharedBufferPoolDirty);
+        m_dynamicBuffer->m_applBufferPoolTable.flush();
+
+        vector<FieldValueTuple> fieldValues;
+        ASSERT_TRUE(appBufferPoolTable.get(INGRESS_LOSSLESS_PG_POOL_NAME, fieldValues));
+        map<string, string> pool(fieldValues.begin(), fieldValues.end());
+        EXPECT_EQ(pool["size"], "100081664");
+        EXPECT_EQ(pool["xoff"], "655360");
+    }
 }
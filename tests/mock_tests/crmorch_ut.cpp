@@ -0,0 +1,152 @@
+#include "ut_helper.h"
+
+extern sai_switch_api_t *sai_switch_api;
+
+namespace crmorch_test
+{
+    using namespace std;
+
+    uint32_t get_switch_attribute_count;
+
+    sai_status_t _ut_stub_sai_get_switch_attribute(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        get_switch_attribute_count++;
+        if (attr_list[0].id == SAI_SWITCH_ATTR_AVAILABLE_ACL_TABLE)
+        {
+            attr_list[0].value.aclresource.count = 0;
+        }
+        else
+        {
+            attr_list[0].value.u32 = 1000;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    struct CrmOrchTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_counters_db;
+        CrmOrch *m_crmOrch = nullptr;
+        sai_switch_api_t *m_old_sai_switch_api = nullptr;
+        sai_switch_api_t m_ut_sai_switch_api;
+
+        CrmOrchTest()
+        {
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+        }
+
+        void SetUp() override
+        {
+            m_old_sai_switch_api = sai_switch_api;
+            m_ut_sai_switch_api = {};
+            m_ut_sai_switch_api.get_switch_attribute = _ut_stub_sai_get_switch_attribute;
+            sai_switch_api = &m_ut_sai_switch_api;
+
+            m_crmOrch = new CrmOrch(m_config_db.get(), CFG_CRM_TABLE_NAME);
+
+            // Only keep resources which are served by the stubbed switch API
+            for (auto &res : Portal::CrmOrchInternal::getResourceMap(m_crmOrch))
+            {
+                if (res.first != CrmResourceType::CRM_FDB_ENTRY &&
+                    res.first != CrmResourceType::CRM_IPMC_ENTRY &&
+                    res.first != CrmResourceType::CRM_ACL_TABLE)
+                {
+                    res.second.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
+                }
+            }
+
+            get_switch_attribute_count = 0;
+        }
+
+        void TearDown() override
+        {
+            delete m_crmOrch;
+            m_crmOrch = nullptr;
+
+            sai_switch_api = m_old_sai_switch_api;
+        }
+
+        string getCounter(const string &field)
+        {
+            Table countersCrmTable(m_counters_db.get(), COUNTERS_CRM_TABLE);
+            string value;
+            countersCrmTable.hget("STATS", field, value);
+            return value;
+        }
+    };
+
+    TEST_F(CrmOrchTest, PollOnlyChangedResources)
+    {
+        auto &resourceMap = Portal::CrmOrchInternal::getResourceMap(m_crmOrch);
+
+        // First poll queries every supported resource
+        Portal::CrmOrchInternal::doTimerTask(m_crmOrch);
+        ASSERT_FALSE(resourceMap.at(CrmResourceType::CRM_FDB_ENTRY).dirty);
+        ASSERT_FALSE(resourceMap.at(CrmResourceType::CRM_IPMC_ENTRY).dirty);
+        ASSERT_NE(getCounter("crm_stats_fdb_entry_available"), "");
+        ASSERT_EQ(getCounter("crm_stats_fdb_entry_used"), "0");
+
+        // Nothing changed, SAI must not be queried
+        get_switch_attribute_count = 0;
+        Portal::CrmOrchInternal::doTimerTask(m_crmOrch);
+        ASSERT_EQ(get_switch_attribute_count, 0);
+
+        // Only the changed resource is queried and published
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_FDB_ENTRY);
+        ASSERT_TRUE(resourceMap.at(CrmResourceType::CRM_FDB_ENTRY).dirty);
+        ASSERT_FALSE(resourceMap.at(CrmResourceType::CRM_IPMC_ENTRY).dirty);
+
+        Table countersCrmTable(m_counters_db.get(), COUNTERS_CRM_TABLE);
+        countersCrmTable.hset("STATS", "crm_stats_ipmc_entry_available", "stale");
+
+        get_switch_attribute_count = 0;
+        Portal::CrmOrchInternal::doTimerTask(m_crmOrch);
+        ASSERT_LE(get_switch_attribute_count, 1);
+        ASSERT_FALSE(resourceMap.at(CrmResourceType::CRM_FDB_ENTRY).dirty);
+        ASSERT_EQ(getCounter("crm_stats_fdb_entry_used"), "1");
+
+        // Unchanged fields are not rewritten
+        ASSERT_EQ(getCounter("crm_stats_ipmc_entry_available"), "stale");
+    }
+
+    TEST_F(CrmOrchTest, DefaultFullRefreshEveryFewPolls)
+    {
+        Portal::CrmOrchInternal::doTimerTask(m_crmOrch);
+
+        // No full refresh before the third poll
+        Portal::CrmOrchInternal::skipPolls(m_crmOrch, 2);
+        get_switch_attribute_count = 0;
+        Portal::CrmOrchInternal::doTimerTask(m_crmOrch);
+        ASSERT_EQ(get_switch_attribute_count, 0);
+
+        Portal::CrmOrchInternal::skipPolls(m_crmOrch, 1);
+        get_switch_attribute_count = 0;
+        Portal::CrmOrchInternal::doTimerTask(m_crmOrch);
+        ASSERT_GT(get_switch_attribute_count, 0);
+    }
+
+    TEST_F(CrmOrchTest, FullRefreshOnConfigChange)
+    {
+        Portal::CrmOrchInternal::doTimerTask(m_crmOrch);
+
+        auto consumer = dynamic_cast<Consumer *>(m_crmOrch->getExecutor(CFG_CRM_TABLE_NAME));
+        consumer->addToSync(deque<KeyOpFieldsValuesTuple>({
+            { "Config", SET_COMMAND, { { "full_refresh_interval", "0" } } }
+        }));
+        static_cast<Orch *>(m_crmOrch)->doTask(*consumer);
+
+        // Every poll queries all supported resources again, including the ACL table
+        // availability which is only exposed through a switch attribute
+        get_switch_attribute_count = 0;
+        Portal::CrmOrchInternal::doTimerTask(m_crmOrch);
+        ASSERT_GT(get_switch_attribute_count, 0);
+
+        get_switch_attribute_count = 0;
+        Portal::CrmOrchInternal::doTimerTask(m_crmOrch);
+        ASSERT_GT(get_switch_attribute_count, 0);
+    }
+}
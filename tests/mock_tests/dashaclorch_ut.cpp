@@ -0,0 +1,346 @@
+#include <algorithm>
+
+#define private public
+#include "dashaclorch.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_sai_api.h"
+#include "mock_dash_orch_test.h"
+#include "dash_api/acl_group.pb.h"
+#include "dash_api/acl_rule.pb.h"
+
+EXTERN_MOCK_FNS
+
+namespace dashaclorch_test
+{
+    DEFINE_SAI_GENERIC_APIS_MOCK(dash_acl, dash_acl_group, dash_acl_rule)
+    DEFINE_SAI_API_COMBINED_MOCK(dash_eni, eni, eni_ether_address_map)
+
+    using namespace mock_orch_test;
+    using ::testing::_;
+    using ::testing::Invoke;
+    using ::testing::Return;
+
+    class DashAclOrchTest : public MockDashOrchTest
+    {
+    protected:
+        DashAclOrch *m_dashAclOrch = nullptr;
+        sai_object_id_t m_nextOid = 0x1000;
+        std::vector<sai_object_id_t> m_removedOids;
+        // ENI and ACL group of every ENI attribute set
+        std::vector<std::pair<sai_object_id_t, sai_object_id_t>> m_eniBindings;
+
+        void ApplySaiMock() override
+        {
+            INIT_SAI_API_MOCK(dash_acl);
+            INIT_SAI_API_MOCK(dash_eni);
+            MockSaiApis();
+        }
+
+        void PostSetUp() override
+        {
+            std::vector<std::string> dash_acl_tables = {
+                APP_DASH_ACL_IN_TABLE_NAME,
+                APP_DASH_ACL_OUT_TABLE_NAME,
+                APP_DASH_ACL_GROUP_TABLE_NAME,
+                APP_DASH_ACL_RULE_TABLE_NAME,
+                APP_DASH_PREFIX_TAG_TABLE_NAME
+            };
+            m_dashAclOrch = new DashAclOrch(m_app_db.get(), dash_acl_tables, m_DashOrch, m_dpu_app_state_db.get(), nullptr);
+
+            // Create and remove the objects unless a test says otherwise
+            ON_CALL(*mock_sai_dash_acl_api, create_dash_acl_groups).WillByDefault(Invoke(this, &DashAclOrchTest::CreateObjects));
+            ON_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules).WillByDefault(Invoke(this, &DashAclOrchTest::CreateObjects));
+            ON_CALL(*mock_sai_dash_acl_api, remove_dash_acl_groups).WillByDefault(Invoke(this, &DashAclOrchTest::RemoveObjects));
+            ON_CALL(*mock_sai_dash_acl_api, remove_dash_acl_rules).WillByDefault(Invoke(this, &DashAclOrchTest::RemoveObjects));
+            ON_CALL(*mock_sai_dash_eni_api, set_eni_attribute).WillByDefault(Invoke(this, &DashAclOrchTest::SetEniAttribute));
+        }
+
+        void PreTearDown() override
+        {
+            delete m_dashAclOrch;
+            m_dashAclOrch = nullptr;
+            RestoreSaiApis();
+            DEINIT_SAI_API_MOCK(dash_eni);
+            DEINIT_SAI_API_MOCK(dash_acl);
+        }
+
+        sai_status_t CreateObjects(sai_object_id_t, uint32_t object_count, const uint32_t *, const sai_attribute_t **,
+                                   sai_bulk_op_error_mode_t, sai_object_id_t *object_id, sai_status_t *object_statuses)
+        {
+            for (uint32_t i = 0; i < object_count; i++)
+            {
+                object_id[i] = m_nextOid++;
+                object_statuses[i] = SAI_STATUS_SUCCESS;
+            }
+            return SAI_STATUS_SUCCESS;
+        }
+
+        sai_status_t RemoveObjects(uint32_t object_count, const sai_object_id_t *object_id, sai_bulk_op_error_mode_t,
+                                   sai_status_t *object_statuses)
+        {
+            for (uint32_t i = 0; i < object_count; i++)
+            {
+                m_removedOids.push_back(object_id[i]);
+                object_statuses[i] = SAI_STATUS_SUCCESS;
+            }
+            return SAI_STATUS_SUCCESS;
+        }
+
+        sai_status_t SetEniAttribute(sai_object_id_t eni_id, const sai_attribute_t *attr)
+        {
+            m_eniBindings.emplace_back(eni_id, attr->value.oid);
+            return SAI_STATUS_SUCCESS;
+        }
+
+        void AddEni(const std::string &eni, sai_object_id_t eni_id)
+        {
+            EniEntry entry;
+            entry.eni_id = eni_id;
+            m_DashOrch->eni_entries_[eni] = entry;
+        }
+
+        // Fail the creation of the object at index fail_index of the bulk for lack of resources
+        auto FailCreateAt(uint32_t fail_index)
+        {
+            return [this, fail_index](sai_object_id_t, uint32_t object_count, const uint32_t *, const sai_attribute_t **,
+                                      sai_bulk_op_error_mode_t, sai_object_id_t *object_id, sai_status_t *object_statuses) {
+                for (uint32_t i = 0; i < object_count; i++)
+                {
+                    object_id[i] = (i == fail_index) ? SAI_NULL_OBJECT_ID : m_nextOid++;
+                    object_statuses[i] = (i == fail_index) ? SAI_STATUS_INSUFFICIENT_RESOURCES : SAI_STATUS_SUCCESS;
+                }
+                return SAI_STATUS_FAILURE;
+            };
+        }
+
+        std::unique_ptr<Consumer> MakeConsumer(const std::string &table_name)
+        {
+            return std::make_unique<Consumer>(
+                new swss::ConsumerStateTable(m_app_db.get(), table_name),
+                m_dashAclOrch, table_name);
+        }
+
+        void AddToSync(Consumer &consumer, const std::string &key, const google::protobuf::Message &message)
+        {
+            consumer.addToSync(swss::KeyOpFieldsValuesTuple(key, SET_COMMAND, { { "pb", message.SerializeAsString() } }));
+        }
+
+        dash::acl_group::AclGroup BuildAclGroup()
+        {
+            dash::acl_group::AclGroup group;
+            group.set_ip_version(dash::types::IP_VERSION_IPV4);
+            return group;
+        }
+
+        dash::acl_rule::AclRule BuildAclRule(uint32_t priority)
+        {
+            dash::acl_rule::AclRule rule;
+            rule.set_priority(priority);
+            rule.set_action(dash::acl_rule::ACTION_PERMIT);
+            rule.set_terminating(true);
+            return rule;
+        }
+
+        std::vector<std::string> PendingKeys(Consumer &consumer)
+        {
+            std::vector<std::string> keys;
+            for (const auto &it : consumer.m_toSync)
+            {
+                keys.push_back(kfvKey(it.second));
+            }
+            return keys;
+        }
+
+        std::string GetResult(const std::string &table_name, const std::string &key)
+        {
+            swss::Table resultTable(m_dpu_app_state_db.get(), table_name);
+            std::string result;
+            resultTable.hget(key, "result", result);
+            return result;
+        }
+    };
+
+    TEST_F(DashAclOrchTest, GroupBulkCreatePartialFailure)
+    {
+        auto consumer = MakeConsumer(APP_DASH_ACL_GROUP_TABLE_NAME);
+        AddToSync(*consumer, "group1", BuildAclGroup());
+        AddToSync(*consumer, "group2", BuildAclGroup());
+        AddToSync(*consumer, "group3", BuildAclGroup());
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_groups).WillOnce(Invoke(FailCreateAt(1)));
+        m_dashAclOrch->doTask(*consumer);
+
+        // Only the group that couldn't be created waits for a retry
+        EXPECT_EQ(PendingKeys(*consumer), std::vector<std::string>({ "group2" }));
+        auto &groups = m_dashAclOrch->m_group_mgr.m_groups_table;
+        EXPECT_EQ(groups.size(), 2u);
+        ASSERT_TRUE(m_dashAclOrch->m_group_mgr.exists("group1"));
+        ASSERT_TRUE(m_dashAclOrch->m_group_mgr.exists("group3"));
+        EXPECT_NE(groups["group1"].m_dash_acl_group_id, SAI_NULL_OBJECT_ID);
+        EXPECT_NE(groups["group3"].m_dash_acl_group_id, SAI_NULL_OBJECT_ID);
+        EXPECT_FALSE(m_dashAclOrch->m_group_mgr.exists("group2"));
+        EXPECT_EQ(GetResult(APP_DASH_ACL_GROUP_TABLE_NAME, "group1"), std::to_string(DASH_RESULT_SUCCESS));
+        EXPECT_EQ(GetResult(APP_DASH_ACL_GROUP_TABLE_NAME, "group2"), "");
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_groups)
+            .WillOnce(Invoke(this, &DashAclOrchTest::CreateObjects));
+        m_dashAclOrch->doTask(*consumer);
+
+        EXPECT_TRUE(consumer->m_toSync.empty());
+        EXPECT_TRUE(m_dashAclOrch->m_group_mgr.exists("group2"));
+        EXPECT_EQ(GetResult(APP_DASH_ACL_GROUP_TABLE_NAME, "group2"), std::to_string(DASH_RESULT_SUCCESS));
+    }
+
+    TEST_F(DashAclOrchTest, RuleBulkCreatePartialFailure)
+    {
+        auto groupConsumer = MakeConsumer(APP_DASH_ACL_GROUP_TABLE_NAME);
+        AddToSync(*groupConsumer, "group1", BuildAclGroup());
+        m_dashAclOrch->doTask(*groupConsumer);
+        ASSERT_TRUE(m_dashAclOrch->m_group_mgr.exists("group1"));
+
+        auto consumer = MakeConsumer(APP_DASH_ACL_RULE_TABLE_NAME);
+        AddToSync(*consumer, "group1:rule1", BuildAclRule(1));
+        AddToSync(*consumer, "group1:rule2", BuildAclRule(2));
+        AddToSync(*consumer, "group1:rule3", BuildAclRule(3));
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules).WillOnce(Invoke(FailCreateAt(2)));
+        m_dashAclOrch->doTask(*consumer);
+
+        EXPECT_EQ(PendingKeys(*consumer), std::vector<std::string>({ "group1:rule3" }));
+        auto &rules = m_dashAclOrch->m_group_mgr.m_groups_table["group1"].m_dash_acl_rule_table;
+        EXPECT_EQ(rules.size(), 2u);
+        ASSERT_EQ(rules.count("rule1"), 1u);
+        ASSERT_EQ(rules.count("rule2"), 1u);
+        EXPECT_NE(rules["rule1"].m_dash_acl_rule_id, SAI_NULL_OBJECT_ID);
+        EXPECT_NE(rules["rule2"].m_dash_acl_rule_id, SAI_NULL_OBJECT_ID);
+        EXPECT_EQ(rules.count("rule3"), 0u);
+        EXPECT_EQ(GetResult(APP_DASH_ACL_RULE_TABLE_NAME, "group1:rule1"), std::to_string(DASH_RESULT_SUCCESS));
+        EXPECT_EQ(GetResult(APP_DASH_ACL_RULE_TABLE_NAME, "group1:rule3"), "");
+
+        EXPECT_CALL(*mock_sai_dash_acl_api, create_dash_acl_rules)
+            .WillOnce(Invoke(this, &DashAclOrchTest::CreateObjects));
+        m_dashAclOrch->doTask(*consumer);
+
+        EXPECT_TRUE(consumer->m_toSync.empty());
+        ASSERT_EQ(rules.count("rule3"), 1u);
+        EXPECT_NE(rules["rule3"].m_dash_acl_rule_id, SAI_NULL_OBJECT_ID);
+        EXPECT_EQ(GetResult(APP_DASH_ACL_RULE_TABLE_NAME, "group1:rule3"), std::to_string(DASH_RESULT_SUCCESS));
+    }
+
+    TEST_F(DashAclOrchTest, ShadowSwapFailureRestoresBindings)
+    {
+        auto &groupMgr = m_dashAclOrch->m_group_mgr;
+        AddEni("eni1", 0x2001);
+        AddEni("eni2", 0x2002);
+
+        auto groupConsumer = MakeConsumer(APP_DASH_ACL_GROUP_TABLE_NAME);
+        AddToSync(*groupConsumer, "group1", BuildAclGroup());
+        m_dashAclOrch->doTask(*groupConsumer);
+        auto consumer = MakeConsumer(APP_DASH_ACL_RULE_TABLE_NAME);
+        AddToSync(*consumer, "group1:rule1", BuildAclRule(1));
+        m_dashAclOrch->doTask(*consumer);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        ASSERT_EQ(groupMgr.bind("group1", "eni1", DashAclDirection::IN, DashAclStage::STAGE1), task_success);
+        ASSERT_EQ(groupMgr.bind("group1", "eni2", DashAclDirection::IN, DashAclStage::STAGE1), task_success);
+        auto &group = groupMgr.m_groups_table["group1"];
+        sai_object_id_t oldGroupOid = group.m_dash_acl_group_id;
+        m_eniBindings.clear();
+
+        // The second ENI can't be moved to the rebuilt group
+        EXPECT_CALL(*mock_sai_dash_eni_api, set_eni_attribute)
+            .WillOnce(Invoke(this, &DashAclOrchTest::SetEniAttribute))
+            .WillOnce(Invoke([this](sai_object_id_t eni_id, const sai_attribute_t *attr) {
+                m_eniBindings.emplace_back(eni_id, attr->value.oid);
+                return SAI_STATUS_INSUFFICIENT_RESOURCES;
+            }))
+            .WillOnce(Invoke(this, &DashAclOrchTest::SetEniAttribute));
+        AddToSync(*consumer, "group1:rule2", BuildAclRule(2));
+        m_dashAclOrch->doTask(*consumer);
+
+        // The ENI already moved is bound back to the current group
+        ASSERT_EQ(m_eniBindings.size(), 3u);
+        sai_object_id_t shadowGroupOid = m_eniBindings[0].second;
+        EXPECT_NE(shadowGroupOid, oldGroupOid);
+        EXPECT_EQ(m_eniBindings[1].second, shadowGroupOid);
+        EXPECT_NE(m_eniBindings[1].first, m_eniBindings[0].first);
+        EXPECT_EQ(m_eniBindings[2], std::make_pair(m_eniBindings[0].first, oldGroupOid));
+        EXPECT_NE(std::find(m_removedOids.begin(), m_removedOids.end(), shadowGroupOid), m_removedOids.end());
+
+        // The group keeps its rules, the change stays pending and the entry waits for a retry
+        EXPECT_EQ(group.m_dash_acl_group_id, oldGroupOid);
+        EXPECT_EQ(group.m_dash_acl_rule_table.size(), 1u);
+        EXPECT_EQ(group.m_dash_acl_rule_table.count("rule2"), 0u);
+        EXPECT_EQ(group.m_pending_rules.count("rule2"), 1u);
+        EXPECT_EQ(groupMgr.m_dirty_groups.count("group1"), 1u);
+        EXPECT_EQ(PendingKeys(*consumer), std::vector<std::string>({ "group1:rule2" }));
+        EXPECT_EQ(GetResult(APP_DASH_ACL_RULE_TABLE_NAME, "group1:rule2"), "");
+
+        // The dirty group is not rebuilt on every run of the orch, but when the retry timer fires
+        EXPECT_TRUE(m_dashAclOrch->m_refresh_timer_armed);
+        EXPECT_CALL(*mock_sai_dash_eni_api, set_eni_attribute).Times(0);
+        m_dashAclOrch->doTask();
+        EXPECT_EQ(groupMgr.m_dirty_groups.count("group1"), 1u);
+
+        m_eniBindings.clear();
+        EXPECT_CALL(*mock_sai_dash_eni_api, set_eni_attribute).Times(2)
+            .WillRepeatedly(Invoke(this, &DashAclOrchTest::SetEniAttribute));
+        m_dashAclOrch->doTask(*m_dashAclOrch->m_refresh_timer);
+        EXPECT_FALSE(m_dashAclOrch->m_refresh_timer_armed);
+
+        EXPECT_EQ(groupMgr.m_dirty_groups.count("group1"), 0u);
+        EXPECT_TRUE(group.m_pending_rules.empty());
+        EXPECT_NE(group.m_dash_acl_group_id, oldGroupOid);
+        EXPECT_EQ(group.m_dash_acl_rule_table.size(), 2u);
+        ASSERT_EQ(group.m_dash_acl_rule_table.count("rule2"), 1u);
+        EXPECT_NE(group.m_dash_acl_rule_table["rule2"].m_dash_acl_rule_id, SAI_NULL_OBJECT_ID);
+        for (const auto &binding : m_eniBindings)
+        {
+            EXPECT_EQ(binding.second, group.m_dash_acl_group_id);
+        }
+        EXPECT_NE(std::find(m_removedOids.begin(), m_removedOids.end(), oldGroupOid), m_removedOids.end());
+
+        EXPECT_CALL(*mock_sai_dash_eni_api, set_eni_attribute).Times(2)
+            .WillRepeatedly(Invoke(this, &DashAclOrchTest::SetEniAttribute));
+        m_dashAclOrch->doTask(*consumer);
+        EXPECT_TRUE(consumer->m_toSync.empty());
+        EXPECT_EQ(GetResult(APP_DASH_ACL_RULE_TABLE_NAME, "group1:rule2"), std::to_string(DASH_RESULT_SUCCESS));
+    }
+
+    TEST_F(DashAclOrchTest, ShadowSwapFailureDropsPendingRules)
+    {
+        auto &groupMgr = m_dashAclOrch->m_group_mgr;
+        AddEni("eni1", 0x2001);
+
+        auto groupConsumer = MakeConsumer(APP_DASH_ACL_GROUP_TABLE_NAME);
+        AddToSync(*groupConsumer, "group1", BuildAclGroup());
+        m_dashAclOrch->doTask(*groupConsumer);
+        auto consumer = MakeConsumer(APP_DASH_ACL_RULE_TABLE_NAME);
+        AddToSync(*consumer, "group1:rule1", BuildAclRule(1));
+        m_dashAclOrch->doTask(*consumer);
+        ASSERT_TRUE(consumer->m_toSync.empty());
+
+        ASSERT_EQ(groupMgr.bind("group1", "eni1", DashAclDirection::IN, DashAclStage::STAGE1), task_success);
+        auto &group = groupMgr.m_groups_table["group1"];
+        sai_object_id_t oldGroupOid = group.m_dash_acl_group_id;
+
+        // Another attempt won't help: the change is dropped instead of being retried
+        EXPECT_CALL(*mock_sai_dash_eni_api, set_eni_attribute).WillOnce(Return(SAI_STATUS_FAILURE));
+        AddToSync(*consumer, "group1:rule2", BuildAclRule(2));
+        m_dashAclOrch->doTask(*consumer);
+
+        EXPECT_EQ(group.m_dash_acl_group_id, oldGroupOid);
+        EXPECT_EQ(group.m_dash_acl_rule_table.size(), 1u);
+        EXPECT_TRUE(group.m_pending_rules.empty());
+        EXPECT_EQ(groupMgr.m_dirty_groups.count("group1"), 0u);
+        EXPECT_TRUE(groupMgr.m_failed_rules.empty());
+        EXPECT_FALSE(m_dashAclOrch->m_refresh_timer_armed);
+        EXPECT_TRUE(consumer->m_toSync.empty());
+        EXPECT_EQ(GetResult(APP_DASH_ACL_RULE_TABLE_NAME, "group1:rule2"), std::to_string(DASH_RESULT_FAILURE));
+    }
+}
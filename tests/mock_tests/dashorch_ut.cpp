@@ -60,6 +60,7 @@ namespace dashorch_test
     using ::testing::DoAll;
     using ::testing::Return;
     using ::testing::SetArgPointee;
+    using ::testing::SetArrayArgument;
     using ::testing::SaveArg;
     using ::testing::SaveArgPointee;
     using ::testing::Invoke;
@@ -222,13 +223,13 @@ namespace dashorch_test
 
         dash::eni::Eni eni = BuildEniEntry();
         
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(3)
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(3)
             .WillRepeatedly(
                 DoAll(
-                    [&actual_attrs](sai_object_id_t *eni_id, sai_object_id_t switch_id, uint32_t attr_count, const sai_attribute_t *attr_list) {
-                        actual_attrs.assign(attr_list, attr_list + attr_count);
+                    [&actual_attrs](sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count, const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id, sai_status_t *object_statuses) {
+                        actual_attrs.assign(attr_list[0], attr_list[0] + attr_count[0]);
                     },
-                    Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_eni) // Call the original function
+                    Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_enis) // Call the original function
                 )
             );
 
@@ -251,7 +252,7 @@ namespace dashorch_test
     {
         CreateApplianceEntry();
         CreateVnet();
-        EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni).Times(0);
+        EXPECT_CALL(*mock_sai_dash_eni_api, remove_enis).Times(0);
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, dash::eni::Eni(), false, true);
     }
 
@@ -531,7 +532,7 @@ namespace dashorch_test
 
         {
             InSequence seq;
-            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1);
+            EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1);
             EXPECT_CALL(*mock_sai_dash_trusted_vni_api, create_eni_trusted_vni_entry)
                 .WillOnce(Return(SAI_STATUS_FAILURE));
 
@@ -549,11 +550,11 @@ namespace dashorch_test
 
         dash::eni::Eni eni = BuildEniEntry();
         eni.mutable_trusted_vnis_list()->Add()->set_value(200);
-        EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni).Times(0);
+        EXPECT_CALL(*mock_sai_dash_eni_api, remove_enis).Times(0);
 
         {
             InSequence seq;
-            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1);
+            EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1);
 
             EXPECT_CALL(*mock_sai_dash_trusted_vni_api, create_eni_trusted_vni_entry)
                 .Times(1);
@@ -733,12 +734,12 @@ namespace dashorch_test
         m_mock_dash_ha_orch->setHaRoleForEni(dash::types::HA_ROLE_STANDBY);
 
         std::vector<sai_attribute_t> actual_attrs;
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1).WillOnce(
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1).WillOnce(
             DoAll(
-                [&actual_attrs](sai_object_id_t *eni_id, sai_object_id_t switch_id, uint32_t attr_count, const sai_attribute_t *attr_list) {
-                    actual_attrs.assign(attr_list, attr_list + attr_count);
+                [&actual_attrs](sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count, const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id, sai_status_t *object_statuses) {
+                    actual_attrs.assign(attr_list[0], attr_list[0] + attr_count[0]);
                 },
-                Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_eni)));
+                Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_enis)));
 
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, BuildEniEntry());
         VerifyHaFlowOwner(actual_attrs, false);
@@ -756,12 +757,12 @@ namespace dashorch_test
         m_mock_dash_ha_orch->setHaRoleForEni(dash::types::HA_ROLE_SWITCHING_TO_ACTIVE);
 
         std::vector<sai_attribute_t> actual_attrs;
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1).WillOnce(
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1).WillOnce(
             DoAll(
-                [&actual_attrs](sai_object_id_t *eni_id, sai_object_id_t switch_id, uint32_t attr_count, const sai_attribute_t *attr_list) {
-                    actual_attrs.assign(attr_list, attr_list + attr_count);
+                [&actual_attrs](sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count, const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id, sai_status_t *object_statuses) {
+                    actual_attrs.assign(attr_list[0], attr_list[0] + attr_count[0]);
                 },
-                Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_eni)));
+                Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_enis)));
 
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, BuildEniEntry());
         VerifyHaFlowOwner(actual_attrs, false);
@@ -784,12 +785,12 @@ namespace dashorch_test
         CreateVnet();
 
         std::vector<sai_attribute_t> actual_attrs;
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1).WillOnce(
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1).WillOnce(
             DoAll(
-                [&actual_attrs](sai_object_id_t *eni_id, sai_object_id_t switch_id, uint32_t attr_count, const sai_attribute_t *attr_list) {
-                    actual_attrs.assign(attr_list, attr_list + attr_count);
+                [&actual_attrs](sai_object_id_t switch_id, uint32_t object_count, const uint32_t *attr_count, const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id, sai_status_t *object_statuses) {
+                    actual_attrs.assign(attr_list[0], attr_list[0] + attr_count[0]);
                 },
-                Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_eni)));
+                Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_enis)));
 
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, BuildEniEntry());
         VerifyNoAttribute(actual_attrs, SAI_ENI_ATTR_IS_HA_FLOW_OWNER);
@@ -801,7 +802,7 @@ namespace dashorch_test
         // Build ENI referencing a VNET that doesn't exist
         dash::eni::Eni eni = BuildEniEntry();
         eni.set_vnet("NON_EXISTENT_VNET");
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(0);
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(0);
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, eni, true, true);
     }
 
@@ -809,7 +810,7 @@ namespace dashorch_test
     {
         // Do NOT create appliance — ENI requires appliance to exist
         CreateVnet();
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(0);
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(0);
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, BuildEniEntry(), true, true);
     }
 
@@ -817,7 +818,7 @@ namespace dashorch_test
     {
         CreateApplianceEntry();
         CreateVnet();
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni)
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis)
             .WillOnce(Return(SAI_STATUS_INSUFFICIENT_RESOURCES));
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, BuildEniEntry(), true, true);
     }
@@ -877,12 +878,12 @@ namespace dashorch_test
         {
             InSequence seq;
             // First attempt: ENI created, VNI fails, ENI removed
-            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1);
+            EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1);
             EXPECT_CALL(*mock_sai_dash_trusted_vni_api, create_eni_trusted_vni_entry)
                 .WillOnce(Return(SAI_STATUS_FAILURE));
             EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni).Times(1);
             // Second attempt: all SAI calls re-issued (cache was cleared)
-            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1);
+            EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1);
             EXPECT_CALL(*mock_sai_dash_trusted_vni_api, create_eni_trusted_vni_entry).Times(1);
         }
 
@@ -923,13 +924,16 @@ namespace dashorch_test
         auto eni = BuildEniEntry();
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, eni);
 
+        std::vector<sai_status_t> in_use_status = { SAI_STATUS_OBJECT_IN_USE };
         {
             InSequence seq;
             // First remove attempt: remove_eni fails
-            EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni)
-                .WillOnce(Return(SAI_STATUS_OBJECT_IN_USE));
+            EXPECT_CALL(*mock_sai_dash_eni_api, remove_enis)
+                .WillOnce(DoAll(
+                    SetArrayArgument<3>(in_use_status.begin(), in_use_status.end()),
+                    Return(SAI_STATUS_OBJECT_IN_USE)));
             // Second remove attempt: remove_eni succeeds (cache was preserved)
-            EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni).Times(1);
+            EXPECT_CALL(*mock_sai_dash_eni_api, remove_enis).Times(1);
         }
 
         // First attempt — SAI failure, consumer still emptied but cache preserved
@@ -998,7 +1002,7 @@ namespace dashorch_test
     {
         CreateApplianceEntry();
         CreateVnet();
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(0);
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(0);
         SetDashTableRaw(APP_DASH_ENI_TABLE_NAME, eni1, {}, true, true);
     }
 
@@ -1025,10 +1029,10 @@ namespace dashorch_test
         // Cycle ENI create/delete multiple times
         for (int i = 0; i < 3; i++)
         {
-            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1);
+            EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1);
             SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, eni);
 
-            EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni).Times(1);
+            EXPECT_CALL(*mock_sai_dash_eni_api, remove_enis).Times(1);
             SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, dash::eni::Eni(), false, true);
         }
     }
@@ -1042,10 +1046,10 @@ namespace dashorch_test
         {
             InSequence seq;
             // First create fails
-            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni)
+            EXPECT_CALL(*mock_sai_dash_eni_api, create_enis)
                 .WillOnce(Return(SAI_STATUS_INSUFFICIENT_RESOURCES));
             // Second create succeeds
-            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1);
+            EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1);
         }
 
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, eni, true, true);
@@ -1060,16 +1064,72 @@ namespace dashorch_test
         std::string eni2 = "ENI_2";
 
         // Create two different ENIs
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(2);
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(2);
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, eni);
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni2, eni);
 
         // Delete both
-        EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni).Times(2);
+        EXPECT_CALL(*mock_sai_dash_eni_api, remove_enis).Times(2);
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, dash::eni::Eni(), false, true);
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni2, dash::eni::Eni(), false, true);
     }
 
+    TEST_F(DashOrchTest, EniBatchIsBulked)
+    {
+        CreateApplianceEntry();
+        CreateVnet();
+        const uint32_t eni_count = 4;
+
+        std::deque<swss::KeyOpFieldsValuesTuple> to_create, to_remove;
+        for (uint32_t i = 0; i < eni_count; i++)
+        {
+            auto eni = BuildEniEntry();
+            std::string mac = eni.mac_address();
+            mac[0] = static_cast<char>('a' + i);
+            eni.set_mac_address(mac);
+            std::string key = "ENI_BULK_" + std::to_string(i);
+            to_create.emplace_back(key, SET_COMMAND, std::vector<swss::FieldValueTuple>{{"pb", eni.SerializeAsString()}});
+            to_remove.emplace_back(key, DEL_COMMAND, std::vector<swss::FieldValueTuple>{});
+        }
+
+        auto consumer = make_unique<Consumer>(
+            new swss::ConsumerStateTable(m_app_db.get(), APP_DASH_ENI_TABLE_NAME),
+            m_DashOrch, APP_DASH_ENI_TABLE_NAME);
+
+        uint32_t created = 0, mapped = 0;
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis)
+            .WillOnce(DoAll(SaveArg<1>(&created),
+                            Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_enis)));
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni_ether_address_map_entries)
+            .WillOnce(DoAll(SaveArg<0>(&mapped),
+                            Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::create_eni_ether_address_map_entries)));
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(0);
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni_ether_address_map_entry).Times(0);
+
+        consumer->addToSync(to_create);
+        m_DashOrch->doTask(*consumer);
+        EXPECT_EQ(consumer->m_toSync.size(), 0);
+        EXPECT_EQ(created, eni_count);
+        EXPECT_EQ(mapped, eni_count);
+        EXPECT_EQ(m_DashOrch->eni_entries_.size(), eni_count);
+
+        uint32_t removed = 0, unmapped = 0;
+        EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni_ether_address_map_entries)
+            .WillOnce(DoAll(SaveArg<0>(&unmapped),
+                            Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::remove_eni_ether_address_map_entries)));
+        EXPECT_CALL(*mock_sai_dash_eni_api, remove_enis)
+            .WillOnce(DoAll(SaveArg<0>(&removed),
+                            Invoke(old_sai_dash_eni_api, &sai_dash_eni_api_t::remove_enis)));
+        EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni).Times(0);
+
+        consumer->addToSync(to_remove);
+        m_DashOrch->doTask(*consumer);
+        EXPECT_EQ(consumer->m_toSync.size(), 0);
+        EXPECT_EQ(removed, eni_count);
+        EXPECT_EQ(unmapped, eni_count);
+        EXPECT_TRUE(m_DashOrch->eni_entries_.empty());
+    }
+
     TEST_F(DashOrchTest, EniRouteBindUnbindChurn)
     {
         CreateApplianceEntry();
@@ -1234,7 +1294,7 @@ namespace dashorch_test
         auto eni = BuildEniEntry();
         eni.set_v6_meter_policy_id("MISSING_V6_POLICY");
 
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(0);
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(0);
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, eni, true, true);
         EXPECT_TRUE(m_DashOrch->eni_entries_.empty());
     }
@@ -1245,11 +1305,14 @@ namespace dashorch_test
         CreateVnet();
         auto eni = BuildEniEntry();
 
+        std::vector<sai_status_t> failure_status = { SAI_STATUS_FAILURE };
         {
             InSequence seq;
-            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni).Times(1);
-            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni_ether_address_map_entry)
-                .WillOnce(Return(SAI_STATUS_FAILURE));
+            EXPECT_CALL(*mock_sai_dash_eni_api, create_enis).Times(1);
+            EXPECT_CALL(*mock_sai_dash_eni_api, create_eni_ether_address_map_entries)
+                .WillOnce(DoAll(
+                    SetArrayArgument<5>(failure_status.begin(), failure_status.end()),
+                    Return(SAI_STATUS_FAILURE)));
             EXPECT_CALL(*mock_sai_dash_eni_api, remove_eni).Times(1);
         }
 
@@ -1468,7 +1531,7 @@ namespace dashorch_test
         CreateVnet();
         auto eni = BuildEniEntry();
 
-        EXPECT_CALL(*mock_sai_dash_eni_api, create_eni)
+        EXPECT_CALL(*mock_sai_dash_eni_api, create_enis)
             .WillOnce(Throw(std::runtime_error("simulated SAI exception")));
 
         SetDashTable(APP_DASH_ENI_TABLE_NAME, eni1, eni, true, true);
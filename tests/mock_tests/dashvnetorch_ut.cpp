@@ -16,6 +16,7 @@
 #include "dash_api/eni_route.pb.h"
 #include "gtest/gtest.h"
 #include "crmorch.h"
+#include "taskstats.h"
 #include "table.h"
 
 #include <deque>
@@ -447,6 +448,26 @@ namespace dashvnetorch_test
         EXPECT_FALSE(DashResultExists(APP_DASH_VNET_MAPPING_TABLE_NAME, key));
     }
 
+    TEST_F(DashVnetOrchTest, VnetMapParseTimeRecorded)
+    {
+        auto &parse_stat = getOrchOpStats()[std::string(APP_DASH_VNET_MAPPING_TABLE_NAME) + ":pb_parse"];
+        auto parsed = parse_stat.count;
+        // Use a unique key to avoid collision with result entries left by prior tests
+        std::string key = vnet1 + ":8.8.8.8";
+
+        AddVnetEncapRoutingType(dash::route_type::ENCAP_TYPE_VXLAN);
+        CreateVnet();
+        AddVnetMap();
+        EXPECT_EQ(parse_stat.count, parsed + 1);
+
+        // Undecodable messages are timed as well
+        EXPECT_CALL(*mock_sai_dash_outbound_ca_to_pa_api, create_outbound_ca_to_pa_entries).Times(0);
+        ProcessDashTupleRaw(APP_DASH_VNET_MAPPING_TABLE_NAME, key, SET_COMMAND,
+                            {{"pb", std::string("\xff\xff\xff")}});
+        EXPECT_EQ(parse_stat.count, parsed + 2);
+        EXPECT_TRUE(DashResultExists(APP_DASH_VNET_MAPPING_TABLE_NAME, key));
+    }
+
     TEST_F(DashVnetOrchTest, VnetMapDuplicateFailedAddClearsBulkContext)
     {
         dash::vnet_mapping::VnetMapping vnet_map;
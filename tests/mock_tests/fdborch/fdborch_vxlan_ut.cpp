@@ -3636,7 +3636,7 @@ namespace fdborch_vxlan_ut
         FdbEntry entry;
         entry.mac = mac;
         entry.bv_id = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
-        gFdbOrch->m_entries[entry] = fdbData;
+        gFdbOrch->setFdbEntry(entry, fdbData);
 
         auto oldFdbCount_eth0 = m_portsOrch->m_portList[ETH0].m_fdb_count;
         auto oldFdbCount_vlan = m_portsOrch->m_portList[VLAN40].m_fdb_count;
@@ -3684,7 +3684,7 @@ namespace fdborch_vxlan_ut
         FdbEntry entry;
         entry.mac = mac;
         entry.bv_id = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
-        gFdbOrch->m_entries[entry] = fdbData;
+        gFdbOrch->setFdbEntry(entry, fdbData);
 
         // Send MOVE event with DIFFERENT bridge port -
         vector<uint8_t> mac_addr = {0x00, 0xaa, 0xbb, 0xcc, 0xdd, 0xee};
@@ -3717,7 +3717,7 @@ namespace fdborch_vxlan_ut
         FdbEntry entry;
         entry.mac = mac;
         entry.bv_id = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
-        gFdbOrch->m_entries[entry] = fdbData;
+        gFdbOrch->setFdbEntry(entry, fdbData);
 
         // Send LEARN event with SAME bridge port to hit "else" branch (lines 414-464)
         // This tests the case where MAC is learned locally on same port that was MCLAG remote
@@ -3799,7 +3799,7 @@ namespace fdborch_vxlan_ut
         FdbEntry entry;
         entry.mac = mac;
         entry.bv_id = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
-        gFdbOrch->m_entries[entry] = fdbData;
+        gFdbOrch->setFdbEntry(entry, fdbData);
 
         // Delete the entry - should hit MCLAG deletion at lines 167-171
         bool result = gFdbOrch->removeFdbEntry(entry, FDB_ORIGIN_MCLAG_ADVERTIZED);
@@ -3830,7 +3830,7 @@ namespace fdborch_vxlan_ut
         FdbEntry entry;
         entry.mac = mac;
         entry.bv_id = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
-        gFdbOrch->m_entries[entry] = fdbData;
+        gFdbOrch->setFdbEntry(entry, fdbData);
 
         // Send AGED event with DIFFERENT bridge_port_id (stale aging)
         // This hits lines 560-566 where bridge_port_id != existing bridge_port_id
@@ -3929,7 +3929,7 @@ namespace fdborch_vxlan_ut
         FdbEntry entry;
         entry.mac = mac;
         entry.bv_id = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
-        gFdbOrch->m_entries[entry] = fdbData;
+        gFdbOrch->setFdbEntry(entry, fdbData);
 
         // Send MOVE event to local port Ethernet0
         vector<uint8_t> mac_addr = {0x00, 0x02, 0x03, 0x04, 0x05, 0x06};
@@ -3963,7 +3963,7 @@ namespace fdborch_vxlan_ut
         FdbEntry entry;
         entry.mac = mac;
         entry.bv_id = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
-        gFdbOrch->m_entries[entry] = fdbData;
+        gFdbOrch->setFdbEntry(entry, fdbData);
 
         // Send AGED event - should readd as static with allow_mac_move
         // Port is NOT in VLAN members, so code reaches aging readd block
@@ -811,4 +811,137 @@ namespace fdb_syncd_flush_test
         EXPECT_EQ(m_fdborch->m_entries.find(fdb_entry), m_fdborch->m_entries.end())
             << "DYNAMIC entry survived: event[1] inherited STATIC type (type bleed regression)";
     }
-}
\ No newline at end of file
+
+    /* Test the bridge port index follows a MAC move and bounds a port flush */
+    TEST_F(FdbOrchTest, ConsolidatedFlushPortAfterMacMove)
+    {
+        ASSERT_NE(m_portsOrch, nullptr);
+        setUpVlan(m_portsOrch.get());
+        setUpPort(m_portsOrch.get());
+        setUpVlanMember(m_portsOrch.get());
+
+        /* Add Ethernet4 into Vlan40 */
+        std::string eth4 = "Ethernet4";
+        Port eth4_port(eth4, Port::PHY);
+        eth4_port.m_index = 2;
+        eth4_port.m_port_id = 0x10000000004a8;
+        eth4_port.m_bridge_port_id = 0x3a000000002c35;
+        m_portsOrch->m_portList[eth4] = eth4_port;
+        m_portsOrch->saiOidToAlias[eth4_port.m_port_id] = eth4;
+        m_portsOrch->saiOidToAlias[eth4_port.m_bridge_port_id] = eth4;
+        m_portsOrch->m_portList[VLAN40].m_members.insert(eth4);
+
+        auto eth0_bridge_port = m_portsOrch->m_portList[ETH0].m_bridge_port_id;
+        auto eth4_bridge_port = eth4_port.m_bridge_port_id;
+        auto vlan_oid = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
+
+        /* Learn 7c:fe:90:12:22:ec on Ethernet0 and 7c:fe:90:12:22:ed on Ethernet4 */
+        vector<uint8_t> mac_addr1 = {124, 254, 144, 18, 34, 236};
+        vector<uint8_t> mac_addr2 = {124, 254, 144, 18, 34, 237};
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_LEARNED, mac_addr1, eth0_bridge_port, vlan_oid);
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_LEARNED, mac_addr2, eth4_bridge_port, vlan_oid);
+        ASSERT_EQ(m_fdborch->getFdbEntries(eth0_bridge_port, SAI_NULL_OBJECT_ID).size(), 1);
+        ASSERT_EQ(m_fdborch->getFdbEntries(eth4_bridge_port, SAI_NULL_OBJECT_ID).size(), 1);
+        ASSERT_EQ(m_fdborch->getFdbEntries(SAI_NULL_OBJECT_ID, vlan_oid).size(), 2);
+
+        /* Move the first MAC to Ethernet4 */
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_MOVE, mac_addr1, eth4_bridge_port, vlan_oid);
+        ASSERT_EQ(m_fdborch->getFdbEntries(eth0_bridge_port, SAI_NULL_OBJECT_ID).size(), 0);
+        ASSERT_EQ(m_fdborch->getFdbEntries(eth4_bridge_port, SAI_NULL_OBJECT_ID).size(), 2);
+
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        {
+            it->second.is_flush_pending = true;
+        }
+
+        /* A flush on Ethernet0 no longer matches any entry */
+        vector<uint8_t> flush_mac_addr = {0, 0, 0, 0, 0, 0};
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_FLUSHED, flush_mac_addr, eth0_bridge_port, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(m_fdborch->m_entries.size(), 2);
+
+        /* A flush on Ethernet4 clears both entries and the indexes */
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_FLUSHED, flush_mac_addr, eth4_bridge_port, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(m_fdborch->m_entries.size(), 0);
+        ASSERT_TRUE(m_fdborch->m_entries_by_bridge_port.empty());
+        ASSERT_TRUE(m_fdborch->m_entries_by_bv_id.empty());
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, 0);
+    }
+
+    /* Test a repeated LEARN is only redundant on the same port and within the window */
+    TEST_F(FdbOrchTest, RedundantLearnWithinWindow)
+    {
+        ASSERT_NE(m_portsOrch, nullptr);
+        setUpVlan(m_portsOrch.get());
+        setUpPort(m_portsOrch.get());
+        setUpVlanMember(m_portsOrch.get());
+
+        auto bridge_port = m_portsOrch->m_portList[ETH0].m_bridge_port_id;
+        auto vlan_oid = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
+
+        // 7c:fe:90:12:22:ec
+        vector<uint8_t> mac_addr = {124, 254, 144, 18, 34, 236};
+        sai_fdb_entry_t entry;
+        for (int i = 0; i < (int)mac_addr.size(); i++)
+        {
+            *(entry.mac_address+i) = mac_addr[i];
+        }
+        entry.bv_id = vlan_oid;
+
+        /* Nothing learnt yet */
+        ASSERT_FALSE(m_fdborch->isRedundantLearn(entry, bridge_port));
+
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_LEARNED, mac_addr, bridge_port, vlan_oid);
+        auto it = m_fdborch->m_entries.begin();
+        ASSERT_NE(it, m_fdborch->m_entries.end());
+        it->second.last_learn = std::chrono::steady_clock::now();
+
+        ASSERT_TRUE(m_fdborch->isRedundantLearn(entry, bridge_port));
+        ASSERT_FALSE(m_fdborch->isRedundantLearn(entry, 0x3a000000002c99));
+
+        /* Outside of the window the LEARN is processed again */
+        it->second.last_learn -= std::chrono::milliseconds(FDB_RELEARN_WINDOW_MS);
+        ASSERT_FALSE(m_fdborch->isRedundantLearn(entry, bridge_port));
+    }
+
+    /* Warm restore bake() refills FDB from the STATE_DB table read ahead */
+    TEST_F(FdbOrchTest, BakeRefillsStateTableFromReadAhead)
+    {
+        const std::string key = "Vlan40:7c:fe:90:12:22:ec";
+        Table stateFdbTable(m_state_db.get(), STATE_FDB_TABLE_NAME);
+        stateFdbTable.set(key, { { "port", ETH0 }, { "type", "dynamic" } });
+
+        /* HGETALL of the key returns its fields */
+        mockReply = (redisReply *)calloc(1, sizeof(redisReply));
+        mockReply->type = REDIS_REPLY_ARRAY;
+        mockReply->elements = 2;
+        mockReply->element = (redisReply **)calloc(mockReply->elements, sizeof(redisReply *));
+        std::vector<std::string> fields = { "port", ETH0 };
+        for (size_t i = 0; i < fields.size(); i++)
+        {
+            mockReply->element[i] = (redisReply *)calloc(1, sizeof(redisReply));
+            mockReply->element[i]->type = REDIS_REPLY_STRING;
+            mockReply->element[i]->str = (char *)calloc(1, fields[i].length() + 1);
+            memcpy(mockReply->element[i]->str, fields[i].c_str(), fields[i].length());
+            mockReply->element[i]->len = (int)fields[i].length();
+        }
+
+        /* Read ahead the way OrchDaemon::prefetchWarmRestoreData() does */
+        std::vector<ConsumerBase *> consumers;
+        m_fdborch->getConsumers(consumers);
+        auto consumer = dynamic_cast<Consumer *>(m_fdborch->getExecutor(APP_FDB_TABLE_NAME));
+        ASSERT_NE(consumer, nullptr);
+        ASSERT_NE(std::find(consumers.begin(), consumers.end(), consumer), consumers.end());
+        ASSERT_EQ(consumer->getRefillTables().size(), 1u);
+        ASSERT_EQ(consumer->prefetchExistingData(consumer->getRefillTables()[0].first, m_state_db.get()), 1u);
+        mockReply = nullptr;
+
+        /* The table is not read again by bake() */
+        stateFdbTable.del(key);
+        ASSERT_TRUE(m_fdborch->bake());
+
+        ASSERT_EQ(consumer->m_toSync.size(), 1u);
+        auto &entry = consumer->m_toSync.begin()->second;
+        ASSERT_EQ(kfvKey(entry), key);
+        ASSERT_EQ(kfvFieldsValues(entry), std::vector<FieldValueTuple>({ { "port", ETH0 } }));
+    }
+}
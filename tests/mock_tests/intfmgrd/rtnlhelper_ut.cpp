@@ -0,0 +1,200 @@
+#include "gtest/gtest.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <set>
+#include <netlink/netlink.h>
+#include <netlink/msg.h>
+#include <netlink/errno.h>
+#include <linux/rtnetlink.h>
+#include "rtnlhelper.h"
+
+extern int (*callback)(const std::string &cmd, std::string &stdout);
+extern std::vector<std::string> mockCallArgs;
+extern int mockCmdReturn;
+
+/* Types of the requests sent to the kernel */
+static std::vector<int> sentRequests;
+/* Number of requests sent when each ACK was collected */
+static std::vector<size_t> sentAtAck;
+/* Index of the sent request the kernel rejects, -1 if none */
+static int rejectedRequest = -1;
+/* Interfaces if_nametoindex() doesn't find */
+static std::set<std::string> missingDevices;
+/* Missing interfaces created by the first request */
+static std::set<std::string> createdDevices;
+
+/*
+ * Wrap the netlink socket and interface lookups, so that the requests are
+ * recorded instead of being sent to the kernel.
+ */
+extern "C" {
+
+struct nl_sock *__wrap_nl_socket_alloc(void)
+{
+    static char fake_sock_mem[256];
+    return reinterpret_cast<struct nl_sock *>(fake_sock_mem);
+}
+
+void __wrap_nl_socket_free(struct nl_sock *sk)
+{
+}
+
+int __wrap_nl_connect(struct nl_sock *sk, int protocol)
+{
+    return 0;
+}
+
+void __wrap_nl_close(struct nl_sock *sk)
+{
+}
+
+int __wrap_nl_send_auto(struct nl_sock *sk, struct nl_msg *msg)
+{
+    sentRequests.push_back(nlmsg_hdr(msg)->nlmsg_type);
+    return 0;
+}
+
+int __wrap_nl_wait_for_ack(struct nl_sock *sk)
+{
+    int acked = static_cast<int>(sentAtAck.size());
+
+    sentAtAck.push_back(sentRequests.size());
+    if (acked == 0)
+    {
+        for (const auto &device : createdDevices)
+        {
+            missingDevices.erase(device);
+        }
+    }
+    return (acked == rejectedRequest) ? -NLE_EXIST : 0;
+}
+
+unsigned int __wrap_if_nametoindex(const char *ifname)
+{
+    return missingDevices.count(ifname) ? 0 : 1;
+}
+
+}
+
+namespace rtnlhelper_ut
+{
+    struct RtnlHelperTest : public ::testing::Test
+    {
+        virtual void SetUp() override
+        {
+            callback = nullptr;
+            mockCallArgs.clear();
+            mockCmdReturn = 0;
+            sentRequests.clear();
+            sentAtAck.clear();
+            rejectedRequest = -1;
+            missingDevices.clear();
+            createdDevices.clear();
+            setenv(RTNL_HELPER_ENABLE_ENV, "1", 1);
+        }
+
+        virtual void TearDown() override
+        {
+            unsetenv(RTNL_HELPER_ENABLE_ENV);
+            mockCmdReturn = 0;
+        }
+
+        void queueVlanMember(swss::RtnlHelper &rtnl, const std::string &port)
+        {
+            rtnl.linkSetMaster(port, "Bridge");
+            rtnl.bridgeVlanDel(port, 1);
+            rtnl.bridgeVlanAdd(port, 100, true);
+        }
+    };
+
+    TEST_F(RtnlHelperTest, CommitSendsRequestsInOrder)
+    {
+        swss::RtnlHelper rtnl;
+        std::string err;
+
+        ASSERT_TRUE(rtnl.isEnabled());
+        queueVlanMember(rtnl, "Ethernet0");
+        ASSERT_EQ(rtnl.exec("/sbin/ip link set Ethernet0 master Bridge && ...", err), 0);
+        ASSERT_EQ(sentRequests, std::vector<int>({ RTM_NEWLINK, RTM_DELLINK, RTM_SETLINK }));
+        // The requests are all sent before their ACKs are collected
+        ASSERT_EQ(sentAtAck, std::vector<size_t>({ 3, 3, 3 }));
+        ASSERT_TRUE(err.empty());
+        ASSERT_TRUE(mockCallArgs.empty());
+    }
+
+    TEST_F(RtnlHelperTest, CommitReportsRejectedRequest)
+    {
+        swss::RtnlHelper rtnl;
+        std::string err;
+
+        // The requests in flight are all acked, the first failure is reported
+        rejectedRequest = 1;
+        queueVlanMember(rtnl, "Ethernet0");
+        ASSERT_EQ(rtnl.commit(err), NLE_EXIST);
+        ASSERT_EQ(sentRequests, std::vector<int>({ RTM_NEWLINK, RTM_DELLINK, RTM_SETLINK }));
+        ASSERT_EQ(sentAtAck.size(), 3u);
+        ASSERT_EQ(err, std::string("bridge vlan del vid 1 dev Ethernet0: ") + nl_geterror(NLE_EXIST));
+
+        // The dropped requests are not sent by the next commit
+        sentRequests.clear();
+        rejectedRequest = -1;
+        ASSERT_EQ(rtnl.commit(err), 0);
+        ASSERT_TRUE(sentRequests.empty());
+    }
+
+    TEST_F(RtnlHelperTest, CommitStopsAtMissingDevice)
+    {
+        swss::RtnlHelper rtnl;
+        std::string err;
+
+        missingDevices.insert("Bridge");
+        queueVlanMember(rtnl, "Ethernet0");
+        ASSERT_EQ(rtnl.commit(err), ENODEV);
+        ASSERT_TRUE(sentRequests.empty());
+        ASSERT_EQ(err, "link set Ethernet0 master Bridge: cannot find device");
+    }
+
+    TEST_F(RtnlHelperTest, CommitWaitsForCreatedDevice)
+    {
+        swss::RtnlHelper rtnl;
+        std::string err;
+
+        // The bridge only exists once the request creating it is acked
+        missingDevices.insert("Bridge");
+        createdDevices.insert("Bridge");
+        rtnl.linkAddBridge("Bridge");
+        queueVlanMember(rtnl, "Ethernet0");
+        ASSERT_EQ(rtnl.commit(err), 0);
+        ASSERT_EQ(sentRequests, std::vector<int>({ RTM_NEWLINK, RTM_NEWLINK, RTM_DELLINK, RTM_SETLINK }));
+        ASSERT_EQ(sentAtAck, std::vector<size_t>({ 1, 4, 4, 4 }));
+    }
+
+    TEST_F(RtnlHelperTest, CommitStopsAtMissingDeviceAfterFailure)
+    {
+        swss::RtnlHelper rtnl;
+        std::string err;
+
+        // The bridge is not created: the requests using it are not sent
+        missingDevices.insert("Bridge");
+        rejectedRequest = 0;
+        rtnl.linkAddBridge("Bridge");
+        queueVlanMember(rtnl, "Ethernet0");
+        ASSERT_EQ(rtnl.commit(err), NLE_EXIST);
+        ASSERT_EQ(sentRequests, std::vector<int>({ RTM_NEWLINK }));
+        ASSERT_EQ(err, std::string("link add Bridge type bridge: ") + nl_geterror(NLE_EXIST));
+    }
+
+    TEST_F(RtnlHelperTest, DisabledRunsShellCommand)
+    {
+        unsetenv(RTNL_HELPER_ENABLE_ENV);
+        swss::RtnlHelper rtnl;
+        std::string res;
+
+        ASSERT_FALSE(rtnl.isEnabled());
+        queueVlanMember(rtnl, "Ethernet0");
+        mockCmdReturn = 1;
+        ASSERT_EQ(rtnl.exec("/sbin/ip link set Ethernet0 master Bridge", res), 1);
+        ASSERT_EQ(mockCallArgs, std::vector<std::string>({ "/sbin/ip link set Ethernet0 master Bridge" }));
+        ASSERT_TRUE(sentRequests.empty());
+    }
+}
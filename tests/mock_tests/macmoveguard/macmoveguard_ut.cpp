@@ -804,6 +804,88 @@ namespace macmoveguard_test
         EXPECT_FALSE(tracked(MAC_A));   // GC'd
     }
 
+    // -------- tracking table cap: LRU eviction spares bad MACs -------------
+    TEST_F(MacMoveGuardTest, TrackedMacCapEvictsLeastRecentNonBadMac)
+    {
+        buildOrch();
+        configure({
+            {"enabled","true"}, {"threshold","2"}, {"detect_interval","60"},
+            {"action_interval","60"}, {"action","DISABLE_PORT"},
+            {"max_tracked_macs","2"}
+        });
+
+        const string MAC_C = "00:11:22:33:44:03";
+
+        // MAC_A goes bad and is the least recently used entry from here on.
+        injectMove(MAC_A, ETH0, ETH1);
+        injectMove(MAC_A, ETH1, ETH0);
+        ASSERT_TRUE(state(MAC_A).is_bad_mac);
+
+        injectMove(MAC_B, ETH1, ETH2);
+        ASSERT_TRUE(tracked(MAC_B));
+
+        // Table is full: MAC_C evicts MAC_B, the oldest entry that is not bad.
+        injectMove(MAC_C, ETH1, ETH2);
+        EXPECT_TRUE(tracked(MAC_A));
+        EXPECT_FALSE(tracked(MAC_B));
+        EXPECT_TRUE(tracked(MAC_C));
+        EXPECT_EQ(m_mmg->m_macTrackingState.size(), 2u);
+        EXPECT_EQ(m_mmg->m_macTrackingState.evictions(), 1u);
+        EXPECT_LE(m_mmg->m_learntMac.size(), 2u);
+
+        // Counters are published on the recovery tick.
+        m_mmg->checkRecovery();
+        Table counters(m_state_db.get(), STATE_MMG_COUNTERS_TABLE_NAME);
+        vector<FieldValueTuple> fvs;
+        ASSERT_TRUE(counters.get(MMG_COUNTERS_KEY, fvs));
+        map<string, string> kv;
+        for (auto &fv : fvs) kv[fvField(fv)] = fvValue(fv);
+        EXPECT_EQ(kv["tracked_macs"], "2");
+        EXPECT_EQ(kv["max_tracked_macs"], "2");
+        EXPECT_EQ(kv["evictions"], to_string(m_mmg->m_macTrackingState.evictions() +
+                                             m_mmg->m_learntMac.evictions()));
+    }
+
+    // -------- tracking table cap: lowering it evicts down to the new cap ---
+    TEST_F(MacMoveGuardTest, LoweringTrackedMacCapEvictsLeastRecentNonBadMacs)
+    {
+        buildOrch();
+        const vector<FieldValueTuple> config = {
+            {"enabled","true"}, {"threshold","2"}, {"detect_interval","60"},
+            {"action_interval","60"}, {"action","DISABLE_PORT"},
+            {"max_tracked_macs","10"}
+        };
+        configure(config);
+
+        const string MAC_C = "00:11:22:33:44:03";
+
+        injectMove(MAC_A, ETH0, ETH1);
+        injectMove(MAC_A, ETH1, ETH0);
+        ASSERT_TRUE(state(MAC_A).is_bad_mac);
+        injectMove(MAC_B, ETH1, ETH2);
+        injectMove(MAC_C, ETH1, ETH2);
+        ASSERT_EQ(m_mmg->m_macTrackingState.size(), 3u);
+
+        // MAC_B is the least recently used entry that is not bad.
+        auto lowered = config;
+        lowered.back() = {"max_tracked_macs", "2"};
+        configure(lowered);
+        EXPECT_TRUE(tracked(MAC_A));
+        EXPECT_FALSE(tracked(MAC_B));
+        EXPECT_TRUE(tracked(MAC_C));
+        EXPECT_EQ(m_mmg->m_macTrackingState.size(), 2u);
+        EXPECT_EQ(m_mmg->m_macTrackingState.evictions(), 1u);
+        EXPECT_LE(m_mmg->m_learntMac.size(), 2u);
+
+        // A bad MAC is kept even above the cap.
+        lowered.back() = {"max_tracked_macs", "1"};
+        configure(lowered);
+        EXPECT_TRUE(tracked(MAC_A));
+        EXPECT_FALSE(tracked(MAC_C));
+        EXPECT_EQ(m_mmg->m_macTrackingState.size(), 1u);
+        EXPECT_LE(m_mmg->m_learntMac.size(), 1u);
+    }
+
     // -------- 11.1 #12: config rejection -----------------------------------
     TEST_F(MacMoveGuardTest, ConfigRejectionHandling)
     {
@@ -38,6 +38,7 @@ namespace mux_rollback_test
     using ::testing::AtLeast;
 
     static const string TEST_INTERFACE = "Ethernet4";
+    static const string OTHER_INTERFACE = "Ethernet0";
 
     sai_bulk_create_neighbor_entry_fn old_create_neighbor_entries;
     sai_bulk_remove_neighbor_entry_fn old_remove_neighbor_entries;
@@ -51,6 +52,10 @@ namespace mux_rollback_test
     {
     protected:
         std::string m_neighbor_mode = "host-route";
+        // Mux ports with their server IP and neighbor MAC; the first one is m_MuxCable
+        std::vector<std::vector<std::string>> m_mux_ports = {
+            { TEST_INTERFACE, SERVER_IP1, "62:f9:65:10:2f:04" }
+        };
 
         void SetMuxStateFromAppDb(std::string state)
         {
@@ -85,21 +90,26 @@ namespace mux_rollback_test
             Table intf_table = Table(m_app_db.get(), APP_INTF_TABLE_NAME);
 
             auto ports = ut_helper::getInitialSaiPorts();
-            port_table.set(TEST_INTERFACE, ports[TEST_INTERFACE]);
-            port_table.set("PortConfigDone", { { "count", to_string(1) } });
+            for (const auto &mux_port : m_mux_ports)
+            {
+                port_table.set(mux_port[0], ports[mux_port[0]]);
+                neigh_table.set(
+                    VLAN_1000 + neigh_table.getTableNameSeparator() + mux_port[1], { { "neigh", mux_port[2] },
+                                                                                    { "family", "IPv4" } });
+                vlan_member_table.set(
+                    VLAN_1000 + vlan_member_table.getTableNameSeparator() + mux_port[0],
+                    { { "tagging_mode", "untagged" } });
+                mux_cable_table.set(mux_port[0], { { "server_ipv4", mux_port[1] + "/32" },
+                                                   { "server_ipv6", "a::a/128" },
+                                                   { "neighbor_mode", m_neighbor_mode },
+                                                   { "state", "auto" } });
+            }
+            port_table.set("PortConfigDone", { { "count", to_string(m_mux_ports.size()) } });
             port_table.set("PortInitDone", { {} });
 
-            neigh_table.set(
-                VLAN_1000 + neigh_table.getTableNameSeparator() + SERVER_IP1, { { "neigh", "62:f9:65:10:2f:04" },
-                                                                               { "family", "IPv4" } });
-
             vlan_table.set(VLAN_1000, { { "admin_status", "up" },
                                         { "mtu", "9100" },
                                         { "mac", "00:aa:bb:cc:dd:ee" } });
-            vlan_member_table.set(
-                VLAN_1000 + vlan_member_table.getTableNameSeparator() + TEST_INTERFACE,
-                { { "tagging_mode", "untagged" } });
-
             intf_table.set(VLAN_1000, { { "grat_arp", "enabled" },
                                         { "proxy_arp", "enabled" },
                                         { "mac_addr", "00:00:00:00:00:00" } });
@@ -122,11 +132,6 @@ namespace mux_rollback_test
 
             peer_switch_table.set(PEER_SWITCH_HOSTNAME, { { "address_ipv4", PEER_IPV4_ADDRESS } });
 
-            mux_cable_table.set(TEST_INTERFACE, { { "server_ipv4", SERVER_IP1 + "/32" },
-                                                  { "server_ipv6", "a::a/128" },
-                                                  { "neighbor_mode", m_neighbor_mode },
-                                                  { "state", "auto" } });
-
             gPortsOrch->addExistingData(&port_table);
             gPortsOrch->addExistingData(&vlan_table);
             gPortsOrch->addExistingData(&vlan_member_table);
@@ -168,6 +173,8 @@ namespace mux_rollback_test
             old_create_route_entries = m_MuxCable->nbr_handler_->gRouteBulker.create_entries;
             old_remove_route_entries = m_MuxCable->nbr_handler_->gRouteBulker.remove_entries;
             old_set_route_entries_attribute = m_MuxCable->nbr_handler_->gRouteBulker.set_entries_attribute;
+            m_MuxCableOrch->route_bulker_.create_entries = mock_create_route_entries;
+            m_MuxCableOrch->route_bulker_.remove_entries = mock_remove_route_entries;
             gNeighOrch->gNeighBulker.create_entries = mock_create_neighbor_entries;
             gNeighOrch->gNeighBulker.remove_entries = mock_remove_neighbor_entries;
             gNeighOrch->gNextHopBulker.create_entries = mock_create_next_hops;
@@ -191,6 +198,8 @@ namespace mux_rollback_test
             m_MuxCable->nbr_handler_->gRouteBulker.create_entries = old_create_route_entries;
             m_MuxCable->nbr_handler_->gRouteBulker.remove_entries = old_remove_route_entries;
             m_MuxCable->nbr_handler_->gRouteBulker.set_entries_attribute = old_set_route_entries_attribute;
+            m_MuxCableOrch->route_bulker_.create_entries = old_create_route_entries;
+            m_MuxCableOrch->route_bulker_.remove_entries = old_remove_route_entries;
         }
     };
 
@@ -203,6 +212,35 @@ namespace mux_rollback_test
         }
     };
 
+    class MuxBulkSwitchoverTest : public MuxRollbackTest
+    {
+    public:
+        MuxBulkSwitchoverTest()
+        {
+            m_mux_ports.push_back({ OTHER_INTERFACE, SERVER_IP2, "62:f9:65:10:2f:06" });
+        }
+
+    protected:
+        void SetMuxStatesFromAppDb(std::string state)
+        {
+            Table mux_cable_table = Table(m_app_db.get(), APP_MUX_CABLE_TABLE_NAME);
+            for (const auto &mux_port : m_mux_ports)
+            {
+                mux_cable_table.set(mux_port[0], { { STATE, state } });
+            }
+            m_MuxCableOrch->addExistingData(&mux_cable_table);
+            static_cast<Orch *>(m_MuxCableOrch)->doTask();
+        }
+
+        void AssertMuxStates(std::string state)
+        {
+            for (const auto &mux_port : m_mux_ports)
+            {
+                EXPECT_EQ(state, m_MuxOrch->getMuxCable(mux_port[0])->getState());
+            }
+        }
+    };
+
     TEST_F(MuxRollbackTest, StandbyToActiveNeighborAlreadyExists)
     {
         if (!IsPrefixBasedMuxNeighbor())
@@ -540,4 +578,74 @@ namespace mux_rollback_test
         m_MuxOrch->updateFdb(update);
         EXPECT_EQ(before, m_MuxOrch->mux_nexthop_tb_.size());
     }
+
+    TEST_F(MuxBulkSwitchoverTest, SwitchoverSharesBulkCallsAcrossCables)
+    {
+        // Both neighbors are enabled and both tunnel routes removed in one bulk call
+        EXPECT_CALL(*mock_sai_neighbor_api, create_neighbor_entries(2, _, _, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_route_api, remove_route_entries(2, _, _, _)).Times(1);
+        SetMuxStatesFromAppDb(ACTIVE_STATE);
+        AssertMuxStates(ACTIVE_STATE);
+
+        EXPECT_CALL(*mock_sai_route_api, create_route_entries(2, _, _, _, _, _)).Times(1);
+        EXPECT_CALL(*mock_sai_neighbor_api, remove_neighbor_entries(2, _, _, _)).Times(1);
+        SetMuxStatesFromAppDb(STANDBY_STATE);
+        AssertMuxStates(STANDBY_STATE);
+    }
+
+    TEST_F(MuxBulkSwitchoverTest, BulkFailureRetriesPerCable)
+    {
+        // The shared route bulk fails, each cable is rolled back and switched on its own
+        EXPECT_CALL(*mock_sai_route_api, remove_route_entries)
+            .WillOnce(Throw(runtime_error("Mock runtime error")))
+            .WillRepeatedly(::testing::DoDefault());
+        SetMuxStatesFromAppDb(ACTIVE_STATE);
+        AssertMuxStates(ACTIVE_STATE);
+    }
+
+    TEST_F(MuxBulkSwitchoverTest, SubnetIndexLongestPrefixMatch)
+    {
+        MuxCable* other_cable = m_MuxOrch->getMuxCable(OTHER_INTERFACE);
+
+        EXPECT_EQ(m_MuxCable, m_MuxOrch->findMuxCableInSubnet(IpAddress(SERVER_IP1)));
+        EXPECT_EQ(other_cable, m_MuxOrch->findMuxCableInSubnet(IpAddress(SERVER_IP2)));
+        EXPECT_EQ(nullptr, m_MuxOrch->findMuxCableInSubnet(IpAddress("192.168.0.4")));
+
+        // The same server_ipv6 on both cables resolves to the first port by name
+        EXPECT_EQ(other_cable, m_MuxOrch->findMuxCableInSubnet(IpAddress("a::a")));
+
+        // A covering subnet only matches addresses without a longer match
+        m_MuxOrch->mux_subnet_idx_.add(IpPrefix("192.168.0.0/24"), TEST_INTERFACE, m_MuxCable);
+        EXPECT_EQ(other_cable, m_MuxOrch->findMuxCableInSubnet(IpAddress(SERVER_IP2)));
+        EXPECT_EQ(m_MuxCable, m_MuxOrch->findMuxCableInSubnet(IpAddress("192.168.0.4")));
+
+        m_MuxOrch->mux_subnet_idx_.remove(IpPrefix("192.168.0.0/24"), TEST_INTERFACE);
+        EXPECT_EQ(nullptr, m_MuxOrch->findMuxCableInSubnet(IpAddress("192.168.0.4")));
+        EXPECT_EQ(m_MuxCable, m_MuxOrch->findMuxCableInSubnet(IpAddress(SERVER_IP1)));
+    }
+
+    TEST_F(MuxBulkSwitchoverTest, SubnetIndexNestedPrefixes)
+    {
+        MuxCable* other_cable = m_MuxOrch->getMuxCable(OTHER_INTERFACE);
+
+        // OTHER_INTERFACE sorts first by name, yet the longer nested prefix wins
+        m_MuxOrch->mux_subnet_idx_.add(IpPrefix("fc00::/64"), OTHER_INTERFACE, other_cable);
+        m_MuxOrch->mux_subnet_idx_.add(IpPrefix("fc00::/96"), TEST_INTERFACE, m_MuxCable);
+        m_MuxOrch->mux_subnet_idx_.add(IpPrefix("fc00::10/124"), OTHER_INTERFACE, other_cable);
+
+        EXPECT_EQ(m_MuxCable, m_MuxOrch->findMuxCableInSubnet(IpAddress("fc00::1")));
+        EXPECT_EQ(other_cable, m_MuxOrch->findMuxCableInSubnet(IpAddress("fc00::11")));
+        EXPECT_EQ(other_cable, m_MuxOrch->findMuxCableInSubnet(IpAddress("fc00::1:0:0:1")));
+        EXPECT_EQ(nullptr, m_MuxOrch->findMuxCableInSubnet(IpAddress("fc00:0:0:1::1")));
+
+        // Removing the innermost prefix falls back to the next longest one
+        m_MuxOrch->mux_subnet_idx_.remove(IpPrefix("fc00::10/124"), OTHER_INTERFACE);
+        EXPECT_EQ(m_MuxCable, m_MuxOrch->findMuxCableInSubnet(IpAddress("fc00::11")));
+
+        m_MuxOrch->mux_subnet_idx_.remove(IpPrefix("fc00::/96"), TEST_INTERFACE);
+        EXPECT_EQ(other_cable, m_MuxOrch->findMuxCableInSubnet(IpAddress("fc00::1")));
+
+        m_MuxOrch->mux_subnet_idx_.remove(IpPrefix("fc00::/64"), OTHER_INTERFACE);
+        EXPECT_EQ(nullptr, m_MuxOrch->findMuxCableInSubnet(IpAddress("fc00::1")));
+    }
 }
@@ -0,0 +1,182 @@
+#include "gtest/gtest.h"
+#include <fstream>
+#include <sstream>
+#include "../mock_table.h"
+#define private public
+#include "natmgr.h"
+#undef private
+
+extern int (*callback)(const std::string &cmd, std::string &stdout);
+extern std::vector<std::string> mockCallArgs;
+
+/* Fail the commands, and the iptables-restore input, matching this string */
+static std::string failingCmd;
+
+static int cb(const std::string &cmd, std::string &stdout)
+{
+    mockCallArgs.push_back(cmd);
+    if (failingCmd.empty())
+    {
+        return 0;
+    }
+    if (cmd.find("/sbin/iptables-restore") == 0)
+    {
+        std::ifstream input(cmd.substr(cmd.find('<') + 2));
+        std::stringstream rules;
+        rules << input.rdbuf();
+        return (rules.str().find(failingCmd) != std::string::npos) ? 1 : 0;
+    }
+    return (cmd.find(failingCmd) != std::string::npos) ? 1 : 0;
+}
+
+namespace natmgr_ut
+{
+    struct NatMgrTest : public ::testing::Test
+    {
+        std::shared_ptr<swss::DBConnector> m_config_db;
+        std::shared_ptr<swss::DBConnector> m_app_db;
+        std::shared_ptr<swss::DBConnector> m_state_db;
+        std::shared_ptr<swss::NatMgr> m_natMgr;
+
+        void SetUp() override
+        {
+            testing_db::reset();
+            m_config_db = std::make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_app_db = std::make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_state_db = std::make_shared<swss::DBConnector>("STATE_DB", 0);
+            m_natMgr = std::make_shared<swss::NatMgr>(m_config_db.get(), m_app_db.get(), m_state_db.get(),
+                                                      std::vector<std::string>());
+            m_natMgr->m_natZoneInterfaceInfo["Ethernet0"] = "1";
+            mockCallArgs.clear();
+            failingCmd.clear();
+            callback = cb;
+        }
+
+        void TearDown() override
+        {
+            callback = nullptr;
+        }
+    };
+
+    TEST_F(NatMgrTest, BatchQueuesUntilCommit)
+    {
+        {
+            swss::IptablesBatchGuard iptablesBatch(*m_natMgr);
+
+            ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.1", "10.0.0.1", SNAT_NAT_TYPE));
+            ASSERT_TRUE(m_natMgr->setMangleIptablesRules(ADD, "Ethernet0", "1"));
+            ASSERT_TRUE(mockCallArgs.empty());
+            ASSERT_EQ(m_natMgr->m_pendingIptablesRules["nat"].size(), 2u);
+            ASSERT_EQ(m_natMgr->m_pendingIptablesRules["mangle"].size(), 2u);
+        }
+
+        // One iptables-restore per table for the whole batch
+        ASSERT_FALSE(m_natMgr->m_iptablesBatching);
+        ASSERT_TRUE(m_natMgr->m_pendingIptablesRules.empty());
+        ASSERT_EQ(mockCallArgs.size(), 2u);
+        ASSERT_EQ(mockCallArgs[0].find("/sbin/iptables-restore --noflush"), 0u);
+        ASSERT_EQ(mockCallArgs[1].find("/sbin/iptables-restore --noflush"), 0u);
+
+        // Without a batch, the commands run right away
+        mockCallArgs.clear();
+        ASSERT_TRUE(m_natMgr->setMangleIptablesRules(DELETE, "Ethernet0", "1"));
+        ASSERT_EQ(mockCallArgs.size(), 1u);
+        ASSERT_EQ(mockCallArgs[0].find("/sbin/iptables -t mangle -D PREROUTING"), 0u);
+    }
+
+    TEST_F(NatMgrTest, ConntrackRunsAfterQueuedRules)
+    {
+        {
+            swss::IptablesBatchGuard iptablesBatch(*m_natMgr);
+
+            ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.1", "10.0.0.1", SNAT_NAT_TYPE));
+            m_natMgr->deleteConntrackDynamicEntries("65.55.45.1");
+            ASSERT_TRUE(m_natMgr->setMangleIptablesRules(ADD, "Ethernet0", "1"));
+
+            // The conntrack command doesn't break the batch
+            ASSERT_TRUE(mockCallArgs.empty());
+            ASSERT_EQ(m_natMgr->m_pendingConntrackCmds.size(), 1u);
+        }
+
+        ASSERT_TRUE(m_natMgr->m_pendingConntrackCmds.empty());
+        ASSERT_EQ(mockCallArgs.size(), 3u);
+        ASSERT_EQ(mockCallArgs[0].find("/sbin/iptables-restore --noflush"), 0u);
+        ASSERT_EQ(mockCallArgs[1].find("/sbin/iptables-restore --noflush"), 0u);
+        ASSERT_EQ(mockCallArgs[2].find("/usr/sbin/conntrack -D"), 0u);
+    }
+
+    TEST_F(NatMgrTest, CommitReportsFailedCommands)
+    {
+        failingCmd = "POSTROUTING -o Ethernet0";
+
+        m_natMgr->beginIptablesBatch();
+        ASSERT_TRUE(m_natMgr->setStaticNatIptablesRules(INSERT, "Ethernet0", "65.55.45.1", "10.0.0.1", SNAT_NAT_TYPE));
+        ASSERT_TRUE(m_natMgr->setMangleIptablesRules(ADD, "Ethernet0", "1"));
+
+        // Only the mangle table fails: its rules are replayed one at a time and the failure is reported
+        ASSERT_FALSE(m_natMgr->commitIptablesBatch());
+        ASSERT_FALSE(m_natMgr->m_iptablesBatching);
+        ASSERT_TRUE(m_natMgr->m_pendingIptablesRules.empty());
+        ASSERT_EQ(mockCallArgs, std::vector<std::string>({
+            mockCallArgs[0],
+            "/sbin/iptables -t mangle -A PREROUTING -i Ethernet0 -j MARK --set-mark 1",
+            "/sbin/iptables -t mangle -A POSTROUTING -o Ethernet0 -j MARK --set-mark 1",
+            mockCallArgs[3] }));
+        ASSERT_EQ(mockCallArgs[0].find("/sbin/iptables-restore --noflush"), 0u);
+        ASSERT_EQ(mockCallArgs[3].find("/sbin/iptables-restore --noflush"), 0u);
+        ASSERT_EQ(m_natMgr->m_failedIptablesRules.size(), 1u);
+
+        // The failed rule is queued again by the next batches, until it applies
+        mockCallArgs.clear();
+        m_natMgr->beginIptablesBatch();
+        ASSERT_EQ(m_natMgr->m_pendingIptablesRules["mangle"],
+                  std::vector<std::string>({ "-A POSTROUTING -o Ethernet0 -j MARK --set-mark 1" }));
+        failingCmd.clear();
+        ASSERT_TRUE(m_natMgr->commitIptablesBatch());
+        ASSERT_EQ(mockCallArgs.size(), 1u);
+        ASSERT_TRUE(m_natMgr->m_failedIptablesRules.empty());
+    }
+
+    TEST_F(NatMgrTest, FailedRuleIsDroppedAfterRetries)
+    {
+        failingCmd = "POSTROUTING -o Ethernet0";
+
+        m_natMgr->beginIptablesBatch();
+        ASSERT_TRUE(m_natMgr->setMangleIptablesRules(ADD, "Ethernet0", "1"));
+        ASSERT_FALSE(m_natMgr->commitIptablesBatch());
+
+        for (int i = 1; i < IPTABLES_RULE_RETRY_MAX; i++)
+        {
+            ASSERT_EQ(m_natMgr->m_failedIptablesRules.size(), 1u);
+            m_natMgr->beginIptablesBatch();
+            ASSERT_FALSE(m_natMgr->commitIptablesBatch());
+        }
+
+        ASSERT_TRUE(m_natMgr->m_failedIptablesRules.empty());
+        m_natMgr->beginIptablesBatch();
+        ASSERT_TRUE(m_natMgr->m_pendingIptablesRules.empty());
+        ASSERT_TRUE(m_natMgr->commitIptablesBatch());
+    }
+
+    TEST_F(NatMgrTest, BatchEndsOnException)
+    {
+        try
+        {
+            swss::IptablesBatchGuard iptablesBatch(*m_natMgr);
+
+            ASSERT_TRUE(m_natMgr->setMangleIptablesRules(ADD, "Ethernet0", "1"));
+            throw std::runtime_error("drain failure");
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+
+        // The queued rules are applied and the next commands are no longer queued
+        ASSERT_FALSE(m_natMgr->m_iptablesBatching);
+        ASSERT_TRUE(m_natMgr->m_pendingIptablesRules.empty());
+        ASSERT_EQ(mockCallArgs.size(), 1u);
+
+        ASSERT_TRUE(m_natMgr->setMangleIptablesRules(DELETE, "Ethernet0", "1"));
+        ASSERT_EQ(mockCallArgs.size(), 2u);
+    }
+}
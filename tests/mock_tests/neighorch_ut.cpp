@@ -474,4 +474,28 @@ namespace neighorch_test
         EXPECT_FALSE(gNeighOrch->isHwConfigured(VLAN1000_NEIGH));
         EXPECT_TRUE(gNeighOrch->isHwConfigured(VLAN2000_NEIGH));
     }
+
+    TEST_F(NeighOrchTest, IfChangeInformNextHop_FlagsAllNextHopsOnAlias)
+    {
+        const string TEST_IP2 = "10.10.10.11";
+        const NextHopKey VLAN1000_NH = NextHopKey(TEST_IP, VLAN_1000);
+        const NextHopKey VLAN1000_NH2 = NextHopKey(TEST_IP2, VLAN_1000);
+        const NextHopKey VLAN2000_NH = NextHopKey(TEST_IP, VLAN_2000);
+
+        EXPECT_CALL(*mock_sai_neighbor_api, create_neighbor_entry).Times(3);
+        LearnNeighbor(VLAN_1000, TEST_IP, MAC1);
+        LearnNeighbor(VLAN_1000, TEST_IP2, MAC3);
+        LearnNeighbor(VLAN_2000, TEST_IP, MAC2);
+        ASSERT_EQ(gNeighOrch->m_syncdNextHopsByAlias[VLAN_1000].size(), 2);
+
+        // Interface down flags every next hop on the alias and nothing else
+        EXPECT_TRUE(gNeighOrch->ifChangeInformNextHop(VLAN_1000, false));
+        EXPECT_TRUE(gNeighOrch->m_syncdNextHops[VLAN1000_NH].nh_flags & NHFLAGS_IFDOWN);
+        EXPECT_TRUE(gNeighOrch->m_syncdNextHops[VLAN1000_NH2].nh_flags & NHFLAGS_IFDOWN);
+        EXPECT_FALSE(gNeighOrch->m_syncdNextHops[VLAN2000_NH].nh_flags & NHFLAGS_IFDOWN);
+
+        EXPECT_TRUE(gNeighOrch->ifChangeInformNextHop(VLAN_1000, true));
+        EXPECT_FALSE(gNeighOrch->m_syncdNextHops[VLAN1000_NH].nh_flags & NHFLAGS_IFDOWN);
+        EXPECT_FALSE(gNeighOrch->m_syncdNextHops[VLAN1000_NH2].nh_flags & NHFLAGS_IFDOWN);
+    }
 }
@@ -0,0 +1,158 @@
+#include <net/if.h>
+#include <linux/neighbour.h>
+#include <netlink/route/neighbour.h>
+
+#include "gtest/gtest.h"
+#include "mock_table.h"
+#define private public
+#include "neighsync.h"
+#undef private
+
+namespace neighsyncd_ut
+{
+    struct NeighSyncdTest : public ::testing::Test
+    {
+        std::shared_ptr<swss::DBConnector> m_app_db;
+        std::shared_ptr<swss::DBConnector> m_state_db;
+        std::shared_ptr<swss::DBConnector> m_config_db;
+        std::shared_ptr<swss::RedisPipeline> m_pipeline;
+
+        void SetUp() override
+        {
+            testing_db::reset();
+            m_app_db = std::make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_state_db = std::make_shared<swss::DBConnector>("STATE_DB", 0);
+            m_config_db = std::make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_pipeline = std::make_shared<swss::RedisPipeline>(m_app_db.get());
+        }
+
+        void TearDown() override
+        {
+            testing_db::reset();
+        }
+
+        /* Feed a neighbor message on the loopback interface to NeighSync */
+        void sendNeighMsg(swss::NeighSync &sync, int nlmsg_type, const std::string &ip, const std::string &mac,
+                          int state = NUD_REACHABLE)
+        {
+            struct rtnl_neigh *neigh = rtnl_neigh_alloc();
+            struct nl_addr *dst = nullptr;
+            struct nl_addr *lladdr = nullptr;
+
+            ASSERT_EQ(nl_addr_parse(ip.c_str(), AF_INET, &dst), 0);
+            ASSERT_EQ(nl_addr_parse(mac.c_str(), AF_LLC, &lladdr), 0);
+
+            rtnl_neigh_set_family(neigh, AF_INET);
+            rtnl_neigh_set_ifindex(neigh, if_nametoindex("lo"));
+            rtnl_neigh_set_dst(neigh, dst);
+            rtnl_neigh_set_lladdr(neigh, lladdr);
+            rtnl_neigh_set_state(neigh, state);
+
+            sync.onMsg(nlmsg_type, (struct nl_object *)neigh);
+
+            nl_addr_put(dst);
+            nl_addr_put(lladdr);
+            rtnl_neigh_put(neigh);
+        }
+    };
+
+    TEST_F(NeighSyncdTest, CoalesceUpdatesPerKey)
+    {
+        swss::NeighSync sync(m_pipeline.get(), m_state_db.get(), m_config_db.get(), m_app_db.get());
+        swss::Table neighTable(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+        std::string value;
+
+        ASSERT_EQ(sync.getFlushTimeout(), -1);
+
+        sendNeighMsg(sync, RTM_NEWNEIGH, "10.0.0.1", "00:00:00:00:00:01");
+        sendNeighMsg(sync, RTM_NEWNEIGH, "10.0.0.1", "00:00:00:00:00:02");
+        sendNeighMsg(sync, RTM_NEWNEIGH, "10.0.0.2", "00:00:00:00:00:03");
+
+        // Nothing is written before the flush, and only one update is kept per key
+        ASSERT_EQ(sync.m_pendingNeighbors.size(), 2u);
+        ASSERT_EQ(sync.m_eventsIn, 3u);
+        ASSERT_EQ(sync.m_coalesced, 1u);
+        ASSERT_GE(sync.getFlushTimeout(), 0);
+        ASSERT_LE(sync.getFlushTimeout(), NEIGHSYNC_FLUSH_INTERVAL_MS);
+        ASSERT_FALSE(neighTable.hget("lo:10.0.0.1", "neigh", value));
+
+        sync.flushPendingNeighbors();
+        ASSERT_TRUE(sync.m_pendingNeighbors.empty());
+        ASSERT_EQ(sync.getFlushTimeout(), -1);
+        ASSERT_EQ(sync.m_writesOut, 2u);
+        ASSERT_TRUE(neighTable.hget("lo:10.0.0.1", "neigh", value));
+        ASSERT_EQ(value, "00:00:00:00:00:02");
+        ASSERT_TRUE(neighTable.hget("lo:10.0.0.2", "neigh", value));
+        ASSERT_EQ(value, "00:00:00:00:00:03");
+
+        swss::Table statsTable(m_state_db.get(), STATE_NEIGHSYNCD_STATS_TABLE_NAME);
+        ASSERT_TRUE(statsTable.hget("neighsyncd", "coalesced", value));
+        ASSERT_EQ(value, "1");
+
+        // A delete following an update of the same key wins
+        sendNeighMsg(sync, RTM_NEWNEIGH, "10.0.0.1", "00:00:00:00:00:04");
+        sendNeighMsg(sync, RTM_DELNEIGH, "10.0.0.1", "00:00:00:00:00:04");
+        ASSERT_EQ(sync.m_pendingNeighbors.size(), 1u);
+        ASSERT_TRUE(sync.m_pendingNeighbors.begin()->second.del);
+
+        sync.flushPendingNeighbors();
+        ASSERT_FALSE(neighTable.hget("lo:10.0.0.1", "neigh", value));
+        ASSERT_TRUE(neighTable.hget("lo:10.0.0.2", "neigh", value));
+        ASSERT_EQ(sync.m_writesOut, 3u);
+    }
+
+    TEST_F(NeighSyncdTest, CoalesceFlushesWhenFull)
+    {
+        swss::NeighSync sync(m_pipeline.get(), m_state_db.get(), m_config_db.get(), m_app_db.get());
+
+        for (int i = 0; i < NEIGHSYNC_MAX_PENDING; i++)
+        {
+            std::string ip = "10.1." + std::to_string(i / 256) + "." + std::to_string(i % 256);
+            sendNeighMsg(sync, RTM_NEWNEIGH, ip, "00:00:00:00:01:01");
+        }
+
+        ASSERT_TRUE(sync.m_pendingNeighbors.empty());
+        ASSERT_EQ(sync.m_writesOut, static_cast<uint64_t>(NEIGHSYNC_MAX_PENDING));
+    }
+
+    TEST_F(NeighSyncdTest, ConfigCacheFollowsConfigChanges)
+    {
+        swss::Table intfTable(m_config_db.get(), CFG_INTF_TABLE_NAME);
+        intfTable.set("Ethernet0", { { "ipv6_use_link_local_only", "enable" } });
+
+        // The cache is loaded on start
+        swss::NeighSync sync(m_pipeline.get(), m_state_db.get(), m_config_db.get(), m_app_db.get());
+        ASSERT_TRUE(sync.isLinkLocalEnabled("Ethernet0"));
+        ASSERT_FALSE(sync.isLinkLocalEnabled("Ethernet4"));
+
+        // IP entries of the interface do not change the setting
+        intfTable.set("Ethernet0|fc00::1/64", { { "NULL", "NULL" } });
+        ASSERT_TRUE(sync.processCfgTable(&sync.m_cfgInterfaceTable));
+        ASSERT_TRUE(sync.isLinkLocalEnabled("Ethernet0"));
+
+        // Disabling it invalidates the cached entry
+        intfTable.set("Ethernet0", { { "ipv6_use_link_local_only", "disable" } });
+        ASSERT_TRUE(sync.processCfgTable(&sync.m_cfgInterfaceTable));
+        ASSERT_FALSE(sync.isLinkLocalEnabled("Ethernet0"));
+
+        swss::Table vlanIntfTable(m_config_db.get(), CFG_VLAN_INTF_TABLE_NAME);
+        vlanIntfTable.set("Vlan1000", { { "ipv6_use_link_local_only", "enable" } });
+        ASSERT_TRUE(sync.processCfgTable(&sync.m_cfgVlanInterfaceTable));
+        ASSERT_TRUE(sync.isLinkLocalEnabled("Vlan1000"));
+
+        // A peer switch turns the device into a dual ToR, which ignores IPv4 link local neighbors
+        sendNeighMsg(sync, RTM_NEWNEIGH, "169.254.0.1", "00:00:00:00:00:01");
+        ASSERT_EQ(sync.m_eventsIn, 1u);
+
+        swss::Table peerSwitchTable(m_config_db.get(), CFG_PEER_SWITCH_TABLE_NAME);
+        peerSwitchTable.set("peer_switch", { { "address_ipv4", "10.1.0.32" } });
+        ASSERT_TRUE(sync.processCfgTable(&sync.m_cfgPeerSwitchTable));
+        ASSERT_EQ(sync.m_peerSwitches.count("peer_switch"), 1u);
+
+        sendNeighMsg(sync, RTM_NEWNEIGH, "169.254.0.2", "00:00:00:00:00:02");
+        ASSERT_EQ(sync.m_eventsIn, 1u);
+
+        // Tables which are not cached are left to the caller
+        ASSERT_FALSE(sync.processCfgTable(sync.getCfgEvpnNvoTable()));
+    }
+}
@@ -62,6 +62,21 @@ struct Portal
         {
             crmOrch->getResAvailableCounters();
         }
+
+        static std::map<CrmResourceType, CrmOrch::CrmResourceEntry> &getResourceMap(CrmOrch *crmOrch)
+        {
+            return crmOrch->m_resourcesMap;
+        }
+
+        static void doTimerTask(CrmOrch *crmOrch)
+        {
+            crmOrch->doTask(*crmOrch->m_timer);
+        }
+
+        static void skipPolls(CrmOrch *crmOrch, int polls)
+        {
+            crmOrch->m_lastFullRefresh -= polls * crmOrch->m_pollingInterval;
+        }
     };
 
     struct CoppOrchInternal
@@ -61,6 +61,7 @@ namespace portsorch_test
     bool set_autoneg_need_retry = false;
     bool set_autoneg_fail = false;
     uint32_t _sai_set_port_tpid_count;
+    vector<sai_object_id_t> _sai_set_port_pvid_ports;
     int32_t _sai_port_fec_mode;
     vector<sai_port_fec_mode_t> mock_port_fec_modes = {SAI_PORT_FEC_MODE_RS, SAI_PORT_FEC_MODE_FC};
 
@@ -248,6 +249,10 @@ namespace portsorch_test
         {
             _sai_set_port_tpid_count++;
         }
+        else if (attr[0].id == SAI_PORT_ATTR_PORT_VLAN_ID)
+        {
+            _sai_set_port_pvid_ports.push_back(port_id);
+        }
         else if (attr[0].id == SAI_PORT_ATTR_FAST_LINKUP_ENABLED)
         {
             _sai_set_fast_linkup_count++;
@@ -282,6 +287,31 @@ namespace portsorch_test
         return pold_sai_port_api->set_port_attribute(port_id, attr);
     }
 
+    uint32_t _sai_set_ports_attribute_count = 0;
+    uint32_t _sai_set_ports_attribute_objects = 0;
+    map<sai_attr_id_t, uint32_t> _sai_set_ports_attribute_calls;
+
+    sai_status_t _ut_stub_sai_set_ports_attribute(
+        uint32_t object_count,
+        const sai_object_id_t *object_id,
+        const sai_attribute_t *attr_list,
+        sai_bulk_op_error_mode_t mode,
+        sai_status_t *object_statuses)
+    {
+        _sai_set_ports_attribute_count++;
+        _sai_set_ports_attribute_objects += object_count;
+        if (object_count > 0)
+        {
+            _sai_set_ports_attribute_calls[attr_list[0].id]++;
+        }
+
+        for (size_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = _ut_stub_sai_set_port_attribute(object_id[i], attr_list + i);
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
     vector<sai_object_type_t> supported_sai_objects = {
         SAI_OBJECT_TYPE_PORT,
         SAI_OBJECT_TYPE_LAG,
@@ -430,6 +460,7 @@ namespace portsorch_test
         pold_sai_port_api = sai_port_api;
         ut_sai_port_api.get_port_attribute = _ut_stub_sai_get_port_attribute;
         ut_sai_port_api.set_port_attribute = _ut_stub_sai_set_port_attribute;
+        ut_sai_port_api.set_ports_attribute = _ut_stub_sai_set_ports_attribute;
         ut_sai_port_api.create_port_serdes = _ut_stub_sai_create_port_serdes;
         ut_sai_port_api.remove_port_serdes = _ut_stub_sai_remove_port_serdes;
         sai_port_api = &ut_sai_port_api;
@@ -535,6 +566,55 @@ namespace portsorch_test
         sai_bridge_api = org_sai_bridge_api;
     }
 
+    sai_object_id_t _sai_create_lag_members_fail_port_id = SAI_NULL_OBJECT_ID;
+    uint32_t _sai_create_lag_members_objects = 0;
+    uint32_t _sai_create_lag_members_created = 0;
+
+    /* Bulk create the LAG members one by one, failing the member of the given port */
+    sai_status_t _ut_stub_sai_create_lag_members(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        _sai_create_lag_members_objects += object_count;
+
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+            {
+                object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+                continue;
+            }
+
+            bool fail = false;
+            for (uint32_t j = 0; j < attr_count[i]; j++)
+            {
+                if (attr_list[i][j].id == SAI_LAG_MEMBER_ATTR_PORT_ID &&
+                    attr_list[i][j].value.oid == _sai_create_lag_members_fail_port_id)
+                {
+                    fail = true;
+                }
+            }
+
+            object_statuses[i] = fail ? SAI_STATUS_FAILURE :
+                sai_lag_api->create_lag_member(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+            if (object_statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+                continue;
+            }
+            _sai_create_lag_members_created++;
+        }
+
+        return status;
+    }
+
     void cleanupPorts(PortsOrch *obj)
     {
         // Get CPU port
@@ -1431,6 +1511,120 @@ namespace portsorch_test
         cleanupPorts(gPortsOrch);
     }
 
+    /*
+     * MTU, TPID and admin status of many ports updated in one drain are
+     * pushed with one bulk set per attribute, and a port whose admin status
+     * has to be retried keeps its task while the other ports are done.
+     */
+    TEST_F(PortsOrchTest, PortAttrBulkSetAcrossPorts)
+    {
+        auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        // Get SAI default ports
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        // Generate port config
+        for (const auto &cit : ports)
+        {
+            portTable.set(cit.first, cit.second);
+        }
+
+        // Set PortConfigDone
+        portTable.set("PortConfigDone", { { "count", std::to_string(ports.size()) } });
+
+        // Refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration
+        static_cast<Orch*>(gPortsOrch)->doTask();
+
+        _hook_sai_port_api();
+
+        std::deque<KeyOpFieldsValuesTuple> kfvList;
+        for (const auto &cit : ports)
+        {
+            kfvList.push_back({
+                cit.first,
+                SET_COMMAND, {
+                    { "mtu",          "9100"   },
+                    { "tpid",         "0x9100" },
+                    { "admin_status", "down"   }
+                }
+            });
+        }
+
+        _sai_set_ports_attribute_count = 0;
+        _sai_set_ports_attribute_objects = 0;
+        _sai_set_ports_attribute_calls.clear();
+
+        // Refill consumer
+        auto consumer = dynamic_cast<Consumer*>(gPortsOrch->getExecutor(APP_PORT_TABLE_NAME));
+        consumer->addToSync(kfvList);
+
+        // Apply configuration
+        static_cast<Orch*>(gPortsOrch)->doTask();
+
+        // One bulk call per attribute covering every port
+        ASSERT_EQ(_sai_set_ports_attribute_count, 3);
+        ASSERT_EQ(_sai_set_ports_attribute_objects, 3 * ports.size());
+        ASSERT_EQ(_sai_set_ports_attribute_calls[SAI_PORT_ATTR_MTU], 1);
+        ASSERT_EQ(_sai_set_ports_attribute_calls[SAI_PORT_ATTR_TPID], 1);
+        ASSERT_EQ(_sai_set_ports_attribute_calls[SAI_PORT_ATTR_ADMIN_STATE], 1);
+
+        for (const auto &cit : ports)
+        {
+            Port p;
+            ASSERT_TRUE(gPortsOrch->getPort(cit.first, p));
+            ASSERT_EQ(p.m_mtu, 9100);
+            ASSERT_EQ(p.m_tpid, 0x9100);
+            ASSERT_FALSE(p.m_admin_state_up);
+        }
+
+        std::vector<std::string> taskList;
+        gPortsOrch->dumpPendingTasks(taskList);
+        ASSERT_TRUE(taskList.empty());
+
+        // Admin status that needs a retry keeps the task, the MTU is still applied
+        set_admin_status_fail = true;
+
+        kfvList = {{
+            "Ethernet0",
+            SET_COMMAND, {
+                { "mtu",          "1500" },
+                { "admin_status", "up"   }
+            }
+        }};
+        consumer->addToSync(kfvList);
+        static_cast<Orch*>(gPortsOrch)->doTask();
+
+        Port p;
+        ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", p));
+        ASSERT_EQ(p.m_mtu, 1500);
+        ASSERT_FALSE(p.m_admin_state_up);
+
+        taskList.clear();
+        gPortsOrch->dumpPendingTasks(taskList);
+        ASSERT_EQ(taskList.size(), 1);
+
+        // Retry succeeds
+        set_admin_status_fail = false;
+        set_admin_status_failures = 0;
+        static_cast<Orch*>(gPortsOrch)->doTask();
+
+        ASSERT_TRUE(gPortsOrch->getPort("Ethernet0", p));
+        ASSERT_TRUE(p.m_admin_state_up);
+
+        taskList.clear();
+        gPortsOrch->dumpPendingTasks(taskList);
+        ASSERT_TRUE(taskList.empty());
+
+        _unhook_sai_port_api();
+
+        // Cleanup ports
+        cleanupPorts(gPortsOrch);
+    }
+
     TEST_F(PortsOrchTest, PortAdvancedConfig)
     {
         auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
@@ -5784,4 +5978,201 @@ namespace portsorch_test
 
         ASSERT_FALSE(gPortsOrch->getPort("Vlan200", vlan));
     }
+
+    /*
+     * Create the ports and PortChannel0001, returning the two ports
+     * which are added to the LAG by the tests of the LAG member bulk.
+     */
+    static void setUpLagMemberBulkTest(shared_ptr<DBConnector> app_db, string &member1, string &member2)
+    {
+        Table portTable = Table(app_db.get(), APP_PORT_TABLE_NAME);
+        Table lagTable = Table(app_db.get(), APP_LAG_TABLE_NAME);
+
+        auto ports = ut_helper::getInitialSaiPorts();
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { } });
+
+        lagTable.set("PortChannel0001",
+            {
+                {"admin_status", "up"},
+                {"mtu", "9100"}
+            }
+        );
+
+        gPortsOrch->addExistingData(&portTable);
+        gPortsOrch->addExistingData(&lagTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        auto it = ports.begin();
+        member1 = (it++)->first;
+        member2 = it->first;
+    }
+
+    /*
+     * One member of a LAG member bulk fails: it is created on its own by
+     * addLagMember(), and the PVID of every port is set once its member exists.
+     * The members are created with their collection and distribution state,
+     * enabled or disabled, so no attribute is set on them afterwards.
+     */
+    TEST_F(PortsOrchTest, LagMemberBulkCreatePartialFailure)
+    {
+        Table lagMemberTable = Table(m_app_db.get(), APP_LAG_MEMBER_TABLE_NAME);
+        string member1, member2;
+        setUpLagMemberBulkTest(m_app_db, member1, member2);
+
+        Port port1, port2;
+        ASSERT_TRUE(gPortsOrch->getPort(member1, port1));
+        ASSERT_TRUE(gPortsOrch->getPort(member2, port2));
+
+        _hook_sai_port_api();
+        _sai_set_port_pvid_ports.clear();
+        _sai_create_lag_members_objects = 0;
+        _sai_create_lag_members_created = 0;
+        _sai_create_lag_members_fail_port_id = port2.m_port_id;
+        auto orig_create_lag_members = gPortsOrch->m_lagMemberBulker.create_entries;
+        gPortsOrch->m_lagMemberBulker.create_entries = _ut_stub_sai_create_lag_members;
+
+        auto orig_lag_api = sai_lag_api;
+        sai_lag_api = new sai_lag_api_t();
+        memcpy(sai_lag_api, orig_lag_api, sizeof(*sai_lag_api));
+
+        vector<sai_object_id_t> createdPorts;
+        auto lagSpy = SpyOn<SAI_API_LAG, SAI_OBJECT_TYPE_LAG_MEMBER>(&sai_lag_api->create_lag_member);
+        lagSpy->callFake([&](sai_object_id_t *oid, sai_object_id_t swoid, uint32_t count, const sai_attribute_t * attrs) -> sai_status_t
+            {
+                for (uint32_t i = 0; i < count; i++)
+                {
+                    if (attrs[i].id == SAI_LAG_MEMBER_ATTR_PORT_ID)
+                    {
+                        createdPorts.push_back(attrs[i].value.oid);
+                    }
+                }
+                return orig_lag_api->create_lag_member(oid, swoid, count, attrs);
+            }
+        );
+
+        uint32_t memberAttrSets = 0;
+        auto lagSetSpy = SpyOn<SAI_API_LAG, SAI_OBJECT_TYPE_LAG_MEMBER>(&sai_lag_api->set_lag_member_attribute);
+        lagSetSpy->callFake([&](sai_object_id_t oid, const sai_attribute_t *attr) -> sai_status_t
+            {
+                memberAttrSets++;
+                return orig_lag_api->set_lag_member_attribute(oid, attr);
+            }
+        );
+
+        lagMemberTable.set(
+            std::string("PortChannel0001") + lagMemberTable.getTableNameSeparator() + member1,
+            { {"status", "enabled"} });
+        lagMemberTable.set(
+            std::string("PortChannel0001") + lagMemberTable.getTableNameSeparator() + member2,
+            { {"status", "disabled"} });
+        gPortsOrch->addExistingData(&lagMemberTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        gPortsOrch->m_lagMemberBulker.create_entries = orig_create_lag_members;
+        sai_lag_api = orig_lag_api;
+        _sai_create_lag_members_fail_port_id = SAI_NULL_OBJECT_ID;
+        _unhook_sai_port_api();
+
+        vector<string> ts;
+        auto consumer = static_cast<Consumer*>(gPortsOrch->getExecutor(APP_LAG_MEMBER_TABLE_NAME));
+        consumer->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+
+        // Both members were bulked, the failed one was then created on its own
+        ASSERT_EQ(_sai_create_lag_members_objects, 2u);
+        ASSERT_EQ(_sai_create_lag_members_created, 1u);
+        ASSERT_EQ(createdPorts, vector<sai_object_id_t>({ port1.m_port_id, port2.m_port_id }));
+        ASSERT_TRUE(gPortsOrch->m_bulkLagMembers.empty());
+        ASSERT_EQ(memberAttrSets, 0u);
+
+        Port lag;
+        ASSERT_TRUE(gPortsOrch->getPort("PortChannel0001", lag));
+        ASSERT_EQ(lag.m_members.size(), 2u);
+        ASSERT_TRUE(gPortsOrch->getPort(member1, port1));
+        ASSERT_TRUE(gPortsOrch->getPort(member2, port2));
+        ASSERT_NE(port1.m_lag_member_id, SAI_NULL_OBJECT_ID);
+        ASSERT_NE(port2.m_lag_member_id, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(port1.m_lag_id, lag.m_lag_id);
+        ASSERT_EQ(port2.m_lag_id, lag.m_lag_id);
+
+        ASSERT_EQ(count(_sai_set_port_pvid_ports.begin(), _sai_set_port_pvid_ports.end(), port1.m_port_id), 1);
+        ASSERT_EQ(count(_sai_set_port_pvid_ports.begin(), _sai_set_port_pvid_ports.end(), port2.m_port_id), 1);
+    }
+
+    /*
+     * A member created in bulk whose entry is gone by the time doLagMemberTask()
+     * runs is removed, and the PVID of its port is never set.
+     */
+    TEST_F(PortsOrchTest, LagMemberBulkOrphanIsRemoved)
+    {
+        Table lagMemberTable = Table(m_app_db.get(), APP_LAG_MEMBER_TABLE_NAME);
+        string member1, member2;
+        setUpLagMemberBulkTest(m_app_db, member1, member2);
+
+        Port port1, port2;
+        ASSERT_TRUE(gPortsOrch->getPort(member1, port1));
+        ASSERT_TRUE(gPortsOrch->getPort(member2, port2));
+
+        string key1 = std::string("PortChannel0001") + lagMemberTable.getTableNameSeparator() + member1;
+        string key2 = std::string("PortChannel0001") + lagMemberTable.getTableNameSeparator() + member2;
+        lagMemberTable.set(key1, { {"status", "enabled"} });
+        lagMemberTable.set(key2, { {"status", "disabled"} });
+        gPortsOrch->addExistingData(&lagMemberTable);
+
+        _hook_sai_port_api();
+        _sai_set_port_pvid_ports.clear();
+
+        auto consumer = static_cast<Consumer*>(gPortsOrch->getExecutor(APP_LAG_MEMBER_TABLE_NAME));
+        gPortsOrch->bulkAddLagMembers(*consumer);
+
+        // Nothing is set on the ports before their member is taken over
+        ASSERT_EQ(gPortsOrch->m_bulkLagMembers.size(), 2u);
+        sai_object_id_t orphan_id = gPortsOrch->m_bulkLagMembers[member2].second;
+        ASSERT_NE(orphan_id, SAI_NULL_OBJECT_ID);
+        ASSERT_TRUE(_sai_set_port_pvid_ports.empty());
+
+        // The entry of the second member is withdrawn before the members are taken over
+        consumer->m_toSync.erase(key2);
+
+        auto orig_lag_api = sai_lag_api;
+        sai_lag_api = new sai_lag_api_t();
+        memcpy(sai_lag_api, orig_lag_api, sizeof(*sai_lag_api));
+
+        vector<sai_object_id_t> removedMembers;
+        auto lagSpy = SpyOn<SAI_API_LAG, SAI_OBJECT_TYPE_LAG_MEMBER>(&sai_lag_api->remove_lag_member);
+        lagSpy->callFake([&](sai_object_id_t oid) -> sai_status_t
+            {
+                removedMembers.push_back(oid);
+                return orig_lag_api->remove_lag_member(oid);
+            }
+        );
+
+        gPortsOrch->doLagMemberTask(*consumer);
+
+        sai_lag_api = orig_lag_api;
+        _unhook_sai_port_api();
+
+        vector<string> ts;
+        consumer->dumpPendingTasks(ts);
+        ASSERT_TRUE(ts.empty());
+
+        // The first member was taken over, the unused one was removed
+        ASSERT_TRUE(gPortsOrch->m_bulkLagMembers.empty());
+        ASSERT_EQ(removedMembers, vector<sai_object_id_t>({ orphan_id }));
+
+        Port lag;
+        ASSERT_TRUE(gPortsOrch->getPort("PortChannel0001", lag));
+        ASSERT_EQ(lag.m_members, set<string>({ member1 }));
+        ASSERT_TRUE(gPortsOrch->getPort(member1, port1));
+        ASSERT_TRUE(gPortsOrch->getPort(member2, port2));
+        ASSERT_NE(port1.m_lag_member_id, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(port2.m_lag_member_id, SAI_NULL_OBJECT_ID);
+
+        ASSERT_EQ(_sai_set_port_pvid_ports, vector<sai_object_id_t>({ port1.m_port_id }));
+    }
 }
@@ -217,6 +217,7 @@ namespace portsyncd_ut
                                             9100,
                                             0);
         sync.onMsg(RTM_NEWLINK, msg);
+        sync.flushPendingLinks();
 
         /* Verify if the update has been written to State DB */
         std::vector<swss::FieldValueTuple> ovalues;
@@ -259,6 +260,7 @@ namespace portsyncd_ut
                                             9100,
                                             0);
         sync.onMsg(RTM_NEWLINK, msg);
+        sync.flushPendingLinks();
 
         /* Verify if the update has been written to State DB */
         std::vector<swss::FieldValueTuple> ovalues;
@@ -277,6 +279,7 @@ namespace portsyncd_ut
                            0);
 
         sync.onMsg(RTM_DELLINK, msg);
+        sync.flushPendingLinks();
         ovalues.clear();
 
         /* Verify if the state_db entry is cleared */
@@ -300,9 +303,77 @@ namespace portsyncd_ut
                                             9100,
                                             0);
         sync.onMsg(RTM_NEWLINK, msg);
+        sync.flushPendingLinks();
 
         /* Verify if nothing is written to state_db */
         std::vector<swss::FieldValueTuple> ovalues;
         ASSERT_EQ(sync.m_statePortTable.get("Ethernet0", ovalues), false);
     }
+
+    TEST_F(PortSyncdTest, test_onMsgCoalesceLinks){
+        swss::LinkSync sync(m_app_db.get(), m_state_db.get());
+
+        /* Write config to Config DB */
+        populateCfgDb(m_portCfgTable.get());
+        swss::DBConnector cfg_db_conn("CONFIG_DB", 0);
+
+        /* Handle CFG DB notifs and Write them to APPL_DB */
+        swss::ProducerStateTable p(m_app_db.get(), APP_PORT_TABLE_NAME);
+        writeToApplDB(p, cfg_db_conn);
+
+        /* Flap Ethernet0 down and up within one flush window */
+        std::vector<unsigned int> down_flags = {IFF_UP};
+        std::vector<unsigned int> up_flags = {IFF_UP, IFF_RUNNING};
+        struct nl_object* down_msg = draft_nlmsg("Ethernet0", down_flags, "sx_netdev", "1c:34:da:1c:9f:00", 142, 9100, 0);
+        struct nl_object* up_msg = draft_nlmsg("Ethernet0", up_flags, "sx_netdev", "1c:34:da:1c:9f:00", 142, 9000, 0);
+        sync.onMsg(RTM_NEWLINK, down_msg);
+        sync.onMsg(RTM_NEWLINK, up_msg);
+
+        /* Nothing is written until the pending updates are flushed */
+        std::vector<swss::FieldValueTuple> ovalues;
+        ASSERT_EQ(sync.m_pendingLinks.size(), 1);
+        ASSERT_GE(sync.getFlushTimeout(), 0);
+        ASSERT_EQ(sync.m_statePortTable.get("Ethernet0", ovalues), false);
+        ASSERT_NE(sync.m_appPorts.find("Ethernet0"), sync.m_appPorts.end());
+
+        /* Only the latest state is written */
+        sync.flushPendingLinks();
+        ASSERT_EQ(sync.getFlushTimeout(), -1);
+        ASSERT_EQ(sync.m_statePortTable.get("Ethernet0", ovalues), true);
+        for (auto value : ovalues){
+            if (fvField(value) == "mtu") {ASSERT_EQ(fvValue(value), "9000");}
+            if (fvField(value) == "netdev_oper_status") {ASSERT_EQ(fvValue(value), "up");}
+        }
+
+        /* The port is removed and created again with the same state: the
+         * STATE_DB entry comes back for the new netdev */
+        sync.m_statePortTable.del("Ethernet0");
+        struct nl_object* new_up_msg = draft_nlmsg("Ethernet0", up_flags, "sx_netdev", "1c:34:da:1c:9f:00", 143, 9000, 0);
+        sync.onMsg(RTM_NEWLINK, new_up_msg);
+        sync.flushPendingLinks();
+        ASSERT_EQ(sync.m_statePortTable.get("Ethernet0", ovalues), true);
+        free_nlobj(new_up_msg);
+
+        /* Same for a removal reported while the port is enslaved */
+        struct nl_object* enslaved_msg = draft_nlmsg("Ethernet0", up_flags, "sx_netdev", "1c:34:da:1c:9f:00", 143, 9000, 200);
+        sync.onMsg(RTM_DELLINK, enslaved_msg);
+        sync.m_statePortTable.del("Ethernet0");
+        sync.onMsg(RTM_NEWLINK, enslaved_msg);
+        sync.flushPendingLinks();
+        ASSERT_EQ(sync.m_statePortTable.get("Ethernet0", ovalues), true);
+        free_nlobj(enslaved_msg);
+
+        /* Removal followed by a new netdev keeps the removal and writes the new state */
+        sync.onMsg(RTM_DELLINK, up_msg);
+        sync.onMsg(RTM_NEWLINK, down_msg);
+        ASSERT_EQ(sync.m_pendingLinks["Ethernet0"].del, true);
+        sync.flushPendingLinks();
+        ASSERT_EQ(sync.m_statePortTable.get("Ethernet0", ovalues), true);
+        for (auto value : ovalues){
+            if (fvField(value) == "netdev_oper_status") {ASSERT_EQ(fvValue(value), "down");}
+        }
+
+        free_nlobj(down_msg);
+        free_nlobj(up_msg);
+    }
 }
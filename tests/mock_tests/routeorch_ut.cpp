@@ -10,6 +10,7 @@
 #include "mock_response_publisher.h"
 #include "mock_sai_api.h"
 #include "bulker.h"
+#include "taskstats.h"
 
 extern string gMySwitchType;
 extern bool gEnableFibSuppress;
@@ -1739,4 +1740,181 @@ namespace routeorch_test
         (void)gRouteOrch->removeRoutePrefix(IpPrefix("7.7.7.0/24"));
         ASSERT_TRUE(gRouteOrch->removeRoutePrefix(IpPrefix("7.7.7.0/24")));
     }
+
+    static uint32_t nhgm_bulk_create_count = 0;
+    static uint32_t nhgm_bulk_remove_count = 0;
+    static sai_bulk_object_create_fn old_create_nhgms;
+    static sai_bulk_object_remove_fn old_remove_nhgms;
+
+    static sai_status_t _ut_stub_create_nhgms(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        nhgm_bulk_create_count++;
+        return old_create_nhgms(switch_id, object_count, attr_count, attr_list, mode, object_id, object_statuses);
+    }
+
+    static sai_status_t _ut_stub_remove_nhgms(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        nhgm_bulk_remove_count++;
+        return old_remove_nhgms(object_count, object_id, mode, object_statuses);
+    }
+
+    /*
+     * A next hop going down or up only touches the groups that contain it,
+     * found through the next hop -> group index, and their members are
+     * removed or re-created with one bulk call.
+     */
+    TEST_F(RouteOrchTest, RouteOrchNextHopGroupIndexShrinkExpand)
+    {
+        Table neighborTable(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+        neighborTable.set("Ethernet0:10.0.0.4", {{"neigh", "00:00:0a:00:00:04"}, {"family", "IPv4"}});
+        gNeighOrch->addExistingData(&neighborTable);
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        NextHopGroupKey nhg_23("10.0.0.2,10.0.0.3");
+        NextHopGroupKey nhg_24("10.0.0.2,10.0.0.4");
+        NextHopGroupKey nhg_34("10.0.0.3,10.0.0.4");
+        ASSERT_TRUE(gRouteOrch->addNextHopGroup(nhg_23));
+        ASSERT_TRUE(gRouteOrch->addNextHopGroup(nhg_24));
+        ASSERT_TRUE(gRouteOrch->addNextHopGroup(nhg_34));
+
+        NextHopKey nh2("10.0.0.2@Ethernet0");
+        ASSERT_EQ(gRouteOrch->m_nextHopGroupIndex[nh2].size(), 2u);
+
+        old_create_nhgms = gRouteOrch->gNextHopGroupMemberBulker.create_entries;
+        old_remove_nhgms = gRouteOrch->gNextHopGroupMemberBulker.remove_entries;
+        gRouteOrch->gNextHopGroupMemberBulker.create_entries = _ut_stub_create_nhgms;
+        gRouteOrch->gNextHopGroupMemberBulker.remove_entries = _ut_stub_remove_nhgms;
+        nhgm_bulk_create_count = 0;
+        nhgm_bulk_remove_count = 0;
+
+        auto shrinks = getOrchOpStats()["RouteOrch:nhg_shrink"].count;
+        auto expands = getOrchOpStats()["RouteOrch:nhg_expand"].count;
+
+        // Shrink: both groups holding 10.0.0.2 lose it in a single bulk remove
+        uint32_t count = 0;
+        ASSERT_TRUE(gRouteOrch->invalidnexthopinNextHopGroup(nh2, count));
+        ASSERT_EQ(count, 2u);
+        ASSERT_EQ(nhgm_bulk_remove_count, 1u);
+        ASSERT_EQ(gRouteOrch->m_syncdNextHopGroups[nhg_23].nh_member_install_count, 1u);
+        ASSERT_EQ(gRouteOrch->m_syncdNextHopGroups[nhg_24].nh_member_install_count, 1u);
+        ASSERT_EQ(gRouteOrch->m_syncdNextHopGroups[nhg_34].nh_member_install_count, 2u);
+        ASSERT_EQ(getOrchOpStats()["RouteOrch:nhg_shrink"].count, shrinks + 1);
+
+        // Expand: members come back with a single bulk create
+        ASSERT_TRUE(gRouteOrch->validnexthopinNextHopGroup(nh2, count));
+        ASSERT_EQ(count, 2u);
+        ASSERT_EQ(nhgm_bulk_create_count, 1u);
+        ASSERT_EQ(gRouteOrch->m_syncdNextHopGroups[nhg_23].nh_member_install_count, 2u);
+        ASSERT_EQ(gRouteOrch->m_syncdNextHopGroups[nhg_24].nh_member_install_count, 2u);
+        ASSERT_NE(gRouteOrch->m_syncdNextHopGroups[nhg_24].nhopgroup_members[nh2].next_hop_id, SAI_NULL_OBJECT_ID);
+        ASSERT_EQ(getOrchOpStats()["RouteOrch:nhg_expand"].count, expands + 1);
+
+        gRouteOrch->gNextHopGroupMemberBulker.create_entries = old_create_nhgms;
+        gRouteOrch->gNextHopGroupMemberBulker.remove_entries = old_remove_nhgms;
+
+        // Removing the groups drops them from the index
+        ASSERT_TRUE(gRouteOrch->removeNextHopGroup(nhg_23));
+        ASSERT_TRUE(gRouteOrch->removeNextHopGroup(nhg_24));
+        ASSERT_EQ(gRouteOrch->m_nextHopGroupIndex.count(nh2), 0u);
+        ASSERT_TRUE(gRouteOrch->removeNextHopGroup(nhg_34));
+        ASSERT_TRUE(gRouteOrch->m_nextHopGroupIndex.empty());
+    }
+
+    static sai_status_t _ut_stub_create_nhgms_table_full(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            object_statuses[i] = SAI_STATUS_TABLE_FULL;
+        }
+        return SAI_STATUS_TABLE_FULL;
+    }
+
+    /*
+     * A member which fails to be re-created goes through handleSaiCreateStatus
+     * like the single create: a full table is retried and nothing is recorded.
+     */
+    TEST_F(RouteOrchTest, RouteOrchNextHopGroupExpandMemberCreateFailure)
+    {
+        NextHopGroupKey nhg_23("10.0.0.2,10.0.0.3");
+        ASSERT_TRUE(gRouteOrch->addNextHopGroup(nhg_23));
+
+        NextHopKey nh2("10.0.0.2@Ethernet0");
+        uint32_t count = 0;
+        ASSERT_TRUE(gRouteOrch->invalidnexthopinNextHopGroup(nh2, count));
+        ASSERT_EQ(count, 1u);
+
+        old_create_nhgms = gRouteOrch->gNextHopGroupMemberBulker.create_entries;
+        gRouteOrch->gNextHopGroupMemberBulker.create_entries = _ut_stub_create_nhgms_table_full;
+
+        auto used = gCrmOrch->m_resourcesMap.at(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER).countersMap["STATS"].usedCounter;
+        ASSERT_FALSE(gRouteOrch->validnexthopinNextHopGroup(nh2, count));
+        ASSERT_EQ(count, 0u);
+        ASSERT_EQ(gRouteOrch->m_syncdNextHopGroups.at(nhg_23).nh_member_install_count, 1u);
+        ASSERT_EQ(gCrmOrch->m_resourcesMap.at(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER).countersMap["STATS"].usedCounter, used);
+
+        gRouteOrch->gNextHopGroupMemberBulker.create_entries = old_create_nhgms;
+
+        ASSERT_TRUE(gRouteOrch->validnexthopinNextHopGroup(nh2, count));
+        ASSERT_EQ(count, 1u);
+        ASSERT_TRUE(gRouteOrch->removeNextHopGroup(nhg_23));
+    }
+
+    /*
+     * Routes tracked behind a next hop are rewritten with a single bulk set,
+     * and routes pointing to a multi next hop group are left alone.
+     */
+    TEST_F(RouteOrchTest, RouteOrchUpdateNextHopRoutesBulk)
+    {
+        auto *routeConsumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        ASSERT_NE(routeConsumer, nullptr);
+
+        std::vector<std::string> prefixes = { "5.5.5.1/32", "5.5.5.2/32", "5.5.5.3/32" };
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        for (const auto &prefix : prefixes)
+        {
+            entries.push_back({ prefix, "SET", { {"ifname", "Ethernet0"}, {"nexthop", "10.0.0.2"} }});
+        }
+        entries.push_back({ "5.5.6.0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"}, {"nexthop", "10.0.0.2,10.0.0.3"} }});
+        routeConsumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        NextHopKey nh2("10.0.0.2@Ethernet0");
+        for (const auto &prefix : prefixes)
+        {
+            gRouteOrch->addNextHopRoute(nh2, RouteKey{ gVirtualRouterId, IpPrefix(prefix) });
+        }
+        gRouteOrch->addNextHopRoute(nh2, RouteKey{ gVirtualRouterId, IpPrefix("5.5.6.0/24") });
+
+        auto base_set = set_route_count;
+        uint32_t num_routes = 0;
+        ASSERT_TRUE(gRouteOrch->updateNextHopRoutes(nh2, num_routes));
+
+        ASSERT_EQ(num_routes, prefixes.size());
+        ASSERT_EQ(base_set + 1, set_route_count);
+
+        for (const auto &prefix : prefixes)
+        {
+            gRouteOrch->removeNextHopRoute(nh2, RouteKey{ gVirtualRouterId, IpPrefix(prefix) });
+        }
+        gRouteOrch->removeNextHopRoute(nh2, RouteKey{ gVirtualRouterId, IpPrefix("5.5.6.0/24") });
+    }
 }
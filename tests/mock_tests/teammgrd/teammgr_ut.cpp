@@ -1,7 +1,10 @@
 #include "gtest/gtest.h"
 #include "../mock_table.h"
 #include "teammgr.h"
+#include <algorithm>
 #include <dlfcn.h>
+#include <mutex>
+#include <set>
 #include <net/if.h>
 #include <netlink/addr.h>
 #include <netlink/netlink.h>
@@ -12,6 +15,8 @@ extern int (*callback)(const std::string &cmd, std::string &stdout);
 extern std::vector<std::string> mockCallArgs;
 static std::vector< std::pair<pid_t, int> > mockKillCommands;
 static std::map<std::string, std::FILE*> pidFiles;
+// teamd is started from multiple threads
+static std::mutex mockCallMutex;
 
 static int (*callback_kill)(pid_t pid, int sig) = NULL;
 static std::pair<bool, FILE*> (*callback_fopen)(const char *pathname, const char *mode) = NULL;
@@ -23,6 +28,7 @@ static int mock_rtnl_link_get_kernel_result = 0;
 static int mock_rtnl_link_change_result = 0;
 static std::string mock_if_nametoindex_name;
 static std::vector<std::string> mock_kernel_mac_updates;
+static std::set<std::string> mock_missing_ports;
 
 extern "C" {
 
@@ -188,7 +194,15 @@ FILE* fopen64(const char *pathname, const char *mode)
 
 int cb(const std::string &cmd, std::string &stdout)
 {
+    std::lock_guard<std::mutex> lock(mockCallMutex);
     mockCallArgs.push_back(cmd);
+    for (const auto &port : mock_missing_ports)
+    {
+        if (cmd == std::string("/sbin/ip link show \"") + port + "\"")
+        {
+            return 1;
+        }
+    }
     if (cmd.find("/usr/bin/teamd -r -t PortChannel382") != std::string::npos)
     {
         mkdir("/var/run/teamd", 0755);
@@ -272,6 +286,7 @@ namespace teammgr_ut
             mock_rtnl_link_change_result = 0;
             mock_if_nametoindex_name.clear();
             mock_kernel_mac_updates.clear();
+            mock_missing_ports.clear();
             callback = cb;
             callback_kill = cb_kill;
             callback_fopen = cb_fopen;
@@ -376,6 +391,30 @@ namespace teammgr_ut
         EXPECT_GE(std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count(), 200);
     }
 
+    TEST_F(TeamMgrTest, testStartTeamdConcurrently)
+    {
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::Table cfg_lag_table = swss::Table(m_config_db.get(), CFG_LAG_TABLE_NAME);
+        for (int i = 600; i < 604; i++)
+        {
+            cfg_lag_table.set(std::string("PortChannel") + std::to_string(i), { { "admin_status", "up" },
+                    { "mtu", "9100" },
+                    { "lacp_key", "auto" } });
+        }
+        teammgr.addExistingData(&cfg_lag_table);
+        teammgr.doTask();
+        ASSERT_EQ(mockCallArgs.size(), 12);
+        // All teamd instances are started before any of the port channels is configured
+        for (size_t i = 0; i < 4; i++)
+        {
+            EXPECT_NE(mockCallArgs[i].find("/usr/bin/teamd -r -t PortChannel60"), std::string::npos);
+        }
+        for (size_t i = 4; i < mockCallArgs.size(); i++)
+        {
+            EXPECT_EQ(mockCallArgs[i].find("/usr/bin/teamd"), std::string::npos);
+        }
+    }
+
     TEST_F(TeamMgrTest, testSetLagSysmacUpdatesKernelAppAndState)
     {
         swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
@@ -510,4 +549,61 @@ namespace teammgr_ut
             return fvField(fv) == "system_mac" && fvValue(fv) == "02:03:04:05:06:07";
         }));
     }
+
+    TEST_F(TeamMgrTest, testDoLagMemberTaskEnslavesMembersPerLag)
+    {
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::Table stateLagTable(m_state_db.get(), STATE_LAG_TABLE_NAME);
+        stateLagTable.set("PortChannel1", { { "state", "ok" } });
+        swss::Table statePortTable(m_state_db.get(), STATE_PORT_TABLE_NAME);
+        statePortTable.set("Ethernet0", { { "state", "ok" } });
+        statePortTable.set("Ethernet4", { { "state", "ok" } });
+
+        swss::Table cfg_lag_member_table(m_config_db.get(), CFG_LAG_MEMBER_TABLE_NAME);
+        cfg_lag_member_table.set("PortChannel1|Ethernet0", { { "NULL", "NULL" } });
+        cfg_lag_member_table.set("PortChannel1|Ethernet4", { { "NULL", "NULL" } });
+        teammgr.addExistingData(&cfg_lag_member_table);
+        teammgr.doTask();
+
+        // Both members are added to teamd by the same command
+        auto batch = std::find_if(mockCallArgs.begin(), mockCallArgs.end(), [](const std::string &cmd) {
+            return cmd.find("port add") != std::string::npos;
+        });
+        ASSERT_NE(batch, mockCallArgs.end());
+        EXPECT_NE(batch->find("port add \"Ethernet0\""), std::string::npos);
+        EXPECT_NE(batch->find("port add \"Ethernet4\""), std::string::npos);
+    }
+
+    TEST_F(TeamMgrTest, testDoLagMemberTaskSkipsMissingMember)
+    {
+        swss::TeamMgr teammgr(m_config_db.get(), m_app_db.get(), m_state_db.get(), cfg_lag_tables);
+        swss::Table stateLagTable(m_state_db.get(), STATE_LAG_TABLE_NAME);
+        stateLagTable.set("PortChannel1", { { "state", "ok" } });
+        swss::Table statePortTable(m_state_db.get(), STATE_PORT_TABLE_NAME);
+        statePortTable.set("Ethernet0", { { "state", "ok" } });
+        statePortTable.set("Ethernet4", { { "state", "ok" } });
+        statePortTable.set("Ethernet8", { { "state", "ok" } });
+        mock_missing_ports.insert("Ethernet4");
+
+        swss::Table cfg_lag_member_table(m_config_db.get(), CFG_LAG_MEMBER_TABLE_NAME);
+        cfg_lag_member_table.set("PortChannel1|Ethernet0", { { "NULL", "NULL" } });
+        cfg_lag_member_table.set("PortChannel1|Ethernet4", { { "NULL", "NULL" } });
+        cfg_lag_member_table.set("PortChannel1|Ethernet8", { { "NULL", "NULL" } });
+        teammgr.addExistingData(&cfg_lag_member_table);
+        teammgr.doTask();
+
+        // The missing member is left out, the others are still added
+        auto batch = std::find_if(mockCallArgs.begin(), mockCallArgs.end(), [](const std::string &cmd) {
+            return cmd.find("port add") != std::string::npos;
+        });
+        ASSERT_NE(batch, mockCallArgs.end());
+        EXPECT_NE(batch->find("port add \"Ethernet0\""), std::string::npos);
+        EXPECT_NE(batch->find("port add \"Ethernet8\""), std::string::npos);
+        EXPECT_EQ(batch->find("Ethernet4"), std::string::npos);
+        EXPECT_EQ(std::count(mockCallArgs.begin(), mockCallArgs.end(), "/sbin/ip link show \"Ethernet4\""), 1);
+
+        // The missing member is ignored rather than retried
+        teammgr.doTask();
+        EXPECT_EQ(std::count(mockCallArgs.begin(), mockCallArgs.end(), "/sbin/ip link show \"Ethernet4\""), 1);
+    }
 }
@@ -61,4 +61,76 @@ namespace warmrestartassist_test
         ASSERT_EQ(fvField(fvVector[0]), "field");
         ASSERT_EQ(fvValue(fvVector[0]), "value1");
     }
+
+    TEST_F(WarmrestartassistTest, hashedCacheBatchReconcile)
+    {
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        testTable.set("stale", { {"field", "value0"} });
+        testTable.set("same", { {"field1", "a"}, {"field2", "b"} });
+
+        appRestartAssist->setHashedCache(true);
+        appRestartAssist->readTablesToMap();
+        ASSERT_EQ(appRestartAssist->getReconcilePending(), 3);
+
+        // Same values in a different field order are SAME, and no values are cached for them
+        vector<FieldValueTuple> fvVector = { {"field2", "b"}, {"field1", "a"} };
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "same", fvVector, false);
+        auto &cached = appRestartAssist->appTableHashMap[APP_WRA_TEST_TABLE_NAME];
+        EXPECT_EQ(cached["same"].state, AppRestartAssist::SAME);
+        EXPECT_TRUE(cached["same"].fvVector.empty());
+
+        fvVector = { {"field", "value1"} };
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "key", fvVector, false);
+        EXPECT_EQ(cached["key"].state, AppRestartAssist::NEW);
+
+        ASSERT_FALSE(appRestartAssist->reconcileBatch(2));
+        EXPECT_EQ(appRestartAssist->getReconcilePending(), 1);
+        EXPECT_TRUE(appRestartAssist->isWarmStartInProgress());
+
+        // Updates received while reconciling go straight to the table
+        fvVector = { {"field", "value2"} };
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "new", fvVector, false);
+        fvVector.clear();
+        ASSERT_TRUE(testTable.get("new", fvVector));
+        ASSERT_EQ(fvValue(fvVector[0]), "value2");
+
+        ASSERT_TRUE(appRestartAssist->reconcileBatch(2));
+        EXPECT_FALSE(appRestartAssist->isWarmStartInProgress());
+        EXPECT_EQ(appRestartAssist->getReconcilePending(), 0);
+
+        fvVector.clear();
+        ASSERT_TRUE(testTable.get("key", fvVector));
+        ASSERT_EQ(fvValue(fvVector[0]), "value1");
+        EXPECT_FALSE(testTable.get("stale", fvVector));
+        EXPECT_TRUE(testTable.get("same", fvVector));
+    }
+
+    TEST_F(WarmrestartassistTest, hashedCacheCollision)
+    {
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        testTable.set("restored", { {"field", "value0"} });
+
+        appRestartAssist->setHashedCache(true);
+        appRestartAssist->readTablesToMap();
+        auto &cached = appRestartAssist->appTableHashMap[APP_WRA_TEST_TABLE_NAME];
+
+        // Force a hash collision with the restored value: the update must still be NEW
+        vector<FieldValueTuple> fvVector = { {"field", "value1"} };
+        cached["restored"].hash = AppRestartAssist::hashFieldValues(fvVector);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "restored", fvVector, false);
+        EXPECT_EQ(cached["restored"].state, AppRestartAssist::NEW);
+
+        // Same for a collision with the value of a NEW entry
+        fvVector = { {"field", "value2"} };
+        cached["restored"].hash = AppRestartAssist::hashFieldValues(fvVector);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "restored", fvVector, false);
+        EXPECT_EQ(cached["restored"].state, AppRestartAssist::NEW);
+        ASSERT_EQ(cached["restored"].fvVector.size(), 1);
+        EXPECT_EQ(fvValue(cached["restored"].fvVector[0]), "value2");
+
+        appRestartAssist->reconcile();
+        fvVector.clear();
+        ASSERT_TRUE(testTable.get("restored", fvVector));
+        ASSERT_EQ(fvValue(fvVector[0]), "value2");
+    }
 }
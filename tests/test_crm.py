@@ -29,6 +29,12 @@ def crm_update(dvs, field, value):
     time.sleep(1)
 
 class TestCrm(object):
+    @pytest.fixture(autouse=True)
+    def crm_full_refresh(self, dvs):
+        # The tests below change SAI availability behind orchagent's back,
+        # so make CRM query every resource on each poll
+        crm_update(dvs, "full_refresh_interval", "0")
+
     def test_CrmFdbEntry(self, dvs, testlog):
 
         # disable ipv6 on Ethernet8 neighbor as once ipv6 link-local address is
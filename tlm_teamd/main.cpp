@@ -1,6 +1,8 @@
 #include <csignal>
 #include <iostream>
 #include <deque>
+#include <chrono>
+#include <algorithm>
 
 #include <logger.h>
 #include <select.h>
@@ -65,7 +67,11 @@ void sig_handler(int signo)
 ///
 int main()
 {
-    const int ms_select_timeout = 1000;
+    // teamd state is refreshed on team events. The periodic dumps are a safety net for
+    // changes which don't produce team events. The poll interval is doubled up to the
+    // maximum while the dumps don't change anything, and reset on any change.
+    const int ms_min_poll_interval = 1000;
+    const int ms_max_poll_interval = 8000;
 
     sighandler_t sig_res;
 
@@ -90,41 +96,67 @@ int main()
         SWSS_LOG_NOTICE("Starting");
         swss::DBConnector db("STATE_DB", 0);
 
-        ValuesStore values_store(&db);
-        TeamdCtlMgr teamdctl_mgr;
-
         swss::Select s;
         swss::Selectable * event;
         swss::SubscriberStateTable sst_lag(&db, STATE_LAG_TABLE_NAME);
         s.addSelectable(&sst_lag);
 
+        ValuesStore values_store(&db);
+        TeamdCtlMgr teamdctl_mgr(&s);
+
+        int poll_interval = ms_min_poll_interval;
+        auto next_poll = std::chrono::steady_clock::now() + std::chrono::milliseconds(poll_interval);
+
         while (g_run && rc == 0)
         {
-            int res = s.select(&event, ms_select_timeout);
+            auto now = std::chrono::steady_clock::now();
+            auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(next_poll - now).count();
+            int res = s.select(&event, static_cast<int>(std::max<decltype(timeout)>(timeout, 0)));
             if (res == swss::Select::OBJECT)
             {
-                update_interfaces(sst_lag, teamdctl_mgr);
-                values_store.update(teamdctl_mgr.get_dumps(false));
+                if (event == &sst_lag)
+                {
+                    update_interfaces(sst_lag, teamdctl_mgr);
+                    values_store.update(teamdctl_mgr.get_dumps(false));
+                }
+                else
+                {
+                    values_store.update(teamdctl_mgr.get_changed_dumps(), false);
+                }
+                poll_interval = ms_min_poll_interval;
+                next_poll = std::min(next_poll, std::chrono::steady_clock::now() + std::chrono::milliseconds(poll_interval));
             }
             else if (res == swss::Select::ERROR)
             {
                 SWSS_LOG_ERROR("Select returned ERROR");
                 rc = -2;
             }
-            else if (res == swss::Select::TIMEOUT)
+            else if (res != swss::Select::TIMEOUT)
+            {
+                SWSS_LOG_ERROR("Select returned unknown value");
+                rc = -3;
+            }
+
+            if (rc != 0 || std::chrono::steady_clock::now() < next_poll)
+            {
+                continue;
+            }
+
+            teamdctl_mgr.process_add_queue();
+            // In the case of lag removal, there is a scenario where the select::TIMEOUT
+            // occurs, it triggers get_dumps incorrectly for resource which was in process of
+            // getting deleted. The fix here is to retry and check if this is a real failure.
+            bool changed = values_store.update(teamdctl_mgr.get_dumps(true));
+            if (changed || teamdctl_mgr.has_pending())
             {
-                teamdctl_mgr.process_add_queue();
-                // In the case of lag removal, there is a scenario where the select::TIMEOUT
-                // occurs, it triggers get_dumps incorrectly for resource which was in process of 
-                // getting deleted. The fix here is to retry and check if this is a real failure.
-                values_store.update(teamdctl_mgr.get_dumps(true));
+                poll_interval = ms_min_poll_interval;
             }
             else
             {
-                SWSS_LOG_ERROR("Select returned unknown value");
-                rc = -3;
+                poll_interval = std::min(poll_interval * 2, ms_max_poll_interval);
             }
-	    }
+            next_poll = std::chrono::steady_clock::now() + std::chrono::milliseconds(poll_interval);
+        }
         SWSS_LOG_NOTICE("Exiting");
     }
     catch (const std::exception & e)
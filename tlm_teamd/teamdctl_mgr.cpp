@@ -1,5 +1,7 @@
 #include <cstring>
 #include <algorithm>
+#include <stdexcept>
+#include <net/if.h>
 
 #include <logger.h>
 
@@ -24,12 +26,88 @@ void teamdctl_log_function(struct teamdctl *tdc, int priority,
 
 }
 
+const struct team_change_handler TeamEventListener::m_change_handler = {
+    .func       = TeamEventListener::change_handler,
+    .type_mask  = TEAM_PORT_CHANGE | TEAM_OPTION_CHANGE
+};
+
+///
+/// Connect to the kernel team driver of the LAG and subscribe to its port and option changes
+/// @param lag_name a name for LAG interface
+///
+TeamEventListener::TeamEventListener(const std::string & lag_name) : m_lag_name(lag_name)
+{
+    unsigned int ifindex = if_nametoindex(lag_name.c_str());
+    if (ifindex == 0)
+    {
+        throw std::runtime_error("Can't find ifindex for LAG '" + lag_name + "'");
+    }
+
+    m_team = team_alloc();
+    if (!m_team)
+    {
+        throw std::runtime_error("Can't allocate team handler for LAG '" + lag_name + "'");
+    }
+
+    int err = team_init(m_team, static_cast<uint32_t>(ifindex));
+    if (!err)
+    {
+        err = team_change_handler_register(m_team, &m_change_handler, this);
+    }
+    if (err)
+    {
+        team_free(m_team);
+        m_team = nullptr;
+        throw std::runtime_error("Can't subscribe to team events for LAG '" + lag_name + "': " + strerror(-err));
+    }
+}
+
+TeamEventListener::~TeamEventListener()
+{
+    if (m_team)
+    {
+        team_change_handler_unregister(m_team, &m_change_handler, this);
+        team_free(m_team);
+    }
+}
+
+int TeamEventListener::getFd()
+{
+    return team_get_event_fd(m_team);
+}
+
+uint64_t TeamEventListener::readData()
+{
+    team_handle_events(m_team);
+    return 0;
+}
+
+///
+/// Called by libteam from team_handle_events(). Only marks the LAG changed,
+/// the state itself is read from teamd by TeamdCtlMgr::get_changed_dumps()
+///
+int TeamEventListener::change_handler(struct team_handle * th, void * arg, team_change_type_mask_t type_mask)
+{
+    auto listener = static_cast<TeamEventListener *>(arg);
+    listener->m_changed = true;
+    SWSS_LOG_DEBUG("Got team change event for LAG '%s'", listener->m_lag_name.c_str());
+    return 0;
+}
+
 
 ///
 /// The destructor clean up handlers to teamds
 ///
 TeamdCtlMgr::~TeamdCtlMgr()
 {
+    for (const auto & p: m_listeners)
+    {
+        if (m_select)
+        {
+            m_select->removeSelectable(p.second.get());
+        }
+    }
+
     for (const auto & p: m_handlers)
     {
         const auto & lag_name = p.first;
@@ -108,6 +186,7 @@ bool TeamdCtlMgr::try_add_lag(const std::string & lag_name)
 
     m_handlers.emplace(lag_name, tdc);
     m_lags_to_add.erase(lag_name);
+    add_listener(lag_name);
     SWSS_LOG_NOTICE("The LAG '%s' has been added.", lag_name.c_str());
 
     return true;
@@ -127,6 +206,7 @@ bool TeamdCtlMgr::remove_lag(const std::string & lag_name)
         teamdctl_disconnect(tdc);
         teamdctl_free(tdc);
         m_handlers.erase(lag_name);
+        remove_listener(lag_name);
         SWSS_LOG_NOTICE("The LAG '%s' has been removed.", lag_name.c_str());
     }
     else if (m_lags_to_add.find(lag_name) != m_lags_to_add.end())
@@ -150,6 +230,46 @@ bool TeamdCtlMgr::remove_lag(const std::string & lag_name)
     return true;
 }
 
+///
+/// Subscribe to team events of the LAG. This is best effort: a LAG without
+/// a listener is still refreshed by the periodic dumps.
+/// @param lag_name a name for LAG interface
+///
+void TeamdCtlMgr::add_listener(const std::string & lag_name)
+{
+    if (!m_select)
+    {
+        return;
+    }
+
+    try
+    {
+        auto listener = std::make_shared<TeamEventListener>(lag_name);
+        m_select->addSelectable(listener.get());
+        m_listeners[lag_name] = listener;
+    }
+    catch (const std::exception & e)
+    {
+        SWSS_LOG_WARN("Can't listen to team events, LAG '%s' is only polled: %s", lag_name.c_str(), e.what());
+    }
+}
+
+///
+/// Unsubscribe from team events of the LAG
+/// @param lag_name a name for LAG interface
+///
+void TeamdCtlMgr::remove_listener(const std::string & lag_name)
+{
+    auto it = m_listeners.find(lag_name);
+    if (it == m_listeners.end())
+    {
+        return;
+    }
+
+    m_select->removeSelectable(it->second.get());
+    m_listeners.erase(it);
+}
+
 ///
 /// Process the queue with postponed add operations for LAG.
 ///
@@ -258,3 +378,40 @@ TeamdCtlDumps TeamdCtlMgr::get_dumps(bool to_retry)
     return res;
 }
 
+
+///
+/// Get dumps for LAG interfaces which have reported team events since the last call
+/// @return vector of pairs. Each pair first value is a name of LAG, second value is a dump
+///
+TeamdCtlDumps TeamdCtlMgr::get_changed_dumps()
+{
+    TeamdCtlDumps res;
+
+    for (const auto & p: m_listeners)
+    {
+        const auto & lag_name = p.first;
+        const auto & listener = p.second;
+        if (!listener->is_changed())
+        {
+            continue;
+        }
+        listener->clear_changed();
+
+        const auto & result = get_dump(lag_name, false);
+        if (result.first)
+        {
+            res.push_back({ lag_name, result.second });
+        }
+    }
+
+    return res;
+}
+
+///
+/// Returns true, if there are LAGs waiting to be connected or LAGs
+/// which dumps failed and are being retried.
+///
+bool TeamdCtlMgr::has_pending() const
+{
+    return !m_lags_to_add.empty() || !m_lags_err_retry.empty();
+}
@@ -2,18 +2,47 @@
 
 #include <string>
 #include <vector>
+#include <memory>
 #include <unordered_map>
 
+#include <select.h>
+#include <selectable.h>
+
+#include <team.h>
 #include <teamdctl.h>
 
 using TeamdCtlDump = std::pair<bool, std::string>;
 using TeamdCtlDumpsEntry = std::pair<std::string, std::string>;
 using TeamdCtlDumps = std::vector<TeamdCtlDumpsEntry>;
 
+///
+/// libteamdctl has no notification API, so the port and option changes reported
+/// by the kernel team driver are used as a hint that the teamd state of a LAG changed.
+/// The selectable is ready when libteam has events for the LAG.
+///
+class TeamEventListener : public swss::Selectable
+{
+public:
+    TeamEventListener(const std::string & lag_name);
+    ~TeamEventListener() override;
+    int getFd() override;
+    uint64_t readData() override;
+    bool is_changed() const { return m_changed; }
+    void clear_changed() { m_changed = false; }
+
+private:
+    static int change_handler(struct team_handle * th, void * arg, team_change_type_mask_t type_mask);
+    static const struct team_change_handler m_change_handler;
+
+    std::string m_lag_name;
+    struct team_handle * m_team = nullptr;
+    bool m_changed = false;
+};
+
 class TeamdCtlMgr
 {
 public:
-    TeamdCtlMgr() = default;
+    TeamdCtlMgr(swss::Select * select = nullptr) : m_select(select) {};
     ~TeamdCtlMgr();
     bool add_lag(const std::string & lag_name);
     bool remove_lag(const std::string & lag_name);
@@ -21,12 +50,20 @@ public:
     // Retry logic added to prevent incorrect error reporting in dump API's
     TeamdCtlDump get_dump(const std::string & lag_name, bool to_retry);
     TeamdCtlDumps get_dumps(bool to_retry);
+    // Dumps only for LAGs which have reported a change since the last call
+    TeamdCtlDumps get_changed_dumps();
+    // True, if there are LAGs to be added or dumps to be retried
+    bool has_pending() const;
 
 private:
     bool has_key(const std::string & lag_name) const;
     bool try_add_lag(const std::string & lag_name);
+    void add_listener(const std::string & lag_name);
+    void remove_listener(const std::string & lag_name);
 
+    swss::Select * m_select;
     std::unordered_map<std::string, struct teamdctl*> m_handlers;
+    std::unordered_map<std::string, std::shared_ptr<TeamEventListener>> m_listeners;
     std::unordered_map<std::string, int> m_lags_to_add;
     std::unordered_map<std::string, int> m_lags_err_retry;
 
@@ -225,18 +225,36 @@ HashOfRecords ValuesStore::from_json(const std::vector<StringPair> & dumps)
 
 ///
 /// Extract a list of stale keys from the storage.
-/// The stale key is a key which a presented in the storage, but not presented
-/// in the temporary storage. That means that the key must be removed
+/// The stale key is a key of a parsed LAG which a presented in the storage, but not presented
+/// in the temporary storage, or a key of a LAG which has no dump at all in the full update.
+/// That means that the key must be removed
 /// @param storage a reference to the temporary storage
+/// @param parsed_lags LAGs which dumps were parsed into the temporary storage
+/// @param present_lags LAGs which have dumps, parsed or unchanged
+/// @param full true, if dumps were received for all registered LAGs
 /// @return list of stale keys
 ///
-std::vector<std::string> ValuesStore::get_old_keys(const HashOfRecords & storage)
+std::vector<std::string> ValuesStore::get_old_keys(const HashOfRecords & storage,
+                                                   const std::unordered_set<std::string> & parsed_lags,
+                                                   const std::unordered_set<std::string> & present_lags,
+                                                   bool full)
 {
     std::vector<std::string> old_keys;
     for (const auto & p: m_storage)
     {
         const auto & db_key = p.first;
-        if (storage.find(db_key) == storage.end())
+        const auto & lag_name = get_lag_name(db_key);
+        bool is_stale;
+        if (parsed_lags.find(lag_name) != parsed_lags.end())
+        {
+            is_stale = storage.find(db_key) == storage.end();
+        }
+        else
+        {
+            is_stale = full && present_lags.find(lag_name) == present_lags.end();
+        }
+
+        if (is_stale)
         {
             old_keys.push_back(db_key);
         }
@@ -270,6 +288,18 @@ StringPair ValuesStore::split_key(const std::string & key)
     return std::make_pair(key.substr(0, sep_pos), key.substr(sep_pos + 1));
 }
 
+///
+/// Extract the LAG name from a full key
+/// For example: LAG_MEMBER_TABLE|PortChannel01|Ethernet0 would return "PortChannel01"
+/// @param key a database key.
+/// @return a name of the LAG
+///
+std::string ValuesStore::get_lag_name(const std::string & key)
+{
+    const auto & table_key = split_key(key).second;
+    return table_key.substr(0, table_key.find('|'));
+}
+
 ///
 /// Remove keys from the db
 /// @param keys a list of keys to remove
@@ -298,67 +328,62 @@ void ValuesStore::remove_keys_db(const std::vector<std::string> & keys)
 /// Update the storage with values from the temporary storage
 /// The update is the following:
 /// 1. For each key in the temporary storage we check that we have that key in the storage
-/// 2. if not, we insert the key and value to the storage
-/// 3. if yes, we check that value of the key is not changed. If the value is changed we
-///    replace that value with the value from the temporary storage
-/// This method returns a list of keys which should be updated in the database
+/// 2. if not, we insert the key and value to the storage, and all values must be written
+/// 3. if yes, we compare every value of the key with the storage. Only changed values
+///    are replaced in the storage and must be written
+/// This method returns the values which should be updated in the database
 /// @param storage the temporary storage
-/// @retorun a list of keys which must be updated in the storage
+/// @return changed values for every key which must be updated in the db
 ///
-std::vector<std::string> ValuesStore::update_storage(const HashOfRecords & storage)
+HashOfRecords ValuesStore::update_storage(const HashOfRecords & storage)
 {
-    std::vector<std::string> to_update;
+    HashOfRecords changes;
 
     for (const auto & entry_pair: storage)
     {
         const auto & entry_key    = entry_pair.first;
         const auto & entry_values = entry_pair.second;
-        if (m_storage.find(entry_key) == m_storage.end())
+        auto found = m_storage.find(entry_key);
+        if (found == m_storage.end())
         {
             m_storage.emplace(entry_pair);
-            to_update.emplace_back(entry_key);
+            changes.emplace(entry_pair);
+            continue;
         }
-        else
+
+        auto & stored_values = found->second;
+        Records changed_values;
+        for (const auto & row_pair: entry_values)
         {
-            bool is_changed = false;
-            for (const auto & row_pair: entry_values)
+            const auto & row_key   = row_pair.first;
+            const auto & row_value = row_pair.second;
+            auto & stored_value = stored_values[row_key];
+            if (stored_value != row_value)
             {
-                const auto & row_key   = row_pair.first;
-                const auto & row_value = row_pair.second;
-                if (m_storage[entry_key][row_key] != row_value)
-                {
-                    is_changed = true;
-                    break;
-                }
+                stored_value = row_value;
+                changed_values.emplace(row_pair);
             }
+        }
 
-            if (is_changed)
-            {
-                m_storage.erase(entry_key);
-                m_storage.emplace(entry_pair);
-                to_update.emplace_back(entry_key);
-            }
+        if (!changed_values.empty())
+        {
+            changes.emplace(entry_key, std::move(changed_values));
         }
     }
 
-    return to_update;
+    return changes;
 }
 
 ///
-/// Update values in the db with values from the temporary storage
-/// @param storage a reference to the temporary storage
-/// @param keys_to_refresh a list of keys which must be refreshed in the db
+/// Write changed values to the db. Values which weren't changed are kept in the db as is
+/// @param changes changed values for every key which must be updated in the db
 ///
-void ValuesStore::update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh)
+void ValuesStore::update_db(const HashOfRecords & changes)
 {
-    for (const auto & key: keys_to_refresh)
+    for (const auto & p: changes)
     {
-        std::vector<swss::FieldValueTuple> fvp;
-        for (const auto & row_pair: storage.at(key))
-        {
-            fvp.emplace_back(row_pair);
-        }
-        const auto & table_pair = split_key(key);
+        std::vector<swss::FieldValueTuple> fvp(p.second.begin(), p.second.end());
+        const auto & table_pair = split_key(p.first);
         swss::Table table(m_db, table_pair.first);
         table.set(table_pair.second, fvp);
     }
@@ -366,21 +391,62 @@ void ValuesStore::update_db(const HashOfRecords & storage, const std::vector<std
 
 
 ///
-/// Update the storage with json dumps for every registered LAG interface.
+/// Update the storage with json dumps for registered LAG interfaces.
+/// Dumps which are the same as the last parsed dump of the LAG are not parsed again.
+/// @param dumps dumps from teamds. It is a vector of pairs of LAG name and json dump
+/// @param full true, if dumps are for all registered LAGs. LAGs without dumps are removed then
+/// @return true, if any value was written or removed from the db
 ///
-void ValuesStore::update(const std::vector<StringPair> & dumps)
+bool ValuesStore::update(const std::vector<StringPair> & dumps, bool full)
 {
     try
     {
-        const auto & storage = from_json(dumps);
-        const auto & old_keys = get_old_keys(storage);
+        std::unordered_set<std::string> present_lags;
+        std::unordered_set<std::string> parsed_lags;
+        std::vector<StringPair> changed_dumps;
+        for (const auto & p: dumps)
+        {
+            present_lags.insert(p.first);
+            auto found = m_dumps.find(p.first);
+            if (found == m_dumps.end() || found->second != p.second)
+            {
+                parsed_lags.insert(p.first);
+                changed_dumps.push_back(p);
+            }
+        }
+
+        const auto & storage = from_json(changed_dumps);
+        const auto & old_keys = get_old_keys(storage, parsed_lags, present_lags, full);
         remove_keys_db(old_keys);
         remove_keys_storage(old_keys);
-        const auto & keys_to_refresh = update_storage(storage);
-        update_db(storage, keys_to_refresh);
+        const auto & changes = update_storage(storage);
+        update_db(changes);
+
+        for (const auto & p: changed_dumps)
+        {
+            m_dumps[p.first] = p.second;
+        }
+        if (full)
+        {
+            for (auto it = m_dumps.begin(); it != m_dumps.end();)
+            {
+                if (present_lags.find(it->first) == present_lags.end())
+                {
+                    it = m_dumps.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        return !old_keys.empty() || !changes.empty();
     }
     catch (const std::exception & e)
     {
         SWSS_LOG_WARN("Exception '%s' had been thrown in ValuesStore", e.what());
     }
+
+    return false;
 }
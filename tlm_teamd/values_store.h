@@ -2,6 +2,8 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <jansson.h>
 
@@ -15,7 +17,9 @@ class ValuesStore
 {
 public:
     ValuesStore(const swss::DBConnector * db) : m_db(db) {};
-    void update(const std::vector<StringPair> & dumps);
+    // Returns true, if the db was changed. With full set to false, the LAGs
+    // which aren't in dumps are left as is.
+    bool update(const std::vector<StringPair> & dumps, bool full = true);
 
 private:
     enum class json_type
@@ -34,15 +38,20 @@ private:
     std::string unpack_integer(json_t * root, const std::string & key, const std::string & path);
     std::string get_value(json_t * root, const std::string & path, ValuesStore::json_type type);
     HashOfRecords from_json(const std::vector<StringPair> & dumps);
-    std::vector<std::string> get_old_keys(const HashOfRecords & storage);
+    std::vector<std::string> get_old_keys(const HashOfRecords & storage,
+                                          const std::unordered_set<std::string> & parsed_lags,
+                                          const std::unordered_set<std::string> & present_lags,
+                                          bool full);
     void remove_keys_storage(const std::vector<std::string> & keys);
     void remove_keys_db(const std::vector<std::string> & keys);
     StringPair split_key(const std::string & key);
-    std::vector<std::string> update_storage(const HashOfRecords & storage);
-    void update_db(const HashOfRecords & storage, const std::vector<std::string> & keys_to_refresh);
+    std::string get_lag_name(const std::string & key);
+    HashOfRecords update_storage(const HashOfRecords & storage);
+    void update_db(const HashOfRecords & changes);
     void extract_values(const std::string & lag_name, json_t * root, HashOfRecords & storage);
 
     HashOfRecords m_storage;  // our main storage
+    std::unordered_map<std::string, std::string> m_dumps;  // last parsed json dump for every LAG
     const swss::DBConnector * m_db;
 
     const std::vector<std::pair<std::string, ValuesStore::json_type>> m_lag_paths = {
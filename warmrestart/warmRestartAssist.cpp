@@ -1,5 +1,6 @@
 #include <string>
 #include <algorithm>
+#include <functional>
 #include "logger.h"
 #include "schema.h"
 #include "warm_restart.h"
@@ -147,6 +148,14 @@ void AppRestartAssist::readTablesToMap()
                 continue;
             }
 
+            if (m_hashedCache)
+            {
+                SWSS_LOG_INFO("write to cachemap: %s, key: %s, hashed",
+                       (it->first).c_str(), key.c_str());
+                appTableHashMap[it->first][key] = HashedCacheEntry{ hashFieldValues(fv), STALE, {} };
+                continue;
+            }
+
             fv.push_back(state);
             setCacheEntryState(fv, STALE);
 
@@ -181,6 +190,40 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
     SWSS_LOG_INFO("Received message %s, key: %s, "
             "%s, delete = %d", tableName.c_str(), key.c_str(), joinVectorString(fvVector).c_str(), delete_key);
 
+    /*
+     * Reconcile is already draining the cache: this update supersedes
+     * whatever is cached for the key, so drop the cached entry and apply
+     * the update to appDB right away.
+     */
+    if (m_reconcileStarted)
+    {
+        auto cached = appTableCacheMap.find(tableName);
+        if (cached != appTableCacheMap.end())
+        {
+            cached->second.erase(key);
+        }
+        auto hashed = appTableHashMap.find(tableName);
+        if (hashed != appTableHashMap.end())
+        {
+            hashed->second.erase(key);
+        }
+        if (delete_key)
+        {
+            m_psTables[tableName]->del(key);
+        }
+        else
+        {
+            m_psTables[tableName]->set(key, fvVector);
+        }
+        return;
+    }
+
+    if (m_hashedCache)
+    {
+        insertToHashMap(tableName, key, fvVector, delete_key);
+        return;
+    }
+
     auto found = appTableCacheMap[tableName].find(key);
 
     if (delete_key)
@@ -247,6 +290,73 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
     return;
 }
 
+/*
+ * Same logic as insertToMap() on the hashed cache. Value hashes are only
+ * used to skip the comparison when they differ: on a hash match the values
+ * are compared with the ones cached for NEW entries, or with the ones still
+ * in appDB otherwise, so that a hash collision cannot drop an update.
+ */
+void AppRestartAssist::insertToHashMap(const string &tableName, const string &key,
+                                       vector<FieldValueTuple> &fvVector, bool delete_key)
+{
+    auto &tableMap = appTableHashMap[tableName];
+    auto found = tableMap.find(key);
+
+    if (delete_key)
+    {
+        SWSS_LOG_NOTICE("%s, delete key: %s, ", tableName.c_str(), key.c_str());
+        /* mark it as DELETE if exist, otherwise, no-op */
+        if (found != tableMap.end())
+        {
+            found->second.state = DELETE;
+            found->second.fvVector.clear();
+        }
+        return;
+    }
+
+    size_t hash = hashFieldValues(fvVector);
+
+    if (found == tableMap.end())
+    {
+        SWSS_LOG_NOTICE("%s, not found key: %s, new", tableName.c_str(), key.c_str());
+        tableMap[key] = HashedCacheEntry{ hash, NEW, std::move(fvVector) };
+        return;
+    }
+
+    bool same = false;
+    if (found->second.hash == hash)
+    {
+        if (found->second.state == NEW)
+        {
+            same = equalFieldValues(found->second.fvVector, fvVector);
+        }
+        else
+        {
+            // STALE, SAME and DELETE entries still hold their restored values in appDB
+            vector<FieldValueTuple> restored;
+            same = m_appTables[tableName]->get(key, restored) && equalFieldValues(restored, fvVector);
+        }
+    }
+
+    if (!same)
+    {
+        SWSS_LOG_NOTICE("%s, found key: %s, new value ", tableName.c_str(), key.c_str());
+        found->second = HashedCacheEntry{ hash, NEW, std::move(fvVector) };
+    }
+    else if (found->second.state == NEW)
+    {
+        // See insertToMap(): an entry updated again with the same new value stays NEW
+        SWSS_LOG_NOTICE("%s, found key: %s, it has been updated for the second time, keep state as NEW",
+                        tableName.c_str(), key.c_str());
+    }
+    else
+    {
+        SWSS_LOG_INFO("%s, found key: %s, same value", tableName.c_str(), key.c_str());
+        found->second.state = SAME;
+        found->second.fvVector.clear();
+    }
+}
+
 /*
  * Reconcile logic:
  *  iterate through the cache map
@@ -257,52 +367,119 @@ void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldVal
  */
 void AppRestartAssist::reconcile()
 {
-    std::string tableName;
+    SWSS_LOG_ENTER();
+    reconcileBatch(std::numeric_limits<size_t>::max());
+}
 
+/*
+ * Reconcile at most maxEntries cached entries, removing them from the cache
+ * as they are handled, and report progress. Returns true once the cache is
+ * drained and the warm start state is RECONCILED.
+ */
+bool AppRestartAssist::reconcileBatch(size_t maxEntries)
+{
     SWSS_LOG_ENTER();
-    for (auto tableIter = appTableCacheMap.begin(); tableIter != appTableCacheMap.end(); ++tableIter)
+
+    if (!m_reconcileStarted)
     {
-        tableName = tableIter->first;
-        for (auto it = (tableIter->second).begin(); it != (tableIter->second).end(); ++it)
+        m_reconcileStarted = true;
+        m_reconcileTotal = getReconcilePending();
+        m_reconcileProcessed = 0;
+        SWSS_LOG_NOTICE("%s: reconciling %zu cached entries", m_appName.c_str(), m_reconcileTotal);
+    }
+
+    size_t processed = 0;
+
+    for (auto tableIter = appTableCacheMap.begin(); tableIter != appTableCacheMap.end() && processed < maxEntries; )
+    {
+        auto &entries = tableIter->second;
+        for (auto it = entries.begin(); it != entries.end() && processed < maxEntries; ++processed)
         {
-            string s = joinVectorString(it->second);
             auto state = getCacheEntryState(it->second);
+            //exclude the state
+            it->second.pop_back();
+            reconcileEntry(tableIter->first, it->first, state, it->second);
+            it = entries.erase(it);
+        }
+        tableIter = entries.empty() ? appTableCacheMap.erase(tableIter) : std::next(tableIter);
+    }
 
-            if (state == SAME)
-            {
-                SWSS_LOG_INFO("%s SAME, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
-                continue;
-            }
-            else if (state == STALE || state == DELETE)
-            {
-                SWSS_LOG_NOTICE("%s STALE/DELETE, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+    for (auto tableIter = appTableHashMap.begin(); tableIter != appTableHashMap.end() && processed < maxEntries; )
+    {
+        auto &entries = tableIter->second;
+        for (auto it = entries.begin(); it != entries.end() && processed < maxEntries; ++processed)
+        {
+            reconcileEntry(tableIter->first, it->first, it->second.state, it->second.fvVector);
+            it = entries.erase(it);
+        }
+        tableIter = entries.empty() ? appTableHashMap.erase(tableIter) : std::next(tableIter);
+    }
 
-                //delete from appDB
-                m_psTables[tableName]->del(it->first);
-            }
-            else if (state == NEW)
-            {
-                SWSS_LOG_NOTICE("%s NEW, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+    m_reconcileProcessed += processed;
 
-                //add to appDB, exclude the state
-                it->second.pop_back();
-                m_psTables[tableName]->set(it->first, it->second);
-            }
-            else
-            {
-                throw std::logic_error("cache entry state is invalid");
-            }
-        }
-        // reconcile finished, clear the map, mark the warmstart state
-        appTableCacheMap[tableName].clear();
+    if (getReconcilePending() != 0)
+    {
+        SWSS_LOG_NOTICE("%s: reconciled %zu/%zu cached entries", m_appName.c_str(),
+                        m_reconcileProcessed, m_reconcileTotal);
+        return false;
     }
+
+    SWSS_LOG_NOTICE("%s: reconciled %zu cached entries", m_appName.c_str(), m_reconcileProcessed);
+
+    // reconcile finished, clear the map, mark the warmstart state
     appTableCacheMap.clear();
+    appTableHashMap.clear();
+    m_reconcileStarted = false;
     WarmStart::setWarmStartState(m_appName, WarmStart::RECONCILED);
     m_warmStartInProgress = false;
-    return;
+    return true;
+}
+
+// Number of cached entries not reconciled yet
+size_t AppRestartAssist::getReconcilePending()
+{
+    size_t pending = 0;
+    for (const auto &table : appTableCacheMap)
+    {
+        pending += table.second.size();
+    }
+    for (const auto &table : appTableHashMap)
+    {
+        pending += table.second.size();
+    }
+    return pending;
+}
+
+void AppRestartAssist::reconcileEntry(const string &tableName, const string &key,
+                                      cache_state_t state, const vector<FieldValueTuple> &fvVector)
+{
+    string s = joinVectorString(fvVector);
+
+    if (state == SAME)
+    {
+        SWSS_LOG_INFO("%s SAME, key: %s, %s",
+                tableName.c_str(), key.c_str(), s.c_str());
+    }
+    else if (state == STALE || state == DELETE)
+    {
+        SWSS_LOG_NOTICE("%s STALE/DELETE, key: %s, %s",
+                tableName.c_str(), key.c_str(), s.c_str());
+
+        //delete from appDB
+        m_psTables[tableName]->del(key);
+    }
+    else if (state == NEW)
+    {
+        SWSS_LOG_NOTICE("%s NEW, key: %s, %s",
+                tableName.c_str(), key.c_str(), s.c_str());
+
+        //add to appDB
+        m_psTables[tableName]->set(key, fvVector);
+    }
+    else
+    {
+        throw std::logic_error("cache entry state is invalid");
+    }
 }
 
 // set the reconcile interval
@@ -350,3 +527,33 @@ bool AppRestartAssist::contains(const std::vector<FieldValueTuple>& left,
 
     return true;
 }
+
+// Field/values sorted by field, so that values read back from appDB compare
+// and hash the same as the ones built by the application.
+static vector<FieldValueTuple> sortedFieldValues(const vector<FieldValueTuple> &fvVector)
+{
+    vector<FieldValueTuple> sorted(fvVector);
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}
+
+// Check if both vectors hold the same field/values, in any order
+bool AppRestartAssist::equalFieldValues(const std::vector<FieldValueTuple> &left,
+                                        const std::vector<FieldValueTuple> &right)
+{
+    return left.size() == right.size() && sortedFieldValues(left) == sortedFieldValues(right);
+}
+
+// Hash of the length-prefixed sorted field/values. It is only a filter:
+// insertToHashMap() compares the values whenever the hashes match.
+size_t AppRestartAssist::hashFieldValues(const std::vector<FieldValueTuple> &fvVector)
+{
+    string serialized;
+
+    for (const auto &fv : sortedFieldValues(fvVector))
+    {
+        serialized += to_string(fvField(fv).size()) + ":" + fvField(fv);
+        serialized += to_string(fvValue(fv).size()) + ":" + fvValue(fv);
+    }
+    return std::hash<string>()(serialized);
+}
@@ -3,6 +3,7 @@
 
 #include <unordered_map>
 #include <string>
+#include <limits>
 #include "dbconnector.h"
 #include "table.h"
 #include "producerstatetable.h"
@@ -49,6 +50,14 @@ namespace swss {
  *              appClass.getRestartAssist()->reconcile();
  *          }
  *      }
+ *
+ * For large tables, two optional modes reduce memory and the reconcile burst:
+ * - setHashedCache(true) before readTablesToMap() keeps only a hash of each
+ *   cached entry's field/values; full values are kept only for entries that
+ *   have to be written at reconcile time.
+ * - reconcileBatch(n) instead of reconcile() handles at most n cached entries
+ *   per call and returns true once the cache is drained. Updates received
+ *   in between are applied to the app table directly.
  */
 typedef std::map <std::string, Table *>              Tables;
 typedef std::map <std::string, ProducerStateTable *> ProducerStateTables;
@@ -84,6 +93,12 @@ public:
     void warmStartDisabled(void);
     void insertToMap(std::string tableName, std::string key, std::vector<FieldValueTuple> fvVector, bool delete_key);
     void reconcile(void);
+    bool reconcileBatch(size_t maxEntries);
+    size_t getReconcilePending(void);
+    void setHashedCache(bool enable)
+    {
+        m_hashedCache = enable;
+    }
     bool isWarmStartInProgress(void)
     {
         return m_warmStartInProgress;
@@ -107,6 +122,29 @@ private:
     // cache map to store temporary application table
     AppTableMap appTableCacheMap;
 
+    /*
+     * Hashed cache entry: hash of the field/values and the cache state.
+     * fvVector is only filled for NEW entries, which are written at reconcile.
+     * On a hash match the values are compared for equality, in any field
+     * order, rather than for containment as in the full cache.
+     */
+    struct HashedCacheEntry
+    {
+        size_t hash;
+        cache_state_t state;
+        std::vector<swss::FieldValueTuple> fvVector;
+    };
+    typedef std::map<std::string, std::unordered_map<std::string, HashedCacheEntry>> AppTableHashMap;
+
+    // cache map used instead of appTableCacheMap in hashed cache mode
+    AppTableHashMap appTableHashMap;
+    bool m_hashedCache = false;
+
+    // reconcile progress, see reconcileBatch()
+    bool m_reconcileStarted = false;
+    size_t m_reconcileTotal = 0;
+    size_t m_reconcileProcessed = 0;
+
     RedisPipeline      *m_pipeLine;
     Tables              m_appTables;  // app tables
     std::string         m_dockerName; // docker name of the application
@@ -123,6 +161,13 @@ private:
     cache_state_t getCacheEntryState(const std::vector<FieldValueTuple> &fvVector);
     bool contains(const std::vector<FieldValueTuple>& left,
                   const std::vector<FieldValueTuple>& right);
+    static bool equalFieldValues(const std::vector<FieldValueTuple> &left,
+                                 const std::vector<FieldValueTuple> &right);
+    static size_t hashFieldValues(const std::vector<FieldValueTuple> &fvVector);
+    void insertToHashMap(const std::string &tableName, const std::string &key,
+                         std::vector<FieldValueTuple> &fvVector, bool delete_key);
+    void reconcileEntry(const std::string &tableName, const std::string &key,
+                        cache_state_t state, const std::vector<FieldValueTuple> &fvVector);
 };
 
 }